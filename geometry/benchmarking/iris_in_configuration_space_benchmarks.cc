@@ -212,14 +212,21 @@ protected:
     std::vector<std::pair<std::string, VectorXd>> seeds_;
 };
 
+// The argument is the number of threads used for the counter-example
+// searches (IrisOptions::parallelism).
 BENCHMARK_DEFINE_F(IiwaWithShelvesAndBins, GenerateAllRegions)
 // NOLINTNEXTLINE(runtime/references)
 (benchmark::State& state) {
+    iris_options_.parallelism = Parallelism(static_cast<int>(state.range(0)));
     for (auto _ : state) {
         GenerateAllRegions();
     }
 }
-BENCHMARK_REGISTER_F(IiwaWithShelvesAndBins, GenerateAllRegions)->Unit(benchmark::kSecond);
+BENCHMARK_REGISTER_F(IiwaWithShelvesAndBins, GenerateAllRegions)
+        ->ArgName("threads")
+        ->Arg(1)
+        ->Arg(4)
+        ->Unit(benchmark::kSecond);
 
 }  // namespace
 }  // namespace optimization
@@ -9,6 +9,7 @@
 #include <gflags/gflags.h>
 
 #include "geometry/render_gl/factory.h"
+#include "geometry/render_raster/factory.h"
 #include "geometry/render_vtk/factory.h"
 #include "systems/sensors/image_writer.h"
 
@@ -44,7 +45,7 @@ const double kFovY = M_PI_4;
 
 /* The render engines generally supported by this benchmark; not all
  renderers are supported by all operating systems.  */
-enum class EngineType { Vtk, Gl };
+enum class EngineType { Vtk, Gl, Raster };
 
 /* Creates a render engine of the given type with the given background color. */
 template <EngineType engine_type>
@@ -62,6 +63,12 @@ std::unique_ptr<RenderEngine> MakeEngine(const Vector3d& bg_rgb) {
                                           .lights = {{.type = "point", .position = {0.5, 0.5, 0}}}};
         return MakeRenderEngineGl(params);
     }
+    if constexpr (engine_type == EngineType::Raster) {
+        // The software rasterizer has a headlamp only; it casts no shadows.
+        const Rgba bg(bg_rgb[0], bg_rgb[1], bg_rgb[2]);
+        const RenderEngineRasterParams params{.default_clear_color = bg};
+        return MakeRenderEngineRaster(params);
+    }
 }
 
 class RenderBenchmark : public benchmark::Fixture {
@@ -293,7 +300,7 @@ public:
 
 /* These macros serve the purpose of allowing compact and *consistent*
  declarations of benchmarks. The goal is to create a benchmark for each
- renderer type (e.g., Vtk, Gl) combined with each image type (Color, Depth, and
+ renderer type (e.g., Vtk, Gl, Raster) combined with each image type (Color, Depth, and
  Label). Each benchmark instance should be executed using the same parameters.
 
  These macros guarantee that a benchmark is declared, dispatches the right
@@ -345,6 +352,10 @@ MAKE_BENCHMARK(Gl, Depth);
 MAKE_BENCHMARK(Gl, Label);
 #endif
 
+MAKE_BENCHMARK(Raster, Color);
+MAKE_BENCHMARK(Raster, Depth);
+MAKE_BENCHMARK(Raster, Label);
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -137,6 +137,10 @@ namespace render {
      - __GlColor__: Renders the color image from RenderEngineGl.
      - __GlDepth__: Renders the depth image from RenderEngineGl.
      - __GlLabel__: Renders the label image from RenderEngineGl.
+     - __RasterColor__: Renders the color image from the software rasterizer
+       (MakeRenderEngineRaster()).
+     - __RasterDepth__: Renders the depth image from the software rasterizer.
+     - __RasterLabel__: Renders the label image from the software rasterizer.
    - __sphere_count__: The total number of spheres.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
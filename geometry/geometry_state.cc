@@ -10,6 +10,7 @@
 
 #include "common/autodiff.h"
 #include "common/default_scalars.h"
+#include "common/drake_bool.h"
 #include "common/extract_double.h"
 #include "common/text_logging.h"
 #include "geometry/geometry_frame.h"
@@ -117,6 +118,17 @@ std::string get_missing_id_message(const Key& key) {
     return "Error in map look up of unexpected key type";
 }
 
+// Reports whether the two poses have the same value (ignoring derivatives).
+// Symbolic poses are never reported as the same.
+template <typename T>
+bool HasSameValue(const RigidTransform<T>& X_AB, const RigidTransform<T>& X_AC) {
+    if constexpr (scalar_predicate<T>::is_bool) {
+        return X_AB.IsExactlyEqualTo(X_AC);
+    } else {
+        return false;
+    }
+}
+
 // The look up and error-throwing method for const values.
 template <class Key, class Value>
 const Value& GetValueOrThrow(const Key& key, const std::unordered_map<Key, Value>& map) {
@@ -285,6 +297,7 @@ GeometryState<T>::GeometryState(const GeometryState<U>& source)
     // handled by the KinematicsData class.
     convert_pose_vector(source.kinematics_data_.X_PFs, &kinematics_data_.X_PFs);
     convert_pose_vector(source.kinematics_data_.X_WFs, &kinematics_data_.X_WFs);
+    kinematics_data_.moved_geometries = source.kinematics_data_.moved_geometries;
 
     // Now convert the id -> pose map.
     {
@@ -1370,8 +1383,12 @@ void GeometryState<T>::AddRenderer(std::string name, std::unique_ptr<render::Ren
                     accepted |= render_engine->RegisterDeformableVisual(
                             id, driven_mesh_data_.at(Role::kPerception).render_meshes(id), *properties);
                 } else {
+                    // Register at the last computed world pose; only moved
+                    // geometries are updated afterwards (see
+                    // FinalizePoseUpdate()).
                     accepted |= render_engine->RegisterVisual(id, geometry.shape(), *properties,
-                                                              RigidTransformd(geometry.X_FG()), geometry.is_dynamic());
+                                                              convert_to_double(kinematics_data_.X_WGs.at(id)),
+                                                              geometry.is_dynamic());
                 }
             }
         }
@@ -1439,6 +1456,45 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
     engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(const std::vector<render::ImageRenderRequest>& requests) const {
+    // Each engine renders its own requests as a single batch, in order.
+    std::vector<std::string> renderer_names;
+    std::unordered_map<std::string, std::vector<render::ImageRenderRequest>> batches;
+    for (const render::ImageRenderRequest& request : requests) {
+        const std::string* renderer_name = nullptr;
+        if (request.color_camera.has_value()) {
+            renderer_name = &request.color_camera->core().renderer_name();
+        }
+        if (request.depth_camera.has_value()) {
+            const std::string& depth_renderer_name = request.depth_camera->core().renderer_name();
+            if (renderer_name != nullptr && *renderer_name != depth_renderer_name) {
+                throw std::logic_error(
+                        fmt::format("RenderImages(): the color and depth cameras of a request must use the same "
+                                    "renderer; they use '{}' and '{}'",
+                                    *renderer_name, depth_renderer_name));
+            }
+            renderer_name = &depth_renderer_name;
+        }
+        if (renderer_name == nullptr) {
+            if (request.color_image != nullptr || request.depth_image != nullptr || request.label_image != nullptr) {
+                throw std::logic_error("RenderImages(): an image was requested without a camera");
+            }
+            continue;
+        }
+        auto [iter, inserted] = batches.try_emplace(*renderer_name);
+        if (inserted) {
+            renderer_names.push_back(*renderer_name);
+        }
+        iter->second.push_back(request);
+    }
+    for (const std::string& renderer_name : renderer_names) {
+        const render::RenderEngine& engine = GetRenderEngineOrThrow(renderer_name);
+        // See note in RenderColorImage() about this const cast.
+        const_cast<render::RenderEngine&>(engine).RenderImages(batches.at(renderer_name));
+    }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd() const {
     return std::unique_ptr<GeometryState<AutoDiffXd>>(new GeometryState<AutoDiffXd>(*this));
@@ -1474,6 +1530,11 @@ void GeometryState<T>::ApplyProximityDefaults(const DefaultProximityProperties&
     AssignRole(get_source_id(geometry_id), geometry_id, props, RoleAssign::kReplace);
 }
 
+template <typename T>
+void GeometryState<T>::BakeStaticDistanceField(const StaticDistanceFieldConfig& config) {
+    geometry_engine_->BakeStaticDistanceField(config);
+}
+
 template <typename T>
 unordered_set<GeometryId> GeometryState<T>::CollectIds(const GeometrySet& geometry_set,
                                                        std::optional<Role> role,
@@ -1586,13 +1647,17 @@ void GeometryState<T>::ValidateRegistrationAndSetTopology(SourceId source_id,
 }
 
 template <typename T>
-void GeometryState<T>::FinalizePoseUpdate(const internal::KinematicsData<T>& kinematics_data,
+void GeometryState<T>::FinalizePoseUpdate(internal::KinematicsData<T>* kinematics_data,
                                           internal::ProximityEngine<T>* proximity_engine,
                                           std::vector<render::RenderEngine*> render_engines) const {
-    proximity_engine->UpdateWorldPoses(kinematics_data.X_WGs);
+    proximity_engine->UpdateWorldPoses(kinematics_data->X_WGs);
+    // Every render engine in this state has been given every geometry's last
+    // computed world pose (here, or at registration, including when the engine
+    // was added by AddRenderer()), so only the moved geometries need updating.
     for (auto* render_engine : render_engines) {
-        render_engine->UpdatePoses(kinematics_data.X_WGs);
+        render_engine->UpdatePoses(kinematics_data->X_WGs, kinematics_data->moved_geometries);
     }
+    kinematics_data->moved_geometries.clear();
 }
 
 template <typename T>
@@ -1650,7 +1715,12 @@ void GeometryState<T>::UpdatePosesRecursively(const internal::InternalFrame& fra
         // X_FG() is always RigidTransform<double>, to account for
         // GeometryState<AutoDiff>, we need to cast it to the common type T.
         RigidTransform<double> X_FG(child_geometry.X_FG());
-        kinematics_data->X_WGs[child_id] = X_WF * X_FG.cast<T>();
+        RigidTransform<T> X_WG = X_WF * X_FG.cast<T>();
+        RigidTransform<T>& X_WG_prior = kinematics_data->X_WGs[child_id];
+        if (!HasSameValue(X_WG, X_WG_prior)) {
+            kinematics_data->moved_geometries.push_back(child_id);
+        }
+        X_WG_prior = std::move(X_WG);
     }
 
     // Update each child frame.
@@ -70,6 +70,11 @@ struct KinematicsData {
     // geometry to the world frame.
     std::unordered_map<GeometryId, math::RigidTransform<T>> X_WGs;
 
+    // The ids of the geometries whose X_WGs value has changed since the render
+    // engines were last given their poses (see FinalizePoseUpdate()). Only the
+    // value counts; a pose whose derivatives alone changed hasn't moved.
+    std::vector<GeometryId> moved_geometries;
+
     // The configuration of every deformable geometry relative to the _world_
     // frame (regardless of roles) keyed by the corresponding geometry's id.
     std::unordered_map<GeometryId, VectorX<T>> q_WGs;
@@ -639,6 +644,10 @@ public:
                           const math::RigidTransformd& X_PC,
                           systems::sensors::ImageLabel16I* label_image_out) const;
 
+    /** Implementation of QueryObject::RenderImages().
+     @pre All poses have already been updated.  */
+    void RenderImages(const std::vector<render::ImageRenderRequest>& requests) const;
+
     //@}
 
     /** @name Scalar conversion */
@@ -672,6 +681,11 @@ public:
 
     //@}
 
+    /** Bakes (or loads) the signed distance field of the anchored geometry with
+     a proximity role, as described by SceneGraphConfig::static_distance_field.
+     Adding or removing anchored proximity geometry afterwards discards it. */
+    void BakeStaticDistanceField(const StaticDistanceFieldConfig& config);
+
 private:
     // GeometryState of one scalar type is friends with all other scalar types.
     template <typename>
@@ -737,8 +751,9 @@ private:
     void ValidateRegistrationAndSetTopology(SourceId source_id, FrameId frame_id, GeometryId geometry_id);
 
     // Method that updates the proximity engine and the render engines with the
-    // up-to-date _pose_ data in `kinematics_data`.
-    void FinalizePoseUpdate(const internal::KinematicsData<T>& kinematics_data,
+    // up-to-date _pose_ data in `kinematics_data`. The render engines are only
+    // given the poses of the moved geometries, whose list is then cleared.
+    void FinalizePoseUpdate(internal::KinematicsData<T>* kinematics_data,
                             internal::ProximityEngine<T>* proximity_engine,
                             std::vector<render::RenderEngine*> render_engines) const;
 
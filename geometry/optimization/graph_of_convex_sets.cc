@@ -4,6 +4,7 @@
 
 #include "geometry/optimization/graph_of_convex_sets.h"
 
+#include <exception>
 #include <limits>
 #include <memory>
 #include <string>
@@ -11,13 +12,16 @@
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/parallelism.hpp>
 #include <fmt/format.h>
 
+#include "common/ssize.h"
 #include "math/quadratic_form.h"
 #include "solvers/choose_best_solver.h"
 #include "solvers/create_constraint.h"
 #include "solvers/create_cost.h"
 #include "solvers/get_program_type.h"
+#include "solvers/ipopt_solver.h"
 #include "solvers/mosek_solver.h"
 
 namespace drake {
@@ -30,6 +34,9 @@ using Transcription = GraphOfConvexSets::Transcription;
 using Vertex = GraphOfConvexSets::Vertex;
 using VertexId = GraphOfConvexSets::VertexId;
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using Eigen::MatrixXd;
 using Eigen::Ref;
 using Eigen::RowVector2d;
@@ -63,16 +70,44 @@ using symbolic::Variable;
 using symbolic::Variables;
 
 namespace {
+/* Solves `prog` with `solver`. If `solver_mutex` is given, this may run
+concurrently with other solves: a thread-safe solver is then run on an
+instance of its own (unless `solver` is already owned by the caller), and any
+other solver is run under the mutex. */
+void SolveWith(const solvers::SolverInterface& solver,
+               bool solver_is_shared,
+               const MathematicalProgram& prog,
+               const solvers::SolverOptions& solver_options,
+               std::mutex* solver_mutex,
+               MathematicalProgramResult* result) {
+    if (solver_mutex == nullptr) {
+        solver.Solve(prog, {}, solver_options, result);
+        return;
+    }
+    const solvers::SolverId id = solver.solver_id();
+    // IPOPT (with MUMPS) is not thread-safe, and a solver that can't be made
+    // by id might hold state.
+    if (id == solvers::IpoptSolver::id() || !solvers::GetKnownSolvers().contains(id)) {
+        std::lock_guard<std::mutex> lock(*solver_mutex);
+        solver.Solve(prog, {}, solver_options, result);
+    } else if (solver_is_shared) {
+        solvers::MakeSolver(id)->Solve(prog, {}, solver_options, result);
+    } else {
+        solver.Solve(prog, {}, solver_options, result);
+    }
+}
+
 MathematicalProgramResult Solve(const MathematicalProgram& prog,
                                 const GraphOfConvexSetsOptions& options,
-                                bool preprocessing = false) {
+                                bool preprocessing = false,
+                                std::mutex* solver_mutex = nullptr) {
     MathematicalProgramResult result;
     if (preprocessing && options.preprocessing_solver && options.preprocessing_solver_options) {
         options.preprocessing_solver->Solve(prog, {}, options.preprocessing_solver_options, &result);
     } else if (preprocessing && options.preprocessing_solver && !options.preprocessing_solver_options) {
         options.preprocessing_solver->Solve(prog, {}, options.solver_options, &result);
     } else if (options.solver) {
-        options.solver->Solve(prog, {}, options.solver_options, &result);
+        SolveWith(*options.solver, /* solver_is_shared= */ true, prog, options.solver_options, solver_mutex, &result);
 
         // TODO(wrangelvid): Call the MixedIntegerBranchAndBound solver when
         // asking to solve the MIP without a solver that supports it.
@@ -103,11 +138,41 @@ MathematicalProgramResult Solve(const MathematicalProgram& prog,
                     "GraphOfConvexSetsOptions for more details.");
         }
         DRAKE_DEMAND(solver != nullptr);
-        solver->Solve(prog, {}, options.solver_options, &result);
+        SolveWith(*solver, /* solver_is_shared= */ false, prog, options.solver_options, solver_mutex, &result);
     }
     return result;
 }
 
+/* Adds the decision variables, costs and constraints of `block` to `prog`. */
+void AddBlock(const MathematicalProgram& block, MathematicalProgram* prog) {
+    prog->AddDecisionVariables(block.decision_variables());
+    const auto add_costs = [prog](const auto& bindings) {
+        for (const auto& binding : bindings) {
+            prog->AddCost(binding);
+        }
+    };
+    add_costs(block.linear_costs());
+    add_costs(block.quadratic_costs());
+    add_costs(block.l2norm_costs());
+    add_costs(block.generic_costs());
+    const auto add_constraints = [prog](const auto& bindings) {
+        for (const auto& binding : bindings) {
+            prog->AddConstraint(binding);
+        }
+    };
+    add_constraints(block.bounding_box_constraints());
+    add_constraints(block.linear_equality_constraints());
+    add_constraints(block.linear_constraints());
+    add_constraints(block.quadratic_constraints());
+    add_constraints(block.lorentz_cone_constraints());
+    add_constraints(block.rotated_lorentz_cone_constraints());
+    add_constraints(block.linear_matrix_inequality_constraints());
+    add_constraints(block.positive_semidefinite_constraints());
+    add_constraints(block.exponential_cone_constraints());
+    add_constraints(block.linear_complementarity_constraints());
+    add_constraints(block.generic_constraints());
+}
+
 struct VertexIdComparator {
     bool operator()(const Vertex* lhs, const Vertex* rhs) const { return lhs->id() < rhs->id(); }
 };
@@ -118,6 +183,18 @@ struct EdgeIdComparator {
 
 }  // namespace
 
+/* A piece of a MathematicalProgram that depends on a single vertex or edge. It
+is built once and then added to the programs of SolveShortestPath() or
+SolveConvexRestriction(). */
+struct GraphOfConvexSets::ProgramBlock {
+    // The revision of the vertex or edge that the block was built from.
+    int revision{};
+    MathematicalProgram prog;
+    // For EdgePart::kTail and EdgePart::kHead, the slack of the perspective of
+    // each of the vertex's costs (in the transcription) on this edge.
+    VectorXDecisionVariable ell;
+};
+
 GraphOfConvexSets::~GraphOfConvexSets() = default;
 
 Vertex::Vertex(VertexId id, const ConvexSet& set, std::string name)
@@ -141,6 +218,7 @@ std::pair<Variable, Binding<Cost>> Vertex::AddCost(const Binding<Cost>& binding,
     ell_.conservativeResize(n + 1);
     ell_[n] = Variable(fmt::format("v_ell{}", n), Variable::Type::CONTINUOUS);
     costs_.push_back({binding, use_in_transcription});
+    ++revision_;
     return std::pair<Variable, Binding<Cost>>(ell_[n], binding);
 }
 
@@ -156,6 +234,7 @@ Binding<Constraint> Vertex::AddConstraint(
     DRAKE_THROW_UNLESS(Variables(binding.variables()).IsSubsetOf(Variables(placeholder_x_)));
     DRAKE_THROW_UNLESS(use_in_transcription.size() > 0);
     constraints_.push_back({binding, use_in_transcription});
+    ++revision_;
     return binding;
 }
 
@@ -222,7 +301,8 @@ Edge::Edge(const EdgeId& id, Vertex* u, Vertex* v, std::string name)
       name_(std::move(name)),
       y_{symbolic::MakeVectorContinuousVariable(u_->ambient_dimension(), name_ + "y")},
       z_{symbolic::MakeVectorContinuousVariable(v_->ambient_dimension(), name_ + "z")},
-      x_to_yz_{static_cast<size_t>(y_.size() + z_.size())} {
+      x_to_yz_{static_cast<size_t>(y_.size() + z_.size())},
+      relaxed_phi_{name_ + "phi", symbolic::Variable::Type::CONTINUOUS} {
     DRAKE_DEMAND(u_ != nullptr);
     DRAKE_DEMAND(v_ != nullptr);
     allowed_vars_.insert(Variables(v_->x()));
@@ -249,6 +329,7 @@ std::pair<Variable, Binding<Cost>> Edge::AddCost(const Binding<Cost>& binding,
     ell_.conservativeResize(n + 1);
     ell_[n] = Variable(fmt::format("{}ell{}", name_, n), Variable::Type::CONTINUOUS);
     costs_.push_back({binding, use_in_transcription});
+    ++revision_;
     return std::pair<Variable, Binding<Cost>>(ell_[n], binding);
 }
 
@@ -265,6 +346,7 @@ Binding<Constraint> Edge::AddConstraint(
     DRAKE_THROW_UNLESS(Variables(binding.variables()).IsSubsetOf(allowed_vars_));
     DRAKE_THROW_UNLESS(use_in_transcription.size() > 0);
     constraints_.push_back({binding, use_in_transcription});
+    ++revision_;
     return binding;
 }
 
@@ -459,6 +541,45 @@ std::string GraphOfConvexSets::GetGraphvizString(const std::optional<solvers::Ma
     return graphviz.str();
 }
 
+std::set<EdgeId> GraphOfConvexSets::FindUnreachableEdges(VertexId source_id, VertexId target_id) const {
+    std::set<EdgeId> unreachable_edges;
+    // Every edge could lie on the (empty) path from a vertex to itself.
+    if (source_id == target_id) {
+        return unreachable_edges;
+    }
+    // Searches from `start` along the edges (forward if `forward`), never
+    // leaving `stop`, and returns the vertices reached.
+    const auto search = [](const Vertex* start, const Vertex* stop, bool forward) {
+        std::unordered_set<const Vertex*> reached{start};
+        std::vector<const Vertex*> stack{start};
+        while (!stack.empty()) {
+            const Vertex* v = stack.back();
+            stack.pop_back();
+            if (v == stop) {
+                continue;
+            }
+            for (const Edge* e : forward ? v->outgoing_edges() : v->incoming_edges()) {
+                const Vertex* w = forward ? &e->v() : &e->u();
+                if (reached.insert(w).second) {
+                    stack.push_back(w);
+                }
+            }
+        }
+        return reached;
+    };
+    const Vertex* source = vertices_.at(source_id).get();
+    const Vertex* target = vertices_.at(target_id).get();
+    const std::unordered_set<const Vertex*> from_source = search(source, target, true);
+    const std::unordered_set<const Vertex*> to_target = search(target, source, false);
+    for (const auto& [edge_id, e] : edges_) {
+        if (&e->u() == target || &e->v() == source || !from_source.contains(&e->u()) ||
+            !to_target.contains(&e->v())) {
+            unreachable_edges.insert(edge_id);
+        }
+    }
+    return unreachable_edges;
+}
+
 // Implements the preprocessing scheme put forth in Appendix A.2 of
 // "Motion Planning around Obstacles with Convex Optimization":
 // https://arxiv.org/abs/2205.04422
@@ -474,7 +595,8 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(VertexId source_id,
 
     std::map<VertexId, std::vector<int>> incoming_edges;
     std::map<VertexId, std::vector<int>> outgoing_edges;
-    std::set<EdgeId> unusable_edges;
+    // The edges that the graph search rules out don't need a solve.
+    std::set<EdgeId> unusable_edges = FindUnreachableEdges(source_id, target_id);
 
     int edge_count = 0;
     for (const auto& [edge_id, e] : edges_) {
@@ -814,6 +936,155 @@ void GraphOfConvexSets::AddPerspectiveConstraint(MathematicalProgram* prog,
     }
 }
 
+const GraphOfConvexSets::ProgramBlock& GraphOfConvexSets::GetPerspectiveBlock(const Edge& e,
+                                                                              bool convex_relaxation,
+                                                                              EdgePart part) const {
+    const Vertex* vertex = part == EdgePart::kTail ? &e.u() : part == EdgePart::kHead ? &e.v() : nullptr;
+    const int revision = vertex != nullptr ? vertex->revision_ : e.revision_;
+    std::lock_guard<std::mutex> lock(blocks_mutex_);
+    std::unique_ptr<ProgramBlock>& block = e.perspective_blocks_[PerspectiveBlockIndex(convex_relaxation, part)];
+    if (block != nullptr && block->revision == revision) {
+        return *block;
+    }
+    block = std::make_unique<ProgramBlock>();
+    block->revision = revision;
+    MathematicalProgram& prog = block->prog;
+
+    const auto includes_transcription = [convex_relaxation](const std::unordered_set<Transcription>& transcriptions) {
+        return transcriptions.contains(convex_relaxation ? Transcription::kRelaxation : Transcription::kMIP);
+    };
+    const Variable& phi = convex_relaxation ? e.relaxed_phi_ : e.phi_;
+    prog.AddDecisionVariables(Vector1<Variable>(phi));
+
+    if (part == EdgePart::kEdge) {
+        if (convex_relaxation) {
+            prog.AddBoundingBoxConstraint(0, 1, phi);
+        }
+        prog.AddDecisionVariables(e.y_);
+        prog.AddDecisionVariables(e.z_);
+
+        // Spatial non-negativity: y ∈ ϕX, z ∈ ϕX.
+        if (e.u().ambient_dimension() > 0) {
+            e.u().set().AddPointInNonnegativeScalingConstraints(&prog, e.y_, phi);
+        }
+        if (e.v().ambient_dimension() > 0) {
+            e.v().set().AddPointInNonnegativeScalingConstraints(&prog, e.z_, phi);
+        }
+
+        // Edge costs.
+        for (int i = 0; i < e.ell_.size(); ++i) {
+            const auto& [b, transcriptions] = e.costs_[i];
+            if (includes_transcription(transcriptions)) {
+                prog.AddDecisionVariables(Vector1<Variable>{e.ell_[i]});
+                prog.AddLinearCost(VectorXd::Ones(1), Vector1<Variable>{e.ell_[i]});
+                const VectorXDecisionVariable& old_vars = b.variables();
+                VectorXDecisionVariable vars(old_vars.size() + 2);
+                // vars = [phi; ell; yz_vars]
+                vars[0] = phi;
+                vars[1] = e.ell_[i];
+                for (int j = 0; j < old_vars.size(); ++j) {
+                    vars[j + 2] = e.x_to_yz_.at(old_vars[j]);
+                }
+
+                AddPerspectiveCost(&prog, b, vars);
+            }
+        }
+
+        // Edge constraints.
+        for (const auto& [b, transcriptions] : e.constraints_) {
+            if (includes_transcription(transcriptions)) {
+                const VectorXDecisionVariable& old_vars = b.variables();
+                VectorXDecisionVariable vars(old_vars.size() + 1);
+                // vars = [phi; yz_vars]
+                vars[0] = phi;
+                for (int j = 0; j < old_vars.size(); ++j) {
+                    vars[j + 1] = e.x_to_yz_.at(old_vars[j]);
+                }
+
+                // Note: The use of perspective functions here does not check (nor
+                // assume) that the constraints describe a bounded set.  The boundedness
+                // is ensured by the intersection of these constraints with the convex
+                // sets (on the vertices).
+                AddPerspectiveConstraint(&prog, b, vars);
+            }
+        }
+        return *block;
+    }
+
+    // The vertex's costs and constraints, on y for the tail and z for the head.
+    prog.AddDecisionVariables(part == EdgePart::kTail ? e.y_ : e.z_);
+    int num_active_costs = 0;
+    for (const auto& [b, transcriptions] : vertex->costs_) {
+        if (includes_transcription(transcriptions)) {
+            ++num_active_costs;
+        }
+    }
+    block->ell = prog.NewContinuousVariables(num_active_costs, e.name() + "vertex_ell");
+    if (num_active_costs > 0) {
+        prog.AddLinearCost(VectorXd::Ones(num_active_costs), block->ell);
+    }
+    int active_cost = 0;
+    for (const auto& [b, transcriptions] : vertex->costs_) {
+        if (includes_transcription(transcriptions)) {
+            const VectorXDecisionVariable& old_vars = b.variables();
+            VectorXDecisionVariable vars(old_vars.size() + 2);
+            // vars = [phi; ell; yz_vars]
+            vars[0] = phi;
+            vars[1] = block->ell[active_cost++];
+            for (int kk = 0; kk < old_vars.size(); ++kk) {
+                vars[kk + 2] = e.x_to_yz_.at(old_vars[kk]);
+            }
+
+            AddPerspectiveCost(&prog, b, vars);
+        }
+    }
+    for (const auto& [b, transcriptions] : vertex->constraints_) {
+        if (includes_transcription(transcriptions)) {
+            const VectorXDecisionVariable& old_vars = b.variables();
+            VectorXDecisionVariable vars(old_vars.size() + 1);
+            // vars = [phi; yz_vars]
+            vars[0] = phi;
+            for (int ii = 0; ii < old_vars.size(); ++ii) {
+                vars[ii + 1] = e.x_to_yz_.at(old_vars[ii]);
+            }
+
+            // Note: The use of perspective functions here does not check (nor
+            // assume) that the constraints describe a bounded set.  The
+            // boundedness is ensured by the intersection of these constraints
+            // with the convex sets (on the vertices).
+            AddPerspectiveConstraint(&prog, b, vars);
+        }
+    }
+    return *block;
+}
+
+const GraphOfConvexSets::ProgramBlock& GraphOfConvexSets::GetRestrictionBlock(const Vertex& v) const {
+    std::lock_guard<std::mutex> lock(blocks_mutex_);
+    std::unique_ptr<ProgramBlock>& block = v.restriction_block_;
+    if (block != nullptr && block->revision == v.revision_) {
+        return *block;
+    }
+    block = std::make_unique<ProgramBlock>();
+    block->revision = v.revision_;
+    MathematicalProgram& prog = block->prog;
+    prog.AddDecisionVariables(v.x());
+    v.set().AddPointInSetConstraints(&prog, v.x());
+
+    // Vertex costs.
+    for (const auto& [b, transcriptions] : v.costs_) {
+        if (transcriptions.contains(Transcription::kRestriction)) {
+            prog.AddCost(b);
+        }
+    }
+    // Vertex constraints.
+    for (const auto& [b, transcriptions] : v.constraints_) {
+        if (transcriptions.contains(Transcription::kRestriction)) {
+            prog.AddConstraint(b);
+        }
+    }
+    return *block;
+}
+
 MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         const Vertex& source, const Vertex& target, const GraphOfConvexSetsOptions& specified_options) const {
     VertexId source_id = source.id();
@@ -843,10 +1114,9 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
                 (!*options.convex_relaxation && transcriptions.contains(Transcription::kMIP)));
     };
 
-    std::set<EdgeId> unusable_edges;
-    if (*options.preprocessing) {
-        unusable_edges = PreprocessShortestPath(source_id, target_id, options);
-    }
+    const std::set<EdgeId> unusable_edges = *options.preprocessing
+                                                    ? PreprocessShortestPath(source_id, target_id, options)
+                                                    : FindUnreachableEdges(source_id, target_id);
 
     MathematicalProgram prog;
 
@@ -884,78 +1154,29 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         outgoing_edges[e->u().id()].emplace_back(e.get());
         incoming_edges[e->v().id()].emplace_back(e.get());
 
-        Variable phi;
+        // ϕ, y, z, spatial non-negativity, and the edge costs and constraints.
+        AddBlock(GetPerspectiveBlock(*e, *options.convex_relaxation, EdgePart::kEdge).prog, &prog);
+        const Variable& phi = *options.convex_relaxation ? e->relaxed_phi_ : e->phi_;
         if (*options.convex_relaxation) {
-            phi = prog.NewContinuousVariables<1>(e->name() + "phi")[0];
-            prog.AddBoundingBoxConstraint(0, 1, phi);
             relaxed_phi.emplace(edge_id, phi);
-        } else {
-            phi = e->phi_;
-            prog.AddDecisionVariables(Vector1<Variable>(phi));
         }
         if (e->phi_value_.has_value()) {
             DRAKE_DEMAND(*e->phi_value_);
             double phi_value = *e->phi_value_ ? 1.0 : 0.0;
             prog.AddLinearEqualityConstraint(Vector1d(1.0), phi_value, Vector1<Variable>(phi));
         }
-        prog.AddDecisionVariables(e->y_);
-        prog.AddDecisionVariables(e->z_);
-
-        // Spatial non-negativity: y ∈ ϕX, z ∈ ϕX.
-        if (e->u().ambient_dimension() > 0) {
-            e->u().set().AddPointInNonnegativeScalingConstraints(&prog, e->y_, phi);
-        }
-        if (e->v().ambient_dimension() > 0) {
-            e->v().set().AddPointInNonnegativeScalingConstraints(&prog, e->z_, phi);
-        }
-
-        // Edge costs.
-        for (int i = 0; i < e->ell_.size(); ++i) {
-            const auto& [b, transcriptions] = e->costs_[i];
-            if (IncludesCurrentTranscription(transcriptions)) {
-                prog.AddDecisionVariables(Vector1<Variable>{e->ell_[i]});
-                prog.AddLinearCost(VectorXd::Ones(1), Vector1<Variable>{e->ell_[i]});
-                const VectorXDecisionVariable& old_vars = b.variables();
-                VectorXDecisionVariable vars(old_vars.size() + 2);
-                // vars = [phi; ell; yz_vars]
-                vars[0] = phi;
-                vars[1] = e->ell_[i];
-                for (int j = 0; j < old_vars.size(); ++j) {
-                    vars[j + 2] = e->x_to_yz_.at(old_vars[j]);
-                }
-
-                AddPerspectiveCost(&prog, b, vars);
-            }
-        }
-
-        // Edge constraints.
-        for (const auto& [b, transcriptions] : e->constraints_) {
-            if (IncludesCurrentTranscription(transcriptions)) {
-                const VectorXDecisionVariable& old_vars = b.variables();
-                VectorXDecisionVariable vars(old_vars.size() + 1);
-                // vars = [phi; yz_vars]
-                vars[0] = phi;
-                for (int j = 0; j < old_vars.size(); ++j) {
-                    vars[j + 1] = e->x_to_yz_.at(old_vars[j]);
-                }
-
-                // Note: The use of perspective functions here does not check (nor
-                // assume) that the constraints describe a bounded set.  The boundedness
-                // is ensured by the intersection of these constraints with the convex
-                // sets (on the vertices).
-                AddPerspectiveConstraint(&prog, b, vars);
-            }
-        }
     }
     if (!has_edges_out_of_source) {
         MathematicalProgramResult result;
-        log()->info("Source vertex {} ({}) has no outgoing edges.", source.name(), source_id);
+        log()->info("Source vertex {} ({}) has no outgoing edges{}.", source.name(), source_id,
+                    source.outgoing_edges().empty() ? "" : " that can lie on a path to the target");
         result.set_solution_result(SolutionResult::kInfeasibleConstraints);
         return result;
     }
     if (!has_edges_into_target) {
         MathematicalProgramResult result;
-        log()->info("Target vertex {} ({}) has no incoming edges.", target.name(), target_id);
+        log()->info("Target vertex {} ({}) has no incoming edges{}.", target.name(), target_id,
+                    target.incoming_edges().empty() ? "" : " that can lie on a path from the source");
         result.set_solution_result(SolutionResult::kInfeasibleConstraints);
         return result;
     }
@@ -1048,62 +1269,26 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
             }
         }
 
+        // Vertex costs and constraints, in perspective on each edge out of the
+        // vertex (or into the target).
         const std::vector<Edge*>& cost_edges = is_target ? incoming : outgoing;
-
-        // Vertex costs.
-        if (v->ell_.size() > 0) {
-            for (int ii = 0; ii < v->ell_.size(); ++ii) {
-                const auto& [b, transcriptions] = v->costs_[ii];
-                if (IncludesCurrentTranscription(transcriptions)) {
-                    VectorXDecisionVariable vertex_ell = prog.NewContinuousVariables(cost_edges.size());
-                    vertex_edge_ell[v->id()].push_back(vertex_ell);
-                    const VectorXDecisionVariable& old_vars = b.variables();
-
-                    prog.AddLinearCost(VectorXd::Ones(vertex_ell.size()), vertex_ell);
-
-                    for (int jj = 0; jj < static_cast<int>(cost_edges.size()); ++jj) {
-                        const Edge* e = cost_edges[jj];
-                        VectorXDecisionVariable vars(old_vars.size() + 2);
-                        // vars = [phi; ell; yz_vars]
-                        if (*options.convex_relaxation) {
-                            vars[0] = relaxed_phi.at(e->id());
-                        } else {
-                            vars[0] = e->phi_;
-                        }
-                        vars[1] = vertex_ell[jj];
-                        for (int kk = 0; kk < old_vars.size(); ++kk) {
-                            vars[kk + 2] = e->x_to_yz_.at(old_vars[kk]);
-                        }
-
-                        AddPerspectiveCost(&prog, b, vars);
-                    }
-                }
-            }
+        const EdgePart cost_part = is_target ? EdgePart::kHead : EdgePart::kTail;
+        std::vector<const ProgramBlock*> cost_blocks;
+        cost_blocks.reserve(cost_edges.size());
+        for (const Edge* e : cost_edges) {
+            cost_blocks.push_back(&GetPerspectiveBlock(*e, *options.convex_relaxation, cost_part));
+            AddBlock(cost_blocks.back()->prog, &prog);
         }
-
-        // Vertex constraints.
-        for (const auto& [b, transcriptions] : v->constraints_) {
+        int num_active_costs = 0;
+        for (const auto& [b, transcriptions] : v->costs_) {
             if (IncludesCurrentTranscription(transcriptions)) {
-                const VectorXDecisionVariable& old_vars = b.variables();
-
-                for (const Edge* e : cost_edges) {
-                    VectorXDecisionVariable vars(old_vars.size() + 1);
-                    // vars = [phi; yz_vars]
-                    if (*options.convex_relaxation) {
-                        vars[0] = relaxed_phi.at(e->id());
-                    } else {
-                        vars[0] = e->phi_;
-                    }
-                    for (int ii = 0; ii < old_vars.size(); ++ii) {
-                        vars[ii + 1] = e->x_to_yz_.at(old_vars[ii]);
-                    }
-
-                    // Note: The use of perspective functions here does not check (nor
-                    // assume) that the constraints describe a bounded set.  The
-                    // boundedness is ensured by the intersection of these constraints
-                    // with the convex sets (on the vertices).
-                    AddPerspectiveConstraint(&prog, b, vars);
+                // The vertex cost is the sum of its perspectives on the edges.
+                VectorXDecisionVariable vertex_ell(cost_edges.size());
+                for (int jj = 0; jj < ssize(cost_blocks); ++jj) {
+                    vertex_ell[jj] = cost_blocks[jj]->ell[num_active_costs];
                 }
+                vertex_edge_ell[v->id()].push_back(vertex_ell);
+                ++num_active_costs;
             }
         }
     }
@@ -1221,8 +1406,6 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
             }
         }
         int num_trials = 0;
-        int num_solves = 0;
-        MathematicalProgramResult best_rounded_result;
         while (static_cast<int>(paths.size()) < *options.max_rounded_paths &&
                num_trials < options.max_rounding_trials) {
             ++num_trials;
@@ -1273,11 +1456,32 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
                 continue;
             }
             paths.push_back(new_path);
+        }
 
-            // Optimize path
-            MathematicalProgramResult rounded_result = SolveConvexRestriction(new_path, options, &result);
-            ++num_solves;
+        // Optimize the paths. The sampling above doesn't depend on the solves,
+        // so they can all run concurrently.
+        const int num_solves = ssize(paths);
+        std::vector<MathematicalProgramResult> rounded_results(num_solves);
+        std::vector<std::exception_ptr> errors(num_solves);
+        const int num_threads = options.parallelism.num_threads();
+        std::mutex solver_mutex;
+        const auto solve_restriction = [&](const int, const int64_t i) {
+            try {
+                rounded_results[i] =
+                        DoSolveConvexRestriction(paths[i], options, &result, num_threads > 1 ? &solver_mutex : nullptr);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+        StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_solves,
+                                   solve_restriction, ParallelForBackend::BEST_AVAILABLE);
 
+        MathematicalProgramResult best_rounded_result;
+        for (int i = 0; i < num_solves; ++i) {
+            if (errors[i] != nullptr) {
+                std::rethrow_exception(errors[i]);
+            }
+            const MathematicalProgramResult& rounded_result = rounded_results[i];
             // Check path quality.
             if (rounded_result.is_success() &&
                 (!best_rounded_result.is_success() ||
@@ -1454,6 +1658,14 @@ MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
         const std::vector<const Edge*>& active_edges,
         const GraphOfConvexSetsOptions& options,
         const MathematicalProgramResult* initial_guess) const {
+    return DoSolveConvexRestriction(active_edges, options, initial_guess, nullptr);
+}
+
+MathematicalProgramResult GraphOfConvexSets::DoSolveConvexRestriction(
+        const std::vector<const Edge*>& active_edges,
+        const GraphOfConvexSetsOptions& options,
+        const MathematicalProgramResult* initial_guess,
+        std::mutex* solver_mutex) const {
     // Use the restriction solver and options if they are provided.
     GraphOfConvexSetsOptions restriction_options = options;
     if (restriction_options.restriction_solver) {
@@ -1477,24 +1689,11 @@ MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
         if (v->set().ambient_dimension() == 0) {
             continue;
         }
-        prog.AddDecisionVariables(v->x());
+        // x, the point-in-set constraints, and the vertex costs and constraints.
+        AddBlock(GetRestrictionBlock(*v).prog, &prog);
         if (initial_guess) {
             prog.SetInitialGuess(v->x(), initial_guess->GetSolution(v->x()));
         }
-        v->set().AddPointInSetConstraints(&prog, v->x());
-
-        // Vertex costs.
-        for (const auto& [b, transcriptions] : v->costs_) {
-            if (transcriptions.contains(Transcription::kRestriction)) {
-                prog.AddCost(b);
-            }
-        }
-        // Vertex constraints.
-        for (const auto& [b, transcriptions] : v->constraints_) {
-            if (transcriptions.contains(Transcription::kRestriction)) {
-                prog.AddConstraint(b);
-            }
-        }
     }
 
     for (const auto* e : active_edges) {
@@ -1513,7 +1712,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
     }
 
     RewriteForConvexSolver(&prog);
-    MathematicalProgramResult result = Solve(prog, restriction_options);
+    MathematicalProgramResult result = Solve(prog, restriction_options, /* preprocessing= */ false, solver_mutex);
 
     // TODO(russt): Add the dual variables back in for the rewritten costs.
 
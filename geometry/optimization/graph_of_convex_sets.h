@@ -1,8 +1,10 @@
 #pragma once
 
+#include <array>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -12,6 +14,7 @@
 #include <vector>
 
 #include "common/eigen_types.h"
+#include "common/parallelism.h"
 #include "common/symbolic/expression.h"
 #include "geometry/optimization/convex_set.h"
 #include "solvers/mathematical_program_result.h"
@@ -43,7 +46,11 @@ struct GraphOfConvexSetsOptions {
     Note that this preprocessing is not exact. There may be edges that cannot
     lie on the path from source to target that this does not detect. If
     preprocessing=nullopt, then each GCS method is free to choose an appropriate
-    default. */
+    default.
+
+    Regardless of this option, SolveShortestPath() always removes the edges
+    that can't be reached from the source or can't reach the target, since
+    finding those is a graph search that costs far less than a solve. */
     std::optional<bool> preprocessing{std::nullopt};
 
     /** Maximum number of trials to find a novel path during random rounding. If
@@ -60,6 +67,15 @@ struct GraphOfConvexSetsOptions {
     max_rounded_paths is less than or equal to zero, this option is ignored. */
     int rounding_seed{0};
 
+    /** The number of convex restrictions solved concurrently during random
+    rounding. All of the rounded paths are sampled before any is solved, so the
+    result doesn't depend on the parallelism. Each concurrent solve uses its own
+    instance of the solver; solvers that aren't thread-safe (IPOPT) or that
+    can't be instantiated by id are still run one at a time. If
+    convex_relaxation is false or max_rounded_paths is less than or equal to
+    zero, this option is ignored. */
+    Parallelism parallelism{Parallelism::Max()};
+
     // TODO(#20969) The following solver interfaces may need to be moved to fully
     // serialize the options.
 
@@ -119,6 +135,7 @@ struct GraphOfConvexSetsOptions {
         a->Visit(DRAKE_NVP(rounding_seed));
         // N.B. We skip the DRAKE_NVP(solver), DRAKE_NVP(restriction_solver), and
         // DRAKE_NVP(preprocessing_solver), because it cannot be serialized.
+        // N.B. We skip DRAKE_NVP(parallelism), matching IrisOptions.
         // TODO(#20967) Serialize the DRAKE_NVP(solver_options).
         // TODO(#20967) Serialize the DRAKE_NVP(restriction_solver_options).
         // TODO(#20967) Serialize the DRAKE_NVP(preprocessing_solver_options).
@@ -152,6 +169,13 @@ constraints.  The users should be able to write constraints against
 "placeholder" decision variables on the vertices and edges, but these get
 translated in non-trivial ways to the underlying program.
 
+The parts of those programs that depend only on one vertex or one edge (the
+point-in-set constraints and the perspective forms of the costs and
+constraints) are built on first use and cached, so that repeated solves with
+different sources and targets, e.g. the queries of GcsTrajectoryOptimization on
+a fixed set of regions, only assemble them. Adding a cost or constraint to a
+vertex or edge invalidates its cached parts.
+
 @anchor nonconvex_graph_of_convex_sets
 <b>Advanced Usage: Guiding Non-convex Optimization with the
 %GraphOfConvexSets</b>
@@ -196,6 +220,10 @@ public:
 
     class Edge;  // forward declaration.
 
+private:
+    struct ProgramBlock;  // forward declaration.
+
+public:
     using VertexId = Identifier<class VertexTag>;
     using EdgeId = Identifier<class EdgeTag>;
 
@@ -346,10 +374,17 @@ public:
         solvers::VectorXDecisionVariable ell_{};
         std::vector<std::pair<solvers::Binding<solvers::Cost>, std::unordered_set<Transcription>>> costs_{};
         std::vector<std::pair<solvers::Binding<solvers::Constraint>, std::unordered_set<Transcription>>> constraints_;
+        // Counts the changes to costs_ and constraints_, so that the program
+        // blocks built from them can tell when they are stale.
+        int revision_{0};
 
         std::vector<Edge*> incoming_edges_{};
         std::vector<Edge*> outgoing_edges_{};
 
+        // The cached block of SolveConvexRestriction(): x, the point-in-set
+        // constraints, and the restriction's costs and constraints.
+        mutable std::unique_ptr<ProgramBlock> restriction_block_;
+
         friend class GraphOfConvexSets;
     };
 
@@ -555,6 +590,16 @@ public:
         std::vector<std::pair<solvers::Binding<solvers::Cost>, std::unordered_set<Transcription>>> costs_{};
         std::vector<std::pair<solvers::Binding<solvers::Constraint>, std::unordered_set<Transcription>>> constraints_;
         std::optional<bool> phi_value_{};
+        // Counts the changes to costs_ and constraints_; see Vertex::revision_.
+        int revision_{0};
+        // The continuous ϕ ∈ [0, 1] that replaces phi_ in the convex
+        // relaxation. It is kept with the edge so that the cached perspective
+        // blocks can refer to it.
+        const symbolic::Variable relaxed_phi_{};
+
+        // The cached blocks of SolveShortestPath(), indexed by
+        // PerspectiveBlockIndex().
+        mutable std::array<std::unique_ptr<ProgramBlock>, 6> perspective_blocks_;
 
         friend class GraphOfConvexSets;
     };
@@ -692,6 +737,45 @@ private: /* Facilitates testing. */
                                             VertexId target_id,
                                             const GraphOfConvexSetsOptions& options) const;
 
+    // Returns the edges that can't lie on any path from the source to the
+    // target because the source can't reach their tail or their head can't
+    // reach the target (without passing through the target or the source,
+    // respectively).
+    std::set<EdgeId> FindUnreachableEdges(VertexId source_id, VertexId target_id) const;
+
+    // The parts of the shortest path formulation that depend on one edge (u, v)
+    // only, and are cached on the edge.
+    enum class EdgePart {
+        // ϕ, y, z, the spatial non-negativity constraints y ∈ ϕXᵤ, z ∈ ϕXᵥ, and
+        // the perspective forms of the edge's costs and constraints.
+        kEdge,
+        // The perspective forms of u's costs and constraints, through y. These
+        // are used when u is not the target.
+        kTail,
+        // The perspective forms of v's costs and constraints, through z. These
+        // are used when v is the target.
+        kHead,
+    };
+
+    static int PerspectiveBlockIndex(bool convex_relaxation, EdgePart part) {
+        return 3 * (convex_relaxation ? 1 : 0) + static_cast<int>(part);
+    }
+
+    // Returns the cached `part` of the formulation of edge `e`, building it
+    // first if it is missing or stale. Thread-safe.
+    const ProgramBlock& GetPerspectiveBlock(const Edge& e, bool convex_relaxation, EdgePart part) const;
+
+    // Returns the cached block of vertex `v` in the convex restriction,
+    // building it first if it is missing or stale. Thread-safe.
+    const ProgramBlock& GetRestrictionBlock(const Vertex& v) const;
+
+    // Implements SolveConvexRestriction(). If `solver_mutex` is given, this may
+    // be called concurrently; see SolveShortestPath().
+    solvers::MathematicalProgramResult DoSolveConvexRestriction(const std::vector<const Edge*>& active_edges,
+                                                                const GraphOfConvexSetsOptions& options,
+                                                                const solvers::MathematicalProgramResult* initial_guess,
+                                                                std::mutex* solver_mutex) const;
+
     // Adds a perspective constraint to the mathematical program to upper bound
     // the cost below a slack variable, ℓ. Specifically given a cost g(x) to
     // minimize, this method implements it with a slack variable and a constraint:
@@ -720,6 +804,10 @@ private: /* Facilitates testing. */
     // containers (like std::set or std::map) using their default ordering.
     std::map<VertexId, std::unique_ptr<Vertex>> vertices_{};
     std::map<EdgeId, std::unique_ptr<Edge>> edges_{};
+
+    // Guards the (re)building of the cached program blocks of the vertices and
+    // edges.
+    mutable std::mutex blocks_mutex_;
 };
 
 }  // namespace optimization
@@ -1,7 +1,9 @@
 #include "geometry/optimization/iris.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -9,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include <common_robotics_utilities/parallelism.hpp>
+
 #include "common/symbolic/expression.h"
 #include "geometry/optimization/affine_ball.h"
 #include "geometry/optimization/cartesian_product.h"
@@ -26,6 +30,9 @@ namespace drake {
 namespace geometry {
 namespace optimization {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using Eigen::MatrixXd;
 using Eigen::Ref;
 using Eigen::Vector3d;
@@ -502,7 +509,6 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
     auto pairs = inspector.GetCollisionCandidates();
     const int n = static_cast<int>(pairs.size());
-    auto same_point_constraint = std::make_shared<internal::SamePointConstraint>(&plant, context);
     std::map<std::pair<GeometryId, GeometryId>, std::vector<VectorXd>> counter_examples;
 
     // As a surrogate for the true objective, the pairs are sorted by the distance
@@ -604,6 +610,40 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
     auto solver = solvers::MakeFirstAvailableSolver({solvers::SnoptSolver::id(), solvers::IpoptSolver::id()});
 
+    // The counter-example searches for each collision pair are solved in
+    // batches of up to num_threads concurrent programs. Each thread has its own
+    // solver and SamePointConstraint (which holds a plant context), and its own
+    // program for each collision pair (indexed as in sorted_pairs), which is
+    // built on first use and then updated in place. IPOPT (with MUMPS) is not
+    // thread-safe, so only SNOPT is solved concurrently.
+    int num_threads = options.parallelism.num_threads();
+    if (num_threads > 1 && solver->solver_id() != solvers::SnoptSolver::id()) {
+        log()->debug(
+                "IrisInConfigurationSpace: solving the counter-example programs "
+                "serially because {} is not thread-safe.",
+                solver->solver_id().name());
+        num_threads = 1;
+    }
+    std::vector<std::unique_ptr<solvers::SolverInterface>> thread_solvers;
+    std::vector<std::shared_ptr<internal::SamePointConstraint>> same_point_constraints;
+    for (int thread_num = 0; thread_num < num_threads; ++thread_num) {
+        thread_solvers.push_back(solvers::MakeSolver(solver->solver_id()));
+        same_point_constraints.push_back(std::make_shared<internal::SamePointConstraint>(&plant, context));
+    }
+    struct PooledProgram {
+        std::unique_ptr<internal::ClosestCollisionProgram> prog;
+        // The iteration whose ellipsoid the program's objective was made from.
+        int iteration{-1};
+    };
+    std::vector<std::vector<PooledProgram>> program_pool(num_threads);
+    for (auto& thread_programs : program_pool) {
+        thread_programs.resize(n);
+    }
+    std::vector<VectorXd> batch_guesses;
+    std::vector<int> batch_searches;
+    std::vector<VectorXd> batch_closest;
+    std::vector<uint8_t> batch_found;
+
     VectorXd guess = seed;
 
     // For debugging visualization.
@@ -675,13 +715,10 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
         // Use the fast nonlinear optimizer until it fails
         // num_collision_infeasible_samples consecutive times.
-        for (const auto& pair_w_distance : sorted_pairs) {
+        for (int pair_index = 0; pair_index < n; ++pair_index) {
+            const GeometryPairWithDistance& pair_w_distance = sorted_pairs[pair_index];
             std::pair<GeometryId, GeometryId> geom_pair(pair_w_distance.geomA, pair_w_distance.geomB);
             int consecutive_failures = 0;
-            internal::ClosestCollisionProgram prog(same_point_constraint, *frames.at(pair_w_distance.geomA),
-                                                   *frames.at(pair_w_distance.geomB), *sets.at(pair_w_distance.geomA),
-                                                   *sets.at(pair_w_distance.geomB), E, A.topRows(num_constraints),
-                                                   b.head(num_constraints));
             std::vector<VectorXd> prev_counter_examples = std::move(counter_examples[geom_pair]);
             // Sort by the current ellipsoid metric.
             std::sort(prev_counter_examples.begin(), prev_counter_examples.end(),
@@ -692,57 +729,105 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
             int counter_example_searches_for_this_pair = 0;
             bool warned_many_searches = false;
             while (consecutive_failures < options.num_collision_infeasible_samples) {
-                // First use previous counter-examples for this pair as the seeds.
-                if (counter_example_searches_for_this_pair < ssize(prev_counter_examples)) {
-                    guess = prev_counter_examples[counter_example_searches_for_this_pair];
-                } else {
-                    MakeGuessFeasible(P_candidate, &guess);
-                    guess = P_candidate.UniformSample(&generator, guess, options.mixing_steps);
-                }
-                ++counter_example_searches_for_this_pair;
-                if (do_debugging_visualization) {
-                    ++num_points_drawn;
-                    point_to_draw.head(nq) = guess;
-                    std::string path = fmt::format("iteration{:02}/{:03}/guess", iteration, num_points_drawn);
-                    options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.1, 0.1, 0.1, 1.0));
-                    options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
+                // Draw the guesses for a batch of searches up front (so that they
+                // only depend on the generator), without exceeding the number of
+                // failures that would end the search.
+                const int batch_size =
+                        std::min(num_threads, options.num_collision_infeasible_samples - consecutive_failures);
+                batch_guesses.resize(batch_size);
+                batch_searches.resize(batch_size);
+                batch_closest.resize(batch_size);
+                batch_found.assign(batch_size, 0);
+                for (int k = 0; k < batch_size; ++k) {
+                    // First use previous counter-examples for this pair as the seeds.
+                    if (counter_example_searches_for_this_pair < ssize(prev_counter_examples)) {
+                        guess = prev_counter_examples[counter_example_searches_for_this_pair];
+                    } else {
+                        MakeGuessFeasible(P_candidate, &guess);
+                        guess = P_candidate.UniformSample(&generator, guess, options.mixing_steps);
+                    }
+                    ++counter_example_searches_for_this_pair;
+                    batch_guesses[k] = guess;
+                    batch_searches[k] = counter_example_searches_for_this_pair;
                 }
-                if (prog.Solve(*solver, guess, options.solver_options, &closest)) {
+                const auto search_work = [&](const int thread_num, const int64_t k) {
+                    PooledProgram& pooled = program_pool[thread_num][pair_index];
+                    if (pooled.prog == nullptr) {
+                        pooled.prog = std::make_unique<internal::ClosestCollisionProgram>(
+                                same_point_constraints[thread_num], *frames.at(pair_w_distance.geomA),
+                                *frames.at(pair_w_distance.geomB), *sets.at(pair_w_distance.geomA),
+                                *sets.at(pair_w_distance.geomB), E, A.topRows(num_constraints),
+                                b.head(num_constraints));
+                    } else {
+                        if (pooled.iteration != iteration) {
+                            pooled.prog->UpdateEllipsoid(E);
+                        }
+                        pooled.prog->UpdatePolytope(A.topRows(num_constraints), b.head(num_constraints));
+                    }
+                    pooled.iteration = iteration;
+                    batch_found[k] = static_cast<uint8_t>(pooled.prog->Solve(
+                            *thread_solvers[thread_num], batch_guesses[k], options.solver_options, &batch_closest[k]));
+                };
+                StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, batch_size, search_work,
+                                           ParallelForBackend::BEST_AVAILABLE);
+
+                // Process the results in the order their guesses were drawn.
+                bool polytope_changed = false;
+                for (int k = 0; k < batch_size; ++k) {
                     if (do_debugging_visualization) {
-                        point_to_draw.head(nq) = closest;
-                        std::string path = fmt::format("iteration{:02}/{:03}/found", iteration, num_points_drawn);
-                        options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.8, 0.1, 0.8, 1.0));
+                        ++num_points_drawn;
+                        point_to_draw.head(nq) = batch_guesses[k];
+                        std::string path = fmt::format("iteration{:02}/{:03}/guess", iteration, num_points_drawn);
+                        options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.1, 0.1, 0.1, 1.0));
                         options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
                     }
-                    consecutive_failures = 0;
-                    new_counter_examples.emplace_back(closest);
-                    AddTangentToPolytope(E, closest, options.configuration_space_margin, &A, &b, &num_constraints);
-                    P_candidate = HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
-                    MakeGuessFeasible(P_candidate, &guess);
-                    if (options.require_sample_point_is_contained) {
-                        const bool seed_point_requirement = A.row(num_constraints - 1) * seed <= b(num_constraints - 1);
-                        if (!seed_point_requirement) {
-                            if (iteration == 0) {
-                                throw std::runtime_error(seed_point_error_msg);
+                    if (batch_found[k] > 0) {
+                        closest = batch_closest[k];
+                        // A counter-example from this batch may already have been
+                        // cut off by the hyperplane of an earlier one.
+                        if (polytope_changed && !P_candidate.PointInSet(closest)) {
+                            continue;
+                        }
+                        if (do_debugging_visualization) {
+                            point_to_draw.head(nq) = closest;
+                            std::string path = fmt::format("iteration{:02}/{:03}/found", iteration, num_points_drawn);
+                            options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.8, 0.1, 0.8, 1.0));
+                            options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
+                        }
+                        consecutive_failures = 0;
+                        new_counter_examples.emplace_back(closest);
+                        AddTangentToPolytope(E, closest, options.configuration_space_margin, &A, &b,
+                                             &num_constraints);
+                        P_candidate = HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
+                        polytope_changed = true;
+                        MakeGuessFeasible(P_candidate, &guess);
+                        if (options.require_sample_point_is_contained) {
+                            const bool seed_point_requirement =
+                                    A.row(num_constraints - 1) * seed <= b(num_constraints - 1);
+                            if (!seed_point_requirement) {
+                                if (iteration == 0) {
+                                    throw std::runtime_error(seed_point_error_msg);
+                                }
+                                log()->info(seed_point_msg);
+                                return P;
                             }
-                            log()->info(seed_point_msg);
+                        }
+                        if (CheckTerminate(options, P_candidate, termination_error_msg, termination_msg,
+                                           iteration == 0)) {
                             return P;
                         }
-                    }
-                    if (CheckTerminate(options, P_candidate, termination_error_msg, termination_msg, iteration == 0)) {
-                        return P;
-                    }
-                    prog.UpdatePolytope(A.topRows(num_constraints), b.head(num_constraints));
-                } else {
-                    if (do_debugging_visualization) {
-                        point_to_draw.head(nq) = closest;
-                        std::string path = fmt::format("iteration{:02}/{:03}/closest", iteration, num_points_drawn);
-                        options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.1, 0.8, 0.8, 1.0));
-                        options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
-                    }
-                    if (counter_example_searches_for_this_pair > ssize(counter_examples[geom_pair])) {
-                        // Only count the failures once we start the random guesses.
-                        ++consecutive_failures;
+                    } else {
+                        if (do_debugging_visualization) {
+                            point_to_draw.head(nq) = batch_closest[k];
+                            std::string path =
+                                    fmt::format("iteration{:02}/{:03}/closest", iteration, num_points_drawn);
+                            options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(0.1, 0.8, 0.8, 1.0));
+                            options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
+                        }
+                        if (batch_searches[k] > ssize(counter_examples[geom_pair])) {
+                            // Only count the failures once we start the random guesses.
+                            ++consecutive_failures;
+                        }
                     }
                 }
                 if (!warned_many_searches &&
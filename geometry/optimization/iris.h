@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "common/name_value.h"
+#include "common/parallelism.h"
 #include "geometry/meshcat.h"
 #include "geometry/optimization/convex_set.h"
 #include "geometry/optimization/hpolyhedron.h"
@@ -161,6 +162,16 @@ struct IrisOptions {
 
     /* The SolverOptions used in the optimization program. */
     std::optional<solvers::SolverOptions> solver_options;
+
+    /** For IRIS in configuration space, the number of counter-example programs
+    for a collision pair that are solved concurrently. Each thread keeps its own
+    program for each collision pair, which is built once and then updated in
+    place as the region and ellipsoid change. The initial guesses for a batch of
+    concurrent solves are drawn together, so the counter-examples found (and the
+    resulting region) depend on the number of threads; with no parallelism (the
+    default) the search is serial. Parallel searches require a thread-safe
+    solver (SNOPT); with any other solver, the search is serial. */
+    Parallelism parallelism{};
 };
 
 /** The IRIS (Iterative Region Inflation by Semidefinite programming) algorithm,
@@ -1,6 +1,7 @@
 #include "geometry/optimization/iris_internal.h"
 
 #include <limits>
+#include <utility>
 
 namespace drake {
 namespace geometry {
@@ -10,6 +11,19 @@ namespace internal {
 using Eigen::MatrixXd;
 using Eigen::VectorXd;
 
+namespace {
+
+// Returns the metric CᵀC of the hyperellipsoid E, scaled so that its
+// eigenvalues are close to 1, using scale*lambda_min = 1/scale*lambda_max.
+MatrixXd ScaledEllipsoidMetric(const Hyperellipsoid& E) {
+    const MatrixXd Asq = E.A().transpose() * E.A();
+    Eigen::SelfAdjointEigenSolver<MatrixXd> es(Asq);
+    const double scale = 1.0 / std::sqrt(es.eigenvalues().maxCoeff() * es.eigenvalues().minCoeff());
+    return scale * Asq;
+}
+
+}  // namespace
+
 SamePointConstraint::SamePointConstraint(const multibody::MultibodyPlant<double>* plant,
                                          const systems::Context<double>& context)
     : Constraint(3, plant->num_positions() + 6, Eigen::Vector3d::Zero(), Eigen::Vector3d::Zero()),
@@ -87,27 +101,22 @@ ClosestCollisionProgram::ClosestCollisionProgram(std::shared_ptr<SamePointConstr
                                                  const ConvexSet& setB,
                                                  const Hyperellipsoid& E,
                                                  const Eigen::Ref<const Eigen::MatrixXd>& A,
-                                                 const Eigen::Ref<const Eigen::VectorXd>& b) {
+                                                 const Eigen::Ref<const Eigen::VectorXd>& b)
+    : same_point_constraint_(std::move(same_point_constraint)), frameA_(&frameA), frameB_(&frameB) {
+    DRAKE_DEMAND(same_point_constraint_ != nullptr);
     q_ = prog_.NewContinuousVariables(A.cols(), "q");
 
     P_constraint_ = prog_.AddLinearConstraint(
             A, Eigen::VectorXd::Constant(b.size(), -std::numeric_limits<double>::infinity()), b, q_);
 
-    // Scale the objective so the eigenvalues are close to 1, using
-    // scale*lambda_min = 1/scale*lambda_max.
-    const Eigen::MatrixXd Asq = E.A().transpose() * E.A();
-    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(Asq);
-    const double scale = 1.0 / std::sqrt(es.eigenvalues().maxCoeff() * es.eigenvalues().minCoeff());
-    prog_.AddQuadraticErrorCost(scale * Asq, E.center(), q_);
+    cost_ = prog_.AddQuadraticErrorCost(ScaledEllipsoidMetric(E), E.center(), q_);
 
     auto p_AA = prog_.NewContinuousVariables<3>("p_AA");
     auto p_BB = prog_.NewContinuousVariables<3>("p_BB");
     setA.AddPointInSetConstraints(&prog_, p_AA);
     setB.AddPointInSetConstraints(&prog_, p_BB);
 
-    same_point_constraint->set_frameA(&frameA);
-    same_point_constraint->set_frameB(&frameB);
-    prog_.AddConstraint(same_point_constraint, {q_, p_AA, p_BB});
+    prog_.AddConstraint(same_point_constraint_, {q_, p_AA, p_BB});
 
     // Help nonlinear optimizers (e.g. SNOPT) avoid trivial local minima at the
     // origin.
@@ -121,12 +130,21 @@ void ClosestCollisionProgram::UpdatePolytope(const Eigen::Ref<const Eigen::Matri
             A, VectorXd::Constant(b.size(), -std::numeric_limits<double>::infinity()), b);
 }
 
+void ClosestCollisionProgram::UpdateEllipsoid(const Hyperellipsoid& E) {
+    DRAKE_DEMAND(E.ambient_dimension() == q_.size());
+    const MatrixXd Q = ScaledEllipsoidMetric(E);
+    // Matches MathematicalProgram::AddQuadraticErrorCost().
+    cost_->evaluator()->UpdateCoefficients(2 * Q, -2 * Q * E.center(), E.center().dot(Q * E.center()));
+}
+
 // Returns true iff a collision is found.
 // Sets `closest` to an optimizing solution q*, if a solution is found.
 bool ClosestCollisionProgram::Solve(const solvers::SolverInterface& solver,
                                     const Eigen::Ref<const Eigen::VectorXd>& q_guess,
                                     const std::optional<solvers::SolverOptions>& solver_options,
                                     VectorXd* closest) {
+    same_point_constraint_->set_frameA(frameA_);
+    same_point_constraint_->set_frameB(frameB_);
     prog_.SetInitialGuess(q_, q_guess);
     solvers::MathematicalProgramResult result;
     solver.Solve(prog_, std::nullopt, solver_options, &result);
@@ -57,7 +57,10 @@ private:
  where C, d are the matrix and center from the hyperellipsoid E.
 
  The class design supports repeated solutions of the (nearly) identical
- problem from different initial guesses.
+ problem from different initial guesses, and updating the ellipsoid and the
+ polytope in place between solutions. The `same_point_constraint` may be
+ shared by several programs (its frames are set on each Solve()), as long as
+ they are not solved concurrently.
  */
 class ClosestCollisionProgram {
 public:
@@ -72,6 +75,9 @@ public:
 
     void UpdatePolytope(const Eigen::Ref<const Eigen::MatrixXd>& A, const Eigen::Ref<const Eigen::VectorXd>& b);
 
+    // Replaces the objective with the one given by the hyperellipsoid E.
+    void UpdateEllipsoid(const Hyperellipsoid& E);
+
     // Returns true iff a collision is found.
     // Sets `closest` to an optimizing solution q*, if a solution is found.
     bool Solve(const solvers::SolverInterface& solver,
@@ -80,9 +86,13 @@ public:
                Eigen::VectorXd* closest);
 
 private:
+    std::shared_ptr<SamePointConstraint> same_point_constraint_;
+    const multibody::Frame<double>* const frameA_;
+    const multibody::Frame<double>* const frameB_;
     solvers::MathematicalProgram prog_;
     solvers::VectorXDecisionVariable q_;
     std::optional<solvers::Binding<solvers::LinearConstraint>> P_constraint_{};
+    std::optional<solvers::Binding<solvers::QuadraticCost>> cost_{};
 };
 }  // namespace internal
 }  // namespace optimization
@@ -0,0 +1,323 @@
+#include "geometry/proximity/static_distance_field.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include <common_robotics_utilities/parallelism.hpp>
+#include <fmt/format.h>
+
+#include "common/drake_assert.h"
+#include "common/drake_throw.h"
+#include "common/parallelism.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::Vector3d;
+using Eigen::Vector3i;
+
+namespace {
+
+// Identifies the file format; the trailing digits are its version.
+constexpr char kMagic[8] = {'D', 'R', 'K', 'S', 'D', 'F', '0', '1'};
+
+// The nodes, and whether they are all far or all deep, of one block.
+struct BlockNodes {
+    std::vector<float> distances;
+    std::vector<uint16_t> nearest;
+    bool far{true};
+    bool deep{true};
+};
+
+template <typename U>
+void Write(std::ofstream* out, const U& value) {
+    out->write(reinterpret_cast<const char*>(&value), sizeof(U));
+}
+
+template <typename U>
+bool Read(std::ifstream* in, U* value) {
+    in->read(reinterpret_cast<char*>(value), sizeof(U));
+    return in->good();
+}
+
+template <typename U>
+bool ReadArray(std::ifstream* in, std::vector<U>* values, size_t size) {
+    values->resize(size);
+    in->read(reinterpret_cast<char*>(values->data()), size * sizeof(U));
+    return in->good();
+}
+
+}  // namespace
+
+StaticDistanceField StaticDistanceField::Bake(const Vector3d& lower,
+                                              const Vector3d& upper,
+                                              double resolution,
+                                              double narrow_band,
+                                              const std::vector<Geometry>& geometries,
+                                              const DistanceFunction& distance) {
+    DRAKE_THROW_UNLESS((lower.array() < upper.array()).all());
+    DRAKE_THROW_UNLESS(resolution > 0);
+    DRAKE_THROW_UNLESS(narrow_band > 0);
+    DRAKE_THROW_UNLESS(geometries.size() < std::numeric_limits<uint16_t>::max());
+    DRAKE_THROW_UNLESS(distance != nullptr);
+
+    StaticDistanceField field;
+    field.lower_ = lower;
+    field.upper_ = upper;
+    field.resolution_ = resolution;
+    field.narrow_band_ = narrow_band;
+    field.num_cells_ = ((upper - lower) / resolution).array().ceil().cast<int>().max(1);
+    for (const Geometry& geometry : geometries) {
+        field.descriptions_.push_back(geometry.description);
+    }
+
+    // Nodes farther than this from every geometry can't affect a value within
+    // the narrow band, so their distances are clamped to it.
+    const double cap = narrow_band + std::sqrt(3.0) * resolution;
+    const Vector3i num_blocks = (field.num_cells_.array() + kBlockCells - 1) / kBlockCells;
+    const double block_size = kBlockCells * resolution;
+
+    // The blocks that overlap some geometry's bounding box, inflated by the
+    // cap. Every other block is far.
+    std::set<std::array<int, 3>> candidate_blocks;
+    for (const Geometry& geometry : geometries) {
+        const Vector3d geometry_lower = (geometry.lower.array() - cap).max(lower.array());
+        const Vector3d geometry_upper = (geometry.upper.array() + cap).min(upper.array());
+        if (!(geometry_lower.array() <= geometry_upper.array()).all()) continue;
+        const Vector3i first = ((geometry_lower - lower) / block_size).array().floor().cast<int>().max(0);
+        const Vector3i last = ((geometry_upper - lower) / block_size)
+                                      .array()
+                                      .floor()
+                                      .cast<int>()
+                                      .min(num_blocks.array() - 1);
+        for (int bx = first.x(); bx <= last.x(); ++bx) {
+            for (int by = first.y(); by <= last.y(); ++by) {
+                for (int bz = first.z(); bz <= last.z(); ++bz) {
+                    candidate_blocks.insert({bx, by, bz});
+                }
+            }
+        }
+    }
+    const std::vector<std::array<int, 3>> blocks(candidate_blocks.begin(), candidate_blocks.end());
+
+    // Sample the nodes of the candidate blocks in parallel.
+    std::vector<BlockNodes> block_nodes(blocks.size());
+    const auto bake_block = [&](const int, const int64_t b) {
+        const Vector3i first_node = Eigen::Map<const Vector3i>(blocks[b].data()) * kBlockCells;
+        const Vector3d block_lower = lower + first_node.cast<double>() * resolution;
+        const Vector3d block_upper = block_lower + Vector3d::Constant(block_size);
+        std::vector<int> nearby;
+        for (int g = 0; g < static_cast<int>(geometries.size()); ++g) {
+            if ((geometries[g].lower.array() - cap <= block_upper.array()).all() &&
+                (geometries[g].upper.array() + cap >= block_lower.array()).all()) {
+                nearby.push_back(g);
+            }
+        }
+        BlockNodes& nodes = block_nodes[b];
+        nodes.distances.resize(kNodesPerBlock);
+        nodes.nearest.resize(kNodesPerBlock);
+        for (int i = 0; i < kBlockNodes; ++i) {
+            for (int j = 0; j < kBlockNodes; ++j) {
+                for (int k = 0; k < kBlockNodes; ++k) {
+                    const Vector3d p_WQ = block_lower + Vector3d(i, j, k) * resolution;
+                    double nearest_distance = cap;
+                    int nearest_geometry = nearby.empty() ? 0 : nearby[0];
+                    for (const int g : nearby) {
+                        const double d = distance(g, p_WQ);
+                        if (d < nearest_distance) {
+                            nearest_distance = d;
+                            nearest_geometry = g;
+                        }
+                    }
+                    const int n = NodeIndex(i, j, k);
+                    nodes.distances[n] = static_cast<float>(nearest_distance);
+                    nodes.nearest[n] = static_cast<uint16_t>(nearest_geometry);
+                    nodes.far = nodes.far && nearest_distance >= narrow_band;
+                    nodes.deep = nodes.deep && nearest_distance <= -narrow_band;
+                }
+            }
+        }
+    };
+    StaticParallelForIndexLoop(DegreeOfParallelism(Parallelism::Max().num_threads()), 0, ssize(blocks), bake_block,
+                               ParallelForBackend::BEST_AVAILABLE);
+
+    for (int b = 0; b < ssize(blocks); ++b) {
+        const int64_t key = BlockKey(blocks[b][0], blocks[b][1], blocks[b][2]);
+        BlockNodes& nodes = block_nodes[b];
+        if (nodes.far) continue;
+        if (nodes.deep) {
+            field.deep_blocks_.insert(key);
+            continue;
+        }
+        field.block_indices_.emplace(key, field.num_blocks());
+        field.distances_.insert(field.distances_.end(), nodes.distances.begin(), nodes.distances.end());
+        field.nearest_.insert(field.nearest_.end(), nodes.nearest.begin(), nodes.nearest.end());
+        nodes = {};
+    }
+    return field;
+}
+
+std::optional<StaticDistanceField> StaticDistanceField::Load(const std::filesystem::path& filename,
+                                                             const Vector3d& lower,
+                                                             const Vector3d& upper,
+                                                             double resolution,
+                                                             double narrow_band,
+                                                             const std::vector<std::string>& descriptions) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) return std::nullopt;
+
+    char magic[sizeof(kMagic)];
+    in.read(magic, sizeof(magic));
+    if (!in.good() || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) return std::nullopt;
+
+    StaticDistanceField field;
+    for (int i = 0; i < 3; ++i) {
+        if (!Read(&in, &field.lower_[i]) || !Read(&in, &field.upper_[i])) return std::nullopt;
+    }
+    if (!Read(&in, &field.resolution_) || !Read(&in, &field.narrow_band_)) return std::nullopt;
+    if (field.lower_ != lower || field.upper_ != upper || field.resolution_ != resolution ||
+        field.narrow_band_ != narrow_band) {
+        return std::nullopt;
+    }
+    field.num_cells_ = ((upper - lower) / resolution).array().ceil().cast<int>().max(1);
+
+    uint32_t num_geometries{};
+    if (!Read(&in, &num_geometries) || num_geometries != descriptions.size()) return std::nullopt;
+    for (uint32_t g = 0; g < num_geometries; ++g) {
+        uint32_t size{};
+        if (!Read(&in, &size) || size != descriptions[g].size()) return std::nullopt;
+        std::string description(size, '\0');
+        in.read(description.data(), size);
+        if (!in.good() || description != descriptions[g]) return std::nullopt;
+        field.descriptions_.push_back(std::move(description));
+    }
+
+    uint64_t num_blocks{};
+    if (!Read(&in, &num_blocks)) return std::nullopt;
+    std::vector<int64_t> keys;
+    if (!ReadArray(&in, &keys, num_blocks)) return std::nullopt;
+    if (!ReadArray(&in, &field.distances_, num_blocks * kNodesPerBlock)) return std::nullopt;
+    if (!ReadArray(&in, &field.nearest_, num_blocks * kNodesPerBlock)) return std::nullopt;
+    for (uint64_t b = 0; b < num_blocks; ++b) {
+        field.block_indices_.emplace(keys[b], static_cast<int>(b));
+    }
+    for (const uint16_t nearest : field.nearest_) {
+        if (nearest >= num_geometries) return std::nullopt;
+    }
+
+    uint64_t num_deep_blocks{};
+    if (!Read(&in, &num_deep_blocks)) return std::nullopt;
+    std::vector<int64_t> deep_keys;
+    if (!ReadArray(&in, &deep_keys, num_deep_blocks)) return std::nullopt;
+    field.deep_blocks_.insert(deep_keys.begin(), deep_keys.end());
+    return field;
+}
+
+void StaticDistanceField::Save(const std::filesystem::path& filename) const {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error(fmt::format("StaticDistanceField: cannot write to '{}'.", filename.string()));
+    }
+    out.write(kMagic, sizeof(kMagic));
+    for (int i = 0; i < 3; ++i) {
+        Write(&out, lower_[i]);
+        Write(&out, upper_[i]);
+    }
+    Write(&out, resolution_);
+    Write(&out, narrow_band_);
+    Write(&out, static_cast<uint32_t>(descriptions_.size()));
+    for (const std::string& description : descriptions_) {
+        Write(&out, static_cast<uint32_t>(description.size()));
+        out.write(description.data(), description.size());
+    }
+
+    // Write the blocks in the order of their nodes.
+    std::vector<int64_t> keys(block_indices_.size());
+    for (const auto& [key, index] : block_indices_) {
+        keys[index] = key;
+    }
+    Write(&out, static_cast<uint64_t>(keys.size()));
+    out.write(reinterpret_cast<const char*>(keys.data()), keys.size() * sizeof(int64_t));
+    out.write(reinterpret_cast<const char*>(distances_.data()), distances_.size() * sizeof(float));
+    out.write(reinterpret_cast<const char*>(nearest_.data()), nearest_.size() * sizeof(uint16_t));
+
+    const std::vector<int64_t> deep_keys(deep_blocks_.begin(), deep_blocks_.end());
+    Write(&out, static_cast<uint64_t>(deep_keys.size()));
+    out.write(reinterpret_cast<const char*>(deep_keys.data()), deep_keys.size() * sizeof(int64_t));
+    if (!out.good()) {
+        throw std::runtime_error(fmt::format("StaticDistanceField: failed to write '{}'.", filename.string()));
+    }
+}
+
+std::optional<StaticDistanceField::Value> StaticDistanceField::Evaluate(const Vector3d& p_WQ) const {
+    if (!((p_WQ.array() >= lower_.array()).all() && (p_WQ.array() <= upper_.array()).all())) {
+        return std::nullopt;
+    }
+    const Vector3d cell_coordinates = (p_WQ - lower_) / resolution_;
+    const Vector3i cell = cell_coordinates.array().floor().cast<int>().min(num_cells_.array() - 1);
+    const Vector3d fraction = cell_coordinates - cell.cast<double>();
+    const Vector3i block = cell / kBlockCells;
+    const int64_t key = BlockKey(block.x(), block.y(), block.z());
+
+    const auto iter = block_indices_.find(key);
+    if (iter == block_indices_.end()) {
+        if (deep_blocks_.contains(key)) return std::nullopt;
+        return Value{narrow_band_, Vector3d::Zero(), -1};
+    }
+
+    const Vector3i local = cell - block * kBlockCells;
+    const float* const distances = distances_.data() + static_cast<int64_t>(iter->second) * kNodesPerBlock;
+    // The values at the cell's corners, indexed by their offsets (x, y, z).
+    double v[2][2][2];
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            for (int k = 0; k < 2; ++k) {
+                v[i][j][k] = distances[NodeIndex(local.x() + i, local.y() + j, local.z() + k)];
+            }
+        }
+    }
+    const double x = fraction.x();
+    const double y = fraction.y();
+    const double z = fraction.z();
+    // Interpolate along z, then y, then x.
+    const double v00 = v[0][0][0] * (1 - z) + v[0][0][1] * z;
+    const double v01 = v[0][1][0] * (1 - z) + v[0][1][1] * z;
+    const double v10 = v[1][0][0] * (1 - z) + v[1][0][1] * z;
+    const double v11 = v[1][1][0] * (1 - z) + v[1][1][1] * z;
+    const double v0 = v00 * (1 - y) + v01 * y;
+    const double v1 = v10 * (1 - y) + v11 * y;
+    const double value = v0 * (1 - x) + v1 * x;
+    if (value >= narrow_band_) {
+        return Value{narrow_band_, Vector3d::Zero(), -1};
+    }
+
+    const double dz00 = v[0][0][1] - v[0][0][0];
+    const double dz01 = v[0][1][1] - v[0][1][0];
+    const double dz10 = v[1][0][1] - v[1][0][0];
+    const double dz11 = v[1][1][1] - v[1][1][0];
+    Vector3d grad_W(v1 - v0, (v01 - v00) * (1 - x) + (v11 - v10) * x,
+                    (dz00 * (1 - y) + dz01 * y) * (1 - x) + (dz10 * (1 - y) + dz11 * y) * x);
+    const double norm = grad_W.norm();
+    if (!(norm > 0)) return std::nullopt;
+    grad_W /= norm;
+
+    const Vector3i nearest_node = local + (fraction.array() >= 0.5).cast<int>().matrix();
+    const int geometry = nearest_[static_cast<int64_t>(iter->second) * kNodesPerBlock +
+                                  NodeIndex(nearest_node.x(), nearest_node.y(), nearest_node.z())];
+    return Value{value, grad_W, geometry};
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
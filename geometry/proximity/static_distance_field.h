@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/drake_copyable.h"
+#include "common/eigen_types.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A sparse, narrow-band signed distance field of a fixed set of geometries,
+ sampled on a regular grid of nodes over an axis-aligned box of the world.
+
+ The grid is stored in blocks of kBlockCells³ cells (with (kBlockCells + 1)³
+ nodes, so that every cell lies within a single block). Only the blocks within
+ the narrow band of some geometry's surface are stored; every other point of
+ the box is either _far_ (at least the narrow band's width away from all of the
+ geometries) or _deep_ (inside a geometry, at least the band's width from its
+ surface).
+
+ Within the band, the distance at a point is the trilinear interpolation of its
+ cell's nodes, and its gradient is the (normalized) gradient of that
+ interpolant. The error of the interpolated distance is at most about the
+ cell's diagonal, and much less for geometry that is flat at the scale of the
+ cell. Each node also records the geometry nearest to it.
+
+ The geometries are identified by their indices in the list of descriptions
+ given to Bake(). The descriptions are saved with the field, so that Load() can
+ tell whether a saved field was baked from the same geometry. */
+class StaticDistanceField {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(StaticDistanceField);
+
+    /* The number of cells along each edge of a block. */
+    static constexpr int kBlockCells = 8;
+
+    /* A geometry to bake into the field. */
+    struct Geometry {
+        /* A description of the geometry's shape and pose that is stable across
+         processes. Two geometries with the same description are assumed to be
+         identical. */
+        std::string description;
+        /* The corners of the geometry's axis-aligned bounding box in the world
+         frame, which may be infinite. */
+        Vector3<double> lower;
+        Vector3<double> upper;
+    };
+
+    /* Computes the signed distance from the point p_WQ to the geometry with the
+     given index. It is called concurrently from multiple threads. */
+    using DistanceFunction = std::function<double(int geometry, const Vector3<double>& p_WQ)>;
+
+    /* The field's value at a point. */
+    struct Value {
+        /* The (interpolated) signed distance. For a far point, this is the
+         narrow band's width, a lower bound on the distance. */
+        double distance{};
+        /* The unit gradient of the distance, expressed in the world frame; zero
+         for a far point. */
+        Vector3<double> grad_W;
+        /* The index of the geometry nearest to the point, or -1 for a far
+         point. */
+        int geometry{-1};
+    };
+
+    /* Bakes a field over the box [lower, upper] with the given node spacing
+     `resolution` and band width `narrow_band`, using `distance` to sample the
+     signed distance to each of the `geometries`.
+     @throws std::exception if the box is empty, `resolution` or `narrow_band`
+     aren't positive, or there are 65535 or more geometries. */
+    static StaticDistanceField Bake(const Vector3<double>& lower,
+                                    const Vector3<double>& upper,
+                                    double resolution,
+                                    double narrow_band,
+                                    const std::vector<Geometry>& geometries,
+                                    const DistanceFunction& distance);
+
+    /* Loads a field saved by Save(). Returns nullopt if the file doesn't exist,
+     can't be read, or wasn't baked with the given box, resolution, narrow band,
+     and geometry descriptions (in the same order). */
+    static std::optional<StaticDistanceField> Load(const std::filesystem::path& filename,
+                                                   const Vector3<double>& lower,
+                                                   const Vector3<double>& upper,
+                                                   double resolution,
+                                                   double narrow_band,
+                                                   const std::vector<std::string>& descriptions);
+
+    /* Saves the field to a binary file, which is only meant to be read by Load()
+     on a machine of the same endianness.
+     @throws std::exception if the file can't be written. */
+    void Save(const std::filesystem::path& filename) const;
+
+    /* Evaluates the field at the point p_WQ. Returns nullopt if the point is
+     outside of the field's box or deep inside a geometry, or if the gradient
+     vanishes there; in those cases, the caller must compute the distance some
+     other way. */
+    std::optional<Value> Evaluate(const Vector3<double>& p_WQ) const;
+
+    double resolution() const { return resolution_; }
+
+    double narrow_band() const { return narrow_band_; }
+
+    int num_blocks() const { return static_cast<int>(block_indices_.size()); }
+
+    const std::vector<std::string>& descriptions() const { return descriptions_; }
+
+private:
+    StaticDistanceField() = default;
+
+    static constexpr int kBlockNodes = kBlockCells + 1;
+    static constexpr int kNodesPerBlock = kBlockNodes * kBlockNodes * kBlockNodes;
+
+    // Packs block coordinates into a key.
+    static int64_t BlockKey(int bx, int by, int bz) {
+        return (static_cast<int64_t>(bx) << 42) | (static_cast<int64_t>(by) << 21) | static_cast<int64_t>(bz);
+    }
+
+    // The index of a node within its block.
+    static int NodeIndex(int i, int j, int k) { return (i * kBlockNodes + j) * kBlockNodes + k; }
+
+    Vector3<double> lower_;
+    Vector3<double> upper_;
+    double resolution_{};
+    double narrow_band_{};
+    // The number of cells along each axis.
+    Eigen::Vector3i num_cells_;
+    std::vector<std::string> descriptions_;
+
+    // The index of each stored block in the node arrays, keyed by BlockKey().
+    std::unordered_map<int64_t, int> block_indices_;
+    // The signed distances and nearest geometries of the nodes of the stored
+    // blocks, kNodesPerBlock per block.
+    std::vector<float> distances_;
+    std::vector<uint16_t> nearest_;
+    // The keys of the blocks deep inside geometry.
+    std::unordered_set<int64_t> deep_blocks_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
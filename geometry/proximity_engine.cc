@@ -1,8 +1,10 @@
 #include "geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <limits>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -15,6 +17,7 @@
 
 #include "common/default_scalars.h"
 #include "common/eigen_types.h"
+#include "common/text_logging.h"
 #include "geometry/geometry_ids.h"
 #include "geometry/proximity/collisions_exist_callback.h"
 #include "geometry/proximity/deformable_contact_geometries.h"
@@ -27,6 +30,7 @@
 #include "geometry/proximity/make_mesh_from_vtk.h"
 #include "geometry/proximity/obj_to_surface_mesh.h"
 #include "geometry/proximity/penetration_as_point_pair_callback.h"
+#include "geometry/proximity/static_distance_field.h"
 #include "geometry/proximity/volume_to_surface_mesh.h"
 #include "geometry/proximity/vtk_to_volume_mesh.h"
 #include "geometry/read_obj.h"
@@ -193,6 +197,195 @@ bool OrderContactSurface(const ContactSurface<T>& s1, const ContactSurface<T>& s
     return s1.id_N() < s2.id_N();
 }
 
+// The points sampled from a dynamic geometry G for queries against the static
+// distance field. Each is the center of a sphere of the given radius, and the
+// geometry is the union of the spheres (approximately, for a zero radius).
+struct GeometrySamples {
+    Eigen::Matrix3Xd p_GQs;
+    double radius{};
+    // True if the points lie on G's surface, rather than on its medial axis;
+    // such points can't tell that G encloses another geometry.
+    bool on_surface{};
+};
+
+// Appends points spaced at most `spacing` apart over the parallelogram
+// p_GO + s·u + t·v, for s and t in [0, 1].
+void SampleParallelogram(
+        const Vector3d& p_GO, const Vector3d& u, const Vector3d& v, double spacing, std::vector<Vector3d>* points) {
+    const int nu = std::max(1, static_cast<int>(std::ceil(u.norm() / spacing)));
+    const int nv = std::max(1, static_cast<int>(std::ceil(v.norm() / spacing)));
+    for (int i = 0; i <= nu; ++i) {
+        for (int j = 0; j <= nv; ++j) {
+            points->push_back(p_GO + (static_cast<double>(i) / nu) * u + (static_cast<double>(j) / nv) * v);
+        }
+    }
+}
+
+// Appends points spaced at most `spacing` apart over the triangle abc.
+void SampleTriangle(
+        const Vector3d& a, const Vector3d& b, const Vector3d& c, double spacing, std::vector<Vector3d>* points) {
+    const double longest = std::max({(b - a).norm(), (c - b).norm(), (a - c).norm()});
+    const int n = std::max(1, static_cast<int>(std::ceil(longest / spacing)));
+    for (int i = 0; i <= n; ++i) {
+        for (int j = 0; i + j <= n; ++j) {
+            points->push_back(a + (static_cast<double>(i) / n) * (b - a) + (static_cast<double>(j) / n) * (c - a));
+        }
+    }
+}
+
+// Appends points spaced at most `spacing` apart around the circle of the given
+// radius about the z axis at height z (or its center, for a zero radius).
+void SampleCircle(double radius, double z, double spacing, std::vector<Vector3d>* points) {
+    const int n = std::max(radius > 0 ? 3 : 1, static_cast<int>(std::ceil(2 * M_PI * radius / spacing)));
+    for (int i = 0; i < n; ++i) {
+        const double theta = 2 * M_PI * i / n;
+        points->emplace_back(radius * std::cos(theta), radius * std::sin(theta), z);
+    }
+}
+
+// Samples the given fcl geometry for the static distance field; returns
+// nullopt for geometry that can't be sampled (half spaces).
+std::optional<GeometrySamples> SampleFclGeometry(const fcl::CollisionGeometryd& geometry, double spacing) {
+    std::vector<Vector3d> points;
+    double radius = 0;
+    switch (geometry.getNodeType()) {
+        case fcl::GEOM_SPHERE: {
+            radius = dynamic_cast<const fcl::Sphered&>(geometry).radius;
+            points.push_back(Vector3d::Zero());
+            break;
+        }
+        case fcl::GEOM_CAPSULE: {
+            const auto& capsule = dynamic_cast<const fcl::Capsuled&>(geometry);
+            radius = capsule.radius;
+            const int n = std::max(1, static_cast<int>(std::ceil(capsule.lz / spacing)));
+            for (int i = 0; i <= n; ++i) {
+                points.emplace_back(0, 0, capsule.lz * (static_cast<double>(i) / n - 0.5));
+            }
+            break;
+        }
+        case fcl::GEOM_BOX: {
+            const Vector3d& size = dynamic_cast<const fcl::Boxd&>(geometry).side;
+            const Vector3d half = size / 2;
+            for (int axis = 0; axis < 3; ++axis) {
+                const Vector3d u = size[(axis + 1) % 3] * Vector3d::Unit((axis + 1) % 3);
+                const Vector3d v = size[(axis + 2) % 3] * Vector3d::Unit((axis + 2) % 3);
+                for (const double sign : {-1.0, 1.0}) {
+                    const Vector3d p_GO = -half + (sign > 0 ? size[axis] : 0.0) * Vector3d::Unit(axis);
+                    SampleParallelogram(p_GO, u, v, spacing, &points);
+                }
+            }
+            break;
+        }
+        case fcl::GEOM_CYLINDER: {
+            const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
+            const int num_rings = std::max(1, static_cast<int>(std::ceil(cylinder.lz / spacing)));
+            for (int i = 0; i <= num_rings; ++i) {
+                SampleCircle(cylinder.radius, cylinder.lz * (static_cast<double>(i) / num_rings - 0.5), spacing,
+                             &points);
+            }
+            const int num_radii = std::max(1, static_cast<int>(std::ceil(cylinder.radius / spacing)));
+            for (int i = 0; i < num_radii; ++i) {
+                for (const double sign : {-1.0, 1.0}) {
+                    SampleCircle(cylinder.radius * i / num_radii, sign * cylinder.lz / 2, spacing, &points);
+                }
+            }
+            break;
+        }
+        case fcl::GEOM_ELLIPSOID: {
+            const Vector3d& radii = dynamic_cast<const fcl::Ellipsoidd&>(geometry).radii;
+            const int num_rings = std::max(2, static_cast<int>(std::ceil(M_PI * radii.maxCoeff() / spacing)));
+            for (int i = 0; i <= num_rings; ++i) {
+                const double phi = M_PI * i / num_rings;
+                const int first = ssize(points);
+                SampleCircle(std::sin(phi) * radii.head<2>().maxCoeff(), std::cos(phi) * radii.z(), spacing, &points);
+                for (int k = first; k < ssize(points); ++k) {
+                    // Map the circle onto the ellipse of this latitude.
+                    const double theta = std::atan2(points[k].y(), points[k].x());
+                    points[k] = Vector3d(radii.x() * std::sin(phi) * std::cos(theta),
+                                         radii.y() * std::sin(phi) * std::sin(theta), points[k].z());
+                }
+            }
+            break;
+        }
+        case fcl::GEOM_CONVEX: {
+            const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
+            const std::vector<Vector3d>& vertices = convex.getVertices();
+            const std::vector<int>& faces = convex.getFaces();
+            // The faces are encoded as a vertex count followed by the vertex
+            // indices; each is sampled as a fan of triangles.
+            for (int f = 0, i = 0; f < convex.getFaceCount(); ++f) {
+                const int count = faces[i];
+                for (int k = 2; k < count; ++k) {
+                    SampleTriangle(vertices[faces[i + 1]], vertices[faces[i + k]], vertices[faces[i + k + 1]],
+                                   spacing, &points);
+                }
+                i += count + 1;
+            }
+            break;
+        }
+        default:
+            return std::nullopt;
+    }
+    GeometrySamples samples;
+    samples.radius = radius;
+    samples.on_surface = geometry.getNodeType() != fcl::GEOM_SPHERE && geometry.getNodeType() != fcl::GEOM_CAPSULE;
+    samples.p_GQs.resize(3, ssize(points));
+    for (int i = 0; i < ssize(points); ++i) {
+        samples.p_GQs.col(i) = points[i];
+    }
+    return samples;
+}
+
+// Describes an anchored fcl object's shape and pose exactly, independently of
+// its id, so that a saved static distance field can be matched to it.
+std::string DescribeFclObject(const CollisionObjectd& object) {
+    const fcl::CollisionGeometryd& geometry = *object.collisionGeometry();
+    std::string shape;
+    switch (geometry.getNodeType()) {
+        case fcl::GEOM_SPHERE:
+            shape = fmt::format("Sphere({})", dynamic_cast<const fcl::Sphered&>(geometry).radius);
+            break;
+        case fcl::GEOM_CAPSULE: {
+            const auto& capsule = dynamic_cast<const fcl::Capsuled&>(geometry);
+            shape = fmt::format("Capsule({}, {})", capsule.radius, capsule.lz);
+            break;
+        }
+        case fcl::GEOM_BOX: {
+            const Vector3d& size = dynamic_cast<const fcl::Boxd&>(geometry).side;
+            shape = fmt::format("Box({}, {}, {})", size.x(), size.y(), size.z());
+            break;
+        }
+        case fcl::GEOM_CYLINDER: {
+            const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
+            shape = fmt::format("Cylinder({}, {})", cylinder.radius, cylinder.lz);
+            break;
+        }
+        case fcl::GEOM_ELLIPSOID: {
+            const Vector3d& radii = dynamic_cast<const fcl::Ellipsoidd&>(geometry).radii;
+            shape = fmt::format("Ellipsoid({}, {}, {})", radii.x(), radii.y(), radii.z());
+            break;
+        }
+        case fcl::GEOM_CONVEX: {
+            // A convex hull is identified by a (FNV-1a) hash of its data.
+            const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
+            uint64_t hash = 14695981039346656037ULL;
+            const auto hash_bytes = [&hash](const void* data, size_t size) {
+                for (size_t i = 0; i < size; ++i) {
+                    hash = (hash ^ static_cast<const unsigned char*>(data)[i]) * 1099511628211ULL;
+                }
+            };
+            hash_bytes(convex.getVertices().data(), convex.getVertices().size() * sizeof(Vector3d));
+            hash_bytes(convex.getFaces().data(), convex.getFaces().size() * sizeof(int));
+            shape = fmt::format("Convex({}, {}, {:016x})", convex.getVertices().size(), convex.getFaceCount(), hash);
+            break;
+        }
+        default:
+            shape = GetGeometryName(object);
+    }
+    const Eigen::Matrix<double, 3, 4> X_WG = object.getTransform().matrix().topRows<3>();
+    return fmt::format("{} [{}]", shape, fmt::join(X_WG.data(), X_WG.data() + X_WG.size(), ", "));
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -221,6 +414,12 @@ public:
         BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
         collision_filter_ = other.collision_filter_;
+
+        static_distance_field_ = other.static_distance_field_;
+        static_distance_field_config_ = other.static_distance_field_config_;
+        static_distance_field_ids_ = other.static_distance_field_ids_;
+        static_distance_field_aabbs_ = other.static_distance_field_aabbs_;
+        dynamic_geometry_samples_ = other.dynamic_geometry_samples_;
     }
 
     // Only the copy constructor is used to facilitate copying of the parent
@@ -251,6 +450,12 @@ public:
         engine->geometries_for_deformable_contact_ = this->geometries_for_deformable_contact_;
         engine->distance_tolerance_ = this->distance_tolerance_;
 
+        engine->static_distance_field_ = this->static_distance_field_;
+        engine->static_distance_field_config_ = this->static_distance_field_config_;
+        engine->static_distance_field_ids_ = this->static_distance_field_ids_;
+        engine->static_distance_field_aabbs_ = this->static_distance_field_aabbs_;
+        engine->dynamic_geometry_samples_ = this->dynamic_geometry_samples_;
+
         return engine;
     }
 
@@ -261,6 +466,9 @@ public:
                             GeometryId id,
                             const ProximityProperties& props) {
         AddGeometry(shape, X_WG, id, props, true, &dynamic_tree_, &dynamic_objects_);
+        if (static_distance_field_ != nullptr) {
+            MaybeSampleDynamicGeometry(id);
+        }
     }
 
     void AddAnchoredGeometry(const Shape& shape,
@@ -268,6 +476,7 @@ public:
                              GeometryId id,
                              const ProximityProperties& props) {
         AddGeometry(shape, X_WG, id, props, false, &anchored_tree_, &anchored_objects_);
+        DiscardStaticDistanceField();
     }
 
     void AddDeformableGeometry(const VolumeMesh<double>& mesh_W, GeometryId id) {
@@ -341,8 +550,10 @@ public:
     void RemoveGeometry(GeometryId id, bool is_dynamic) {
         if (is_dynamic) {
             RemoveGeometry(id, &dynamic_tree_, &dynamic_objects_);
+            dynamic_geometry_samples_.erase(id);
         } else {
             RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
+            DiscardStaticDistanceField();
         }
         hydroelastic_geometries_.RemoveGeometry(id);
         geometries_for_deformable_contact_.RemoveGeometry(id);
@@ -369,6 +580,75 @@ public:
 
     double distance_tolerance() const { return distance_tolerance_; }
 
+    void BakeStaticDistanceField(const StaticDistanceFieldConfig& config) {
+        config.ValidateOrThrow();
+
+        // The geometries are ordered by their descriptions, so that a saved field
+        // matches the same geometry registered with different ids.
+        std::vector<std::pair<std::string, GeometryId>> described;
+        for (const auto& [id, object] : anchored_objects_) {
+            described.emplace_back(DescribeFclObject(*object), id);
+        }
+        std::sort(described.begin(), described.end());
+        std::vector<StaticDistanceField::Geometry> geometries;
+        std::vector<std::string> descriptions;
+        std::vector<GeometryId> ids;
+        std::vector<const CollisionObjectd*> objects;
+        for (const auto& [description, id] : described) {
+            const CollisionObjectd* object = anchored_objects_.at(id).get();
+            geometries.push_back({description, object->getAABB().min_, object->getAABB().max_});
+            descriptions.push_back(description);
+            ids.push_back(id);
+            objects.push_back(object);
+        }
+
+        std::optional<StaticDistanceField> field;
+        if (!config.cache_file.empty()) {
+            field = StaticDistanceField::Load(config.cache_file, config.lower, config.upper, config.resolution,
+                                              config.narrow_band, descriptions);
+        }
+        if (!field.has_value()) {
+            fcl::DistanceRequestd request;
+            request.enable_nearest_points = true;
+            request.enable_signed_distance = true;
+            request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+            request.distance_tolerance = distance_tolerance_;
+            // The distance to a point is the distance to a sphere of zero radius.
+            const auto distance = [&](int g, const Vector3d& p_WQ) {
+                CollisionObjectd point(make_shared<fcl::Sphered>(0.0));
+                point.setTranslation(p_WQ);
+                point.computeAABB();
+                EncodedData(ids[g], true).write_to(&point);
+                SignedDistancePair<double> result;
+                shape_distance::ComputeNarrowPhaseDistance<double>(point, RigidTransformd(p_WQ), *objects[g],
+                                                                   RigidTransformd(objects[g]->getTransform()),
+                                                                   request, &result);
+                return result.distance;
+            };
+            field = StaticDistanceField::Bake(config.lower, config.upper, config.resolution, config.narrow_band,
+                                              geometries, distance);
+            if (!config.cache_file.empty()) {
+                field->Save(config.cache_file);
+                log()->debug("Saved the static distance field of {} anchored geometries ({} blocks) to '{}'.",
+                             ssize(ids), field->num_blocks(), config.cache_file);
+            }
+        }
+
+        static_distance_field_ = std::make_shared<const StaticDistanceField>(std::move(*field));
+        static_distance_field_config_ = config;
+        static_distance_field_ids_ = std::move(ids);
+        static_distance_field_aabbs_.clear();
+        for (const CollisionObjectd* object : objects) {
+            static_distance_field_aabbs_.push_back(object->getAABB());
+        }
+        dynamic_geometry_samples_.clear();
+        for (const auto& id_object_pair : dynamic_objects_) {
+            MaybeSampleDynamicGeometry(id_object_pair.first);
+        }
+    }
+
+    bool has_static_distance_field() const { return static_distance_field_ != nullptr; }
+
     // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
     //  1. I could make this move semantics (or swap semantics).
     //  2. I could simply have a method that returns a mutable reference to such
@@ -488,6 +768,12 @@ public:
 
         // Perform a query of the dynamic objects against the anchored. We don't do
         // anchored against anchored because those pairs are implicitly filtered.
+        if constexpr (std::is_same_v<T, double>) {
+            if (static_distance_field_ != nullptr) {
+                ComputeAnchoredDistancesFromField(X_WGs, &data);
+                return witness_pairs;
+            }
+        }
         FclDistance(dynamic_tree_, anchored_tree_, &data, shape_distance::Callback<T>);
         return witness_pairs;
     }
@@ -765,6 +1051,124 @@ private:
         collision_filter_.AddGeometry(id);
     }
 
+    // Samples the dynamic geometry with the given id for queries against the
+    // static distance field, if it can be sampled.
+    void MaybeSampleDynamicGeometry(GeometryId id) {
+        std::optional<GeometrySamples> samples = SampleFclGeometry(*dynamic_objects_.at(id)->collisionGeometry(),
+                                                                   static_distance_field_config_.sample_spacing);
+        if (samples.has_value()) {
+            dynamic_geometry_samples_[id] = std::move(*samples);
+        }
+    }
+
+    void DiscardStaticDistanceField() {
+        static_distance_field_.reset();
+        static_distance_field_ids_.clear();
+        static_distance_field_aabbs_.clear();
+        dynamic_geometry_samples_.clear();
+    }
+
+    // Computes the signed distances between the dynamic and the anchored
+    // geometries using the static distance field, as documented in
+    // StaticDistanceFieldConfig. A dynamic geometry is queried exactly instead
+    // if it wasn't sampled, if the field can't answer for one of its points, if
+    // the anchored geometry nearest to one of its points is filtered against it
+    // (as the field can't tell what lies behind that geometry), or if it is
+    // sampled on its surface and its bounding box contains an anchored
+    // geometry's (which it may then enclose).
+    void ComputeAnchoredDistancesFromField(const std::unordered_map<GeometryId, RigidTransformd>& X_WGs,
+                                           shape_distance::CallbackData<double>* data) const {
+        const StaticDistanceField& field = *static_distance_field_;
+        const double max_distance = data->max_distance;
+        const StaticDistanceFieldConfig& config = static_distance_field_config_;
+        // Pairs whose approximate distance is less than this are recomputed
+        // exactly. The margin is the most by which the field may overestimate a
+        // distance: half the sample spacing (for surface points) plus the
+        // interpolation error, which is at most a cell's diagonal.
+        const double exact_distance =
+                config.exact_distance > 0
+                        ? config.exact_distance + config.sample_spacing / 2 + std::sqrt(3.0) * config.resolution
+                        : 0.0;
+
+        // The point of a dynamic geometry nearest to an anchored geometry.
+        struct NearestPoint {
+            double distance{};
+            double field_distance{};
+            Vector3d p_WQ;
+            Vector3d grad_W;
+        };
+        // Keyed by the index of the anchored geometry in the field.
+        std::unordered_map<int, NearestPoint> nearest_points;
+
+        for (const auto& [id_A, object_A] : dynamic_objects_) {
+            CollisionObjectd* const object_A_ptr = object_A.get();
+            const auto query_exactly = [&]() {
+                anchored_tree_.distance(object_A_ptr, data, shape_distance::Callback<double>);
+            };
+            const auto samples_iter = dynamic_geometry_samples_.find(id_A);
+            if (samples_iter == dynamic_geometry_samples_.end()) {
+                query_exactly();
+                continue;
+            }
+            const GeometrySamples& samples = samples_iter->second;
+            if (max_distance > field.narrow_band() - samples.radius) {
+                query_exactly();
+                continue;
+            }
+            const auto encloses = [&](const fcl::AABBd& aabb_B) {
+                return object_A_ptr->getAABB().contain(aabb_B);
+            };
+            if (samples.on_surface &&
+                std::any_of(static_distance_field_aabbs_.begin(), static_distance_field_aabbs_.end(), encloses)) {
+                query_exactly();
+                continue;
+            }
+
+            const RigidTransformd& X_WA = X_WGs.at(id_A);
+            const Eigen::Matrix3Xd p_WQs = (X_WA.rotation().matrix() * samples.p_GQs).colwise() + X_WA.translation();
+            nearest_points.clear();
+            bool exact = false;
+            for (int i = 0; i < p_WQs.cols() && !exact; ++i) {
+                const std::optional<StaticDistanceField::Value> value = field.Evaluate(p_WQs.col(i));
+                if (!value.has_value()) {
+                    exact = true;
+                } else if (value->geometry >= 0) {
+                    if (!collision_filter_.CanCollideWith(id_A, static_distance_field_ids_[value->geometry])) {
+                        exact = true;
+                        continue;
+                    }
+                    const double distance = value->distance - samples.radius;
+                    const auto [iter, inserted] = nearest_points.try_emplace(value->geometry);
+                    if (inserted || distance < iter->second.distance) {
+                        iter->second = {distance, value->distance, p_WQs.col(i), value->grad_W};
+                    }
+                }
+            }
+            if (exact) {
+                query_exactly();
+                continue;
+            }
+
+            for (const auto& [index, nearest] : nearest_points) {
+                if (nearest.distance > max_distance) continue;
+                const GeometryId id_B = static_distance_field_ids_[index];
+                if (nearest.distance < exact_distance) {
+                    CollisionObjectd* const object_B_ptr = anchored_objects_.at(id_B).get();
+                    double unused_max_distance = max_distance;
+                    shape_distance::Callback<double>(object_A_ptr, object_B_ptr, data, unused_max_distance);
+                    continue;
+                }
+                const Vector3d p_WCa = nearest.p_WQ - samples.radius * nearest.grad_W;
+                const Vector3d p_WCb = nearest.p_WQ - nearest.field_distance * nearest.grad_W;
+                SignedDistancePair<double> pair(id_A, id_B, X_WA.inverse() * p_WCa, X_WGs.at(id_B).inverse() * p_WCb,
+                                                nearest.distance, nearest.grad_W);
+                // Match the ordering of the exact query.
+                if (id_B < id_A) pair.SwapAAndB();
+                data->nearest_pairs.push_back(std::move(pair));
+            }
+        }
+    }
+
     // Removes the geometry with the given id from the given tree.
     void RemoveGeometry(GeometryId id,
                         fcl::DynamicAABBTreeCollisionManager<double>* tree,
@@ -848,6 +1252,18 @@ private:
     // The deformable geometries registered here are not included in
     // `dynamic_objects_` and `dynamic_tree_`.
     deformable::Geometries geometries_for_deformable_contact_;
+
+    // The signed distance field of the anchored geometry, if it has been baked
+    // (and not since discarded); copies of the engine share it.
+    std::shared_ptr<const StaticDistanceField> static_distance_field_;
+    StaticDistanceFieldConfig static_distance_field_config_;
+    // The ids of the field's geometries, indexed as in the field.
+    std::vector<GeometryId> static_distance_field_ids_;
+    // The world-frame bounding boxes of the field's geometries, indexed as in
+    // the field.
+    std::vector<fcl::AABBd> static_distance_field_aabbs_;
+    // The points sampled from the dynamic geometries, while there is a field.
+    std::unordered_map<GeometryId, GeometrySamples> dynamic_geometry_samples_;
 };
 
 template <typename T>
@@ -954,6 +1370,16 @@ double ProximityEngine<T>::distance_tolerance() const {
     return impl_->distance_tolerance();
 }
 
+template <typename T>
+void ProximityEngine<T>::BakeStaticDistanceField(const StaticDistanceFieldConfig& config) {
+    impl_->BakeStaticDistanceField(config);
+}
+
+template <typename T>
+bool ProximityEngine<T>::has_static_distance_field() const {
+    return impl_->has_static_distance_field();
+}
+
 template <typename T>
 template <typename U>
 std::unique_ptr<ProximityEngine<U>> ProximityEngine<T>::ToScalarType() const {
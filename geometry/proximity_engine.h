@@ -21,6 +21,7 @@
 #include "geometry/query_results/penetration_as_point_pair.h"
 #include "geometry/query_results/signed_distance_pair.h"
 #include "geometry/query_results/signed_distance_to_point.h"
+#include "geometry/scene_graph_config.h"
 #include "geometry/shape_specification.h"
 #include "math/rigid_transform.h"
 
@@ -176,6 +177,18 @@ public:
 
     double distance_tolerance() const;
 
+    /* Bakes the signed distance field of the anchored geometry (or loads it from
+     config.cache_file, saving it there if it had to be baked), replacing any
+     previous field. Until anchored geometry is added or removed (which
+     discards the field), ComputeSignedDistancePairwiseClosestPoints() uses it
+     for T = double as documented in StaticDistanceFieldConfig. Copies of the
+     engine share the field.
+     @throws std::exception if the field must be saved but can't be.  */
+    void BakeStaticDistanceField(const StaticDistanceFieldConfig& config);
+
+    /* Reports whether the engine has a static distance field.  */
+    bool has_static_distance_field() const;
+
     //@}
 
     /* Updates the poses for all of the _dynamic_ geometries in the engine.
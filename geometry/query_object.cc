@@ -231,6 +231,15 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
     return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(const std::vector<render::ImageRenderRequest>& requests) const {
+    ThrowIfNotCallable();
+
+    FullPoseUpdate();
+    const GeometryState<T>& state = geometry_state();
+    return state.RenderImages(requests);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(const std::string& name) const {
     ThrowIfNotCallable();
@@ -648,6 +648,15 @@ public:
 
     - ᵃ Return the gradient as a Vector3d of NaN if the sphere has zero radius.
 
+     <h3>Static distance field</h3>
+
+     If SceneGraphConfig::static_distance_field is set and `max_distance` is
+     finite, the distances between dynamic and anchored geometry are (for `T` =
+     `double`) looked up in a precomputed signed distance field of the anchored
+     geometry instead, which is much faster for detailed environments. They are
+     then approximate, and a dynamic geometry is only paired with the anchored
+     geometries nearest to some part of it; see StaticDistanceFieldConfig.
+
      @param max_distance  The maximum distance at which distance data is reported.
 
      @returns The signed distance (and supporting data) for all unfiltered
@@ -839,6 +848,22 @@ public:
                           const math::RigidTransformd& X_PC,
                           systems::sensors::ImageLabel16I* label_image_out) const;
 
+    /** Renders a batch of images, e.g., the color, depth, and label images of
+     every camera of a robot. Each request names the images wanted from one
+     camera body, whose pose X_WB in the world frame it provides (e.g.,
+     `GetPoseInWorld(frame_id) * X_PB` for a body posed in a frame). The
+     result is the same as rendering each image with RenderColorImage(),
+     RenderDepthImage(), or RenderLabelImage(), but each render engine
+     receives all of its requests at once and so can share work across them
+     (see render::RenderEngine::RenderImages()).
+
+     @param requests  The images to render.
+     @throws std::exception if a request's cameras name different renderers,
+                            a named renderer doesn't exist, or the request is
+                            otherwise invalid (see
+                            render::RenderEngine::RenderImages()).  */
+    void RenderImages(const std::vector<render::ImageRenderRequest>& requests) const;
+
     /** Returns the named render engine, if it exists. The RenderEngine is
      guaranteed to be up to date w.r.t. the poses and data in the context. */
     const render::RenderEngine* GetRenderEngineByName(const std::string& name) const;
@@ -147,6 +147,50 @@ void RenderEngine::DoRenderLabelImage(const ColorRenderCamera&, ImageLabel16I*)
     throw std::runtime_error(fmt::format("{}: has not implemented DoRenderLabelImage().", NiceTypeName::Get(*this)));
 }
 
+void RenderEngine::RenderImages(const std::vector<ImageRenderRequest>& requests) {
+    for (const ImageRenderRequest& request : requests) {
+        if ((request.color_image != nullptr || request.label_image != nullptr) && !request.color_camera.has_value()) {
+            throw std::logic_error("RenderImages(): a color or label image was requested without a color camera");
+        }
+        if (request.depth_image != nullptr && !request.depth_camera.has_value()) {
+            throw std::logic_error("RenderImages(): a depth image was requested without a depth camera");
+        }
+        if (request.color_image != nullptr) {
+            ThrowIfInvalid(request.color_camera->core().intrinsics(), request.color_image, "color");
+        }
+        if (request.label_image != nullptr) {
+            ThrowIfInvalid(request.color_camera->core().intrinsics(), request.label_image, "label");
+        }
+        if (request.depth_image != nullptr) {
+            ThrowIfInvalid(request.depth_camera->core().intrinsics(), request.depth_image, "depth");
+        }
+    }
+    DoRenderImages(requests);
+}
+
+void RenderEngine::DoRenderImages(const std::vector<ImageRenderRequest>& requests) {
+    for (const ImageRenderRequest& request : requests) {
+        std::optional<RigidTransformd> X_WC;
+        if (request.color_image != nullptr || request.label_image != nullptr) {
+            X_WC = request.X_WB * request.color_camera->core().sensor_pose_in_camera_body();
+            UpdateViewpoint(*X_WC);
+            if (request.color_image != nullptr) {
+                DoRenderColorImage(*request.color_camera, request.color_image);
+            }
+            if (request.label_image != nullptr) {
+                DoRenderLabelImage(*request.color_camera, request.label_image);
+            }
+        }
+        if (request.depth_image != nullptr) {
+            const RigidTransformd X_WD = request.X_WB * request.depth_camera->core().sensor_pose_in_camera_body();
+            if (!X_WC.has_value() || !X_WD.IsExactlyEqualTo(*X_WC)) {
+                UpdateViewpoint(X_WD);
+            }
+            DoRenderDepthImage(*request.depth_camera, request.depth_image);
+        }
+    }
+}
+
 void RenderEngine::SetDefaultLightPosition(const Vector3<double>&) {}
 
 }  // namespace render
@@ -25,6 +25,30 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** A request for the images seen by one camera, rendered as part of a batch by
+ RenderEngine::RenderImages(). Each non-null image pointer requests that image;
+ the color and label images are rendered with `color_camera` and the depth image
+ with `depth_camera`. Each image must have the size declared by its camera.  */
+struct ImageRenderRequest {
+    /** The pose of the camera body B in the world frame. Each camera renders
+     from the pose X_WB * X_BS, where X_BS is its
+     RenderCameraCore::sensor_pose_in_camera_body().  */
+    math::RigidTransformd X_WB;
+
+    /** The camera for the color and label images; it must be provided if
+     either image is requested.  */
+    std::optional<ColorRenderCamera> color_camera;
+
+    /** The camera for the depth image; it must be provided if the depth image
+     is requested.  */
+    std::optional<DepthRenderCamera> depth_camera;
+
+    /** The outputs (each optional).  */
+    systems::sensors::ImageRgba8U* color_image{};
+    systems::sensors::ImageDepth32F* depth_image{};
+    systems::sensors::ImageLabel16I* label_image{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -191,6 +215,27 @@ public:
         }
     }
 
+    /** Updates the poses of the given geometries, for those that are rigid and
+     marked as "needing update" (see RegisterVisual()); other ids are ignored.
+     This is the incremental form of UpdatePoses() for callers that know which
+     geometries have moved since the previous update (as SceneGraph does), so
+     that geometries at rest cost nothing.
+
+     @param X_WGs  The poses of *all* geometries in SceneGraph (measured and
+                   expressed in the world frame). The pose for a geometry is
+                   accessed by that geometry's id.
+     @param ids    The ids of the geometries whose poses have changed since this
+                   engine last received them.  */
+    template <typename T>
+    void UpdatePoses(const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+                     const std::vector<GeometryId>& ids) {
+        for (const GeometryId& id : ids) {
+            if (!update_ids_.contains(id)) continue;
+            const math::RigidTransformd X_WG = geometry::internal::convert_to_double(X_WGs.at(id));
+            DoUpdateVisualPose(id, X_WG);
+        }
+    }
+
     /** Updates the configurations of all meshes associated with the given
      deformable geometry (see RegisterDeformableVisual()). The number of elements
      in the supplied vertex position vector `q_WGs` and the vertex normal vector
@@ -276,6 +321,21 @@ public:
         DoRenderLabelImage(camera, label_image_out);
     }
 
+    /** Renders the requested images for each of a batch of cameras (e.g., the
+     color, depth, and label images of every camera on a robot). The result is
+     the same as calling, for each request, UpdateViewpoint() and then each
+     of RenderColorImage(), RenderDepthImage(), and RenderLabelImage() whose
+     image was requested; but derived engines may share work across the
+     images and cameras of the batch (e.g., setting up a camera once for all
+     of its images, or submitting all of the drawing before reading back any
+     image). On return, the viewpoint is that of the last image rendered.
+
+     @param requests  The images to render, one request per camera pose.
+     @throws std::exception if a request asks for an image without providing
+                            the corresponding camera, or if the size of an
+                            image doesn't match its camera.  */
+    void RenderImages(const std::vector<ImageRenderRequest>& requests);
+
     //@}
 
     /** Reports the render label value this render engine has been configured to
@@ -373,6 +433,17 @@ protected:
     virtual void DoRenderLabelImage(const ColorRenderCamera& camera,
                                     systems::sensors::ImageLabel16I* label_image_out) const;
 
+    /** The NVI-function for RenderImages(). When RenderImages calls this, it
+     has already confirmed that every requested image has a camera and that
+     its size is consistent with the camera intrinsics.
+
+     The default implementation renders each request's images in turn with
+     UpdateViewpoint() and DoRenderColorImage(), DoRenderDepthImage(), and
+     DoRenderLabelImage() (setting the viewpoint only once per request when the
+     cameras share a pose). Derived classes can override it to share work
+     across the batch.  */
+    virtual void DoRenderImages(const std::vector<ImageRenderRequest>& requests);
+
     /** Extracts the `(label, id)` RenderLabel property from the given
      `properties` and validates it (or the configured default if no such
      property is defined).
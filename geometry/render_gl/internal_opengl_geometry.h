@@ -186,6 +186,20 @@ struct OpenGlGeometry {
      but vertex arrays are *not* shared. */
     VertexSpec spec;
 
+    /* The radius of the smallest sphere centered on the origin of frame N that
+     contains all of the vertices. */
+    float radius{};
+
+    /* The index into RenderEngineGl's geometries of a simplified version of
+     this geometry (with fewer triangles), or -1 if there is none. The
+     simplified version is drawn in its place when the difference between the
+     two is too small to see (see RenderEngineGlParams::lod_pixel_tolerance).
+     Simplified versions may themselves have simplified versions. */
+    int simplified{-1};
+    /* The largest distance between this geometry's surface and its simplified
+     version's, as a fraction of `radius`. */
+    float simplified_error{};
+
     /* The value of an object (array, buffer) that should be considered invalid.
      */
     static constexpr GLuint kInvalid = std::numeric_limits<GLuint>::max();
@@ -229,6 +243,9 @@ struct OpenGlInstance {
         T_GN = S_GM * geo.T_MN;
         const Eigen::DiagonalMatrix<float, 3> N_GM(Eigen::Vector3f(1.0 / scale.x(), 1.0 / scale.y(), 1.0 / scale.z()));
         N_GN = N_GM * geo.N_MN;
+        // The largest row norm of the linear part bounds how much it stretches
+        // any vector (exactly so for a scaled rotation).
+        radius = geo.radius * T_GN.topLeftCorner<3, 3>().rowwise().norm().maxCoeff();
         DRAKE_DEMAND(color_data.shader_id().is_valid());
         DRAKE_DEMAND(depth_data.shader_id().is_valid());
         DRAKE_DEMAND(label_data.shader_id().is_valid());
@@ -255,6 +272,10 @@ struct OpenGlInstance {
      RenderEngineGl::DoUpdateVisualPose() is responsible for updating this.  */
     Eigen::Matrix3f N_WN{Eigen::Matrix3f::Identity()};
 
+    /* The radius of a sphere centered on the origin of frame N that contains
+     all of the instance's vertices (i.e., the geometry's radius, scaled). */
+    float radius{};
+
     std::array<ShaderProgramData, RenderType::kTypeCount> shader_data;
 };
 
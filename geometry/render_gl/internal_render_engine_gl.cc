@@ -38,6 +38,7 @@ using math::RigidTransformd;
 using math::RotationMatrixd;
 using render::ColorRenderCamera;
 using render::DepthRenderCamera;
+using render::ImageRenderRequest;
 using render::LightParameter;
 using render::RenderCameraCore;
 using render::RenderEngine;
@@ -481,13 +482,15 @@ void main() {
 };
 
 /* The built-in shader for objects in depth images. By default, the shader
- supports all geometries.  */
+ supports all geometries. It is instanced.  */
 class DefaultDepthShader final : public ShaderProgram {
 public:
     DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DefaultDepthShader);
 
     DefaultDepthShader() : ShaderProgram() { LoadFromSources(kVertexShader, kFragmentShader); }
 
+    bool is_instanced() const final { return true; }
+
     void SetDepthCameraParameters(const DepthRenderCamera& camera) const final {
         glUniform1f(depth_z_near_loc_, camera.depth_range().min_depth());
         glUniform1f(depth_z_far_loc_, camera.depth_range().max_depth());
@@ -517,8 +520,8 @@ private:
 #version 330
 
 layout(location = 0) in vec3 p_MV;
+layout(location = 3) in mat4 T_CM;  // The "model view matrix" (in OpenGl terms).
 out float depth;
-uniform mat4 T_CM;  // The "model view matrix" (in OpenGl terms).
 uniform mat4 T_DC;  // The "projection matrix" (in OpenGl terms).
 
 void main() {
@@ -564,7 +567,8 @@ void main() {
 /* The built-in shader for objects in label images. The support this shader
  gives for geometry depends on the label encoder function. The shader program
  assumes the encoder will either provide a label or throw based on the given
- perception properties.  */
+ perception properties. It is instanced; each instance's encoded label is its
+ instance value.  */
 class DefaultLabelShader final : public ShaderProgram {
 public:
     DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DefaultLabelShader);
@@ -581,12 +585,14 @@ public:
         LoadFromSources(kVertexShader, kFragmentShader);
     }
 
-    void SetInstanceParameters(const ShaderProgramData& data) const final {
-        glUniform4fv(encoded_label_loc_, 1, data.value().get_value<Vector4<float>>().data());
+    bool is_instanced() const final { return true; }
+
+    Vector4<float> GetInstanceValue(const ShaderProgramData& data) const final {
+        return data.value().get_value<Vector4<float>>();
     }
 
 private:
-    void DoConfigureUniforms() final { encoded_label_loc_ = GetUniformLocation("encoded_label"); }
+    void DoConfigureUniforms() final {}
 
     std::unique_ptr<ShaderProgram> DoClone() const final { return make_unique<DefaultLabelShader>(*this); }
 
@@ -596,8 +602,6 @@ private:
 
     std::function<Vector4<float>(const PerceptionProperties&)> label_encoder_;
 
-    GLint encoded_label_loc_{};
-
     // The vertex shader simply transforms the vertices. Strictly speaking, we
     // could combine modelview and projection matrices into a single transform,
     // but there's no real value in doing so. Leaving it as is maintains
@@ -605,20 +609,23 @@ private:
     static constexpr char kVertexShader[] = R"""(
 #version 330
 layout(location = 0) in vec3 p_MV;
-uniform mat4 T_CM;  // The "model view matrix" (in OpenGl terms).
+layout(location = 3) in mat4 T_CM;  // The "model view matrix" (in OpenGl terms).
+layout(location = 7) in vec4 instance_label;
+flat out vec4 encoded_label;
 uniform mat4 T_DC;  // The "projection matrix" (in OpenGl terms).
 void main() {
   // X_CM = T_CM (although X may not be a *rigid* transform).
   vec4 p_CV = T_CM * vec4(p_MV, 1);
   gl_Position = T_DC * p_CV;
+  encoded_label = instance_label;
 })""";
 
     // For each fragment from a geometry, it simply colors the fragment with the
     // provided label encoded as an RGBA color.
     static constexpr char kFragmentShader[] = R"""(
 #version 330
+flat in vec4 encoded_label;
 out vec4 color;
-uniform vec4 encoded_label;
 void main() {
   color = encoded_label;
 })""";
@@ -660,6 +667,25 @@ RenderEngineGlParams CleanupLights(RenderEngineGlParams params) {
     return params;
 }
 
+/* The vertex buffer binding index of the per-instance attributes of instanced
+ shaders: the model view matrix followed by the instance value, as floats. The
+ binding indices 0-2 are used by the geometry's vertex data. */
+constexpr GLuint kInstanceBinding = 3;
+constexpr int kFloatsPerInstance = 16 + 4;
+
+/* Enables or disables the per-instance attributes of the given vertex array
+ object. */
+void SetInstanceAttributesEnabled(GLuint vertex_array, bool enabled) {
+    for (GLuint attribute = ShaderProgram::kModelViewAttribute; attribute <= ShaderProgram::kInstanceValueAttribute;
+         ++attribute) {
+        if (enabled) {
+            glEnableVertexArrayAttrib(vertex_array, attribute);
+        } else {
+            glDisableVertexArrayAttrib(vertex_array, attribute);
+        }
+    }
+}
+
 }  // namespace
 
 RenderEngineGl::RenderEngineGl(RenderEngineGlParams params)
@@ -667,6 +693,10 @@ RenderEngineGl::RenderEngineGl(RenderEngineGlParams params)
       opengl_context_(make_unique<OpenGlContext>()),
       texture_library_(make_shared<TextureLibrary>()),
       parameters_(CleanupLights(std::move(params))) {
+    if (!(parameters_.lod_pixel_tolerance >= 0)) {
+        throw std::logic_error(fmt::format("RenderEngineGl's lod_pixel_tolerance must be non-negative; {} specified.",
+                                           parameters_.lod_pixel_tolerance));
+    }
     // The default light parameters have been crafted to create the default
     // "headlamp" camera.
     fallback_lights_.push_back({});
@@ -712,6 +742,11 @@ RenderEngineGl::~RenderEngineGl() {
         glDeleteVertexArrays(1, &geometry.vertex_array);
     }
 
+    if (instance_buffer_ != 0) {
+        GLuint instance_buffer = instance_buffer_;
+        glDeleteBuffers(1, &instance_buffer);
+    }
+
     // Delete programs.
     for (auto& shader_type : shader_programs_) {
         for (auto& [_, program_ptr] : shader_type) {
@@ -966,32 +1001,163 @@ unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
     return clone;
 }
 
-void RenderEngineGl::RenderAt(const ShaderProgram& shader_program, RenderType render_type) const {
+void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
+                              RenderType render_type,
+                              const RenderCameraCore& camera) const {
     const Matrix4f& X_CW = X_CW_.GetAsMatrix4().matrix().cast<float>();
     // We rely on the calling method to clear all appropriate buffers; this method
     // may be called multiple times per image (based on the number of shaders
     // being used) and, therefore, can't do the clearing itself.
 
+    // A length l at depth z in the camera frame spans (approximately) f⋅l/z
+    // pixels in the image.
+    const float focal_length = camera.intrinsics().focal_y();
+    const float tolerance = parameters_.lod_pixel_tolerance;
+    // Returns the index of the version of the instance's geometry to draw.
+    const auto select_geometry = [&](const OpenGlInstance& instance) {
+        int geometry_index = instance.geometry;
+        if (tolerance > 0 && geometries_[geometry_index].simplified >= 0) {
+            const float depth = X_CW.row(2).dot(instance.T_WN.col(3));
+            // Instances which may reach the camera's plane are always drawn in
+            // full.
+            if (depth > instance.radius) {
+                const float radius_pixels = focal_length * instance.radius / depth;
+                while (geometries_[geometry_index].simplified >= 0 &&
+                       radius_pixels * geometries_[geometry_index].simplified_error <= tolerance) {
+                    geometry_index = geometries_[geometry_index].simplified;
+                }
+            }
+        }
+        return geometry_index;
+    };
+
+    // The instances to draw, with the geometry they are drawn with.
+    std::vector<std::pair<int, const OpenGlInstance*>> draws;
     for (const GeometryId& g_id : shader_families_.at(render_type).at(shader_program.shader_id())) {
         for (const auto& instance : visuals_.at(g_id).instances) {
-            if (instance.shader_data.at(render_type).shader_id() != shader_program.shader_id()) {
-                continue;
+            if (instance.shader_data.at(render_type).shader_id() == shader_program.shader_id()) {
+                draws.emplace_back(select_geometry(instance), &instance);
             }
-            const OpenGlGeometry& geometry = geometries_[instance.geometry];
-            glBindVertexArray(geometry.vertex_array);
+        }
+    }
 
-            shader_program.SetInstanceParameters(instance.shader_data[render_type]);
-            shader_program.SetModelViewMatrix(X_CW, instance.T_WN, instance.N_WN);
+    if (!shader_program.is_instanced()) {
+        // Instances which share a geometry (e.g., the many instances of a common
+        // mesh or primitive) are drawn without rebinding its vertex array.
+        GLuint bound_vertex_array = OpenGlGeometry::kInvalid;
+        for (const auto& [geometry_index, instance] : draws) {
+            const OpenGlGeometry& geometry = geometries_[geometry_index];
+            if (geometry.vertex_array != bound_vertex_array) {
+                glBindVertexArray(geometry.vertex_array);
+                bound_vertex_array = geometry.vertex_array;
+            }
+
+            shader_program.SetInstanceParameters(instance->shader_data[render_type]);
+            shader_program.SetModelViewMatrix(X_CW, instance->T_WN, instance->N_WN);
 
             glDrawElements(geometry.mode, geometry.index_count, geometry.type, 0);
         }
+        // Unbind the vertex array back to the default of 0.
+        glBindVertexArray(0);
+        return;
+    }
+
+    // Group the instances by geometry and upload their attributes, so that the
+    // instances of each geometry are a contiguous range of the buffer.
+    std::stable_sort(draws.begin(), draws.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+    std::vector<GLfloat> attributes;
+    attributes.reserve(draws.size() * kFloatsPerInstance);
+    for (const auto& [_, instance] : draws) {
+        const Matrix4f T_CglN = ShaderProgram::CalcModelViewMatrix(X_CW, instance->T_WN);
+        const Vector4<float> value = shader_program.GetInstanceValue(instance->shader_data[render_type]);
+        attributes.insert(attributes.end(), T_CglN.data(), T_CglN.data() + 16);
+        attributes.insert(attributes.end(), value.data(), value.data() + 4);
+    }
+    if (instance_buffer_ == 0) {
+        GLuint instance_buffer{};
+        glCreateBuffers(1, &instance_buffer);
+        instance_buffer_ = instance_buffer;
+    }
+    glNamedBufferData(instance_buffer_, attributes.size() * sizeof(GLfloat), attributes.data(), GL_STREAM_DRAW);
+
+    for (int first = 0; first < ssize(draws);) {
+        const int geometry_index = draws[first].first;
+        int last = first + 1;
+        while (last < ssize(draws) && draws[last].first == geometry_index) {
+            ++last;
+        }
+        const OpenGlGeometry& geometry = geometries_[geometry_index];
+        glVertexArrayVertexBuffer(geometry.vertex_array, kInstanceBinding, instance_buffer_,
+                                  first * kFloatsPerInstance * sizeof(GLfloat), kFloatsPerInstance * sizeof(GLfloat));
+        SetInstanceAttributesEnabled(geometry.vertex_array, true);
+        glBindVertexArray(geometry.vertex_array);
+        glDrawElementsInstanced(geometry.mode, geometry.index_count, geometry.type, 0, last - first);
+        glBindVertexArray(0);
+        SetInstanceAttributesEnabled(geometry.vertex_array, false);
+        first = last;
     }
-    // Unbind the vertex array back to the default of 0.
-    glBindVertexArray(0);
 }
 
 void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera, ImageRgba8U* color_image_out) const {
     opengl_context_->MakeCurrent();
+    const RenderTarget render_target = DrawColorImage(camera);
+    glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, color_image_out->size(),
+                      color_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
+    opengl_context_->MakeCurrent();
+    const RenderTarget render_target = DrawDepthImage(camera);
+    glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT, depth_image_out->size() * sizeof(GLfloat),
+                      depth_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
+    opengl_context_->MakeCurrent();
+    const RenderTarget render_target = DrawLabelImage(camera);
+    // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
+    // buffer texture consisting of a single-channel, 16-bit, signed int (to match
+    // the underlying RenderLabel value). Doing so would allow us to render labels
+    // directly and eliminate this additional pass.
+    GetLabelImage(label_image_out, render_target);
+}
+
+void RenderEngineGl::DoRenderImages(const std::vector<ImageRenderRequest>& requests) {
+    opengl_context_->MakeCurrent();
+    for (const ImageRenderRequest& request : requests) {
+        // Each image type has its own render target, so all of a camera's
+        // images are drawn before any of them is read back; reading an image
+        // back waits for the GPU to finish drawing, which now happens once per
+        // camera rather than once per image.
+        std::optional<RenderTarget> color_target;
+        std::optional<RenderTarget> label_target;
+        std::optional<RenderTarget> depth_target;
+        if (request.color_image != nullptr || request.label_image != nullptr) {
+            UpdateViewpoint(request.X_WB * request.color_camera->core().sensor_pose_in_camera_body());
+            if (request.color_image != nullptr) color_target = DrawColorImage(*request.color_camera);
+            if (request.label_image != nullptr) label_target = DrawLabelImage(*request.color_camera);
+        }
+        if (request.depth_image != nullptr) {
+            UpdateViewpoint(request.X_WB * request.depth_camera->core().sensor_pose_in_camera_body());
+            depth_target = DrawDepthImage(*request.depth_camera);
+        }
+        if (color_target) {
+            glGetTextureImage(color_target->value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, request.color_image->size(),
+                              request.color_image->at(0, 0));
+        }
+        if (depth_target) {
+            glGetTextureImage(depth_target->value_texture, 0, GL_RED, GL_FLOAT,
+                              request.depth_image->size() * sizeof(GLfloat), request.depth_image->at(0, 0));
+        }
+        if (label_target) {
+            GetLabelImage(request.label_image, *label_target);
+        }
+    }
+}
+
+RenderTarget RenderEngineGl::DrawColorImage(const ColorRenderCamera& camera) const {
     // TODO(SeanCurtis-TRI): For transparency to work properly, I need to
     //  segregate objects with transparency from those without. The transparent
     //  geometries then need to be sorted from farthest to nearest the camera and
@@ -1013,7 +1179,7 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera, ImageRg
     for (const auto& [_, shader_program] : shader_programs_[RenderType::kColor]) {
         shader_program->Use();
         shader_program->SetProjectionMatrix(T_DC);
-        RenderAt(*shader_program, RenderType::kColor);
+        RenderAt(*shader_program, RenderType::kColor, camera.core());
         shader_program->Unuse();
     }
     glDisable(GL_BLEND);
@@ -1023,13 +1189,10 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera, ImageRg
     // the front buffer; reversing the order means the image we've just rendered
     // wouldn't be visible.
     SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-    glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE, color_image_out->size(),
-                      color_image_out->at(0, 0));
+    return render_target;
 }
 
-void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
-    opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawDepthImage(const DepthRenderCamera& camera) const {
     const RenderTarget render_target = GetRenderTarget(camera.core(), RenderType::kDepth);
 
     // We initialize the color buffer to be all "too far" values. This is the
@@ -1048,18 +1211,14 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera, ImageDe
 
         shader_program.SetProjectionMatrix(T_DC);
         shader_program.SetDepthCameraParameters(camera);
-        RenderAt(shader_program, RenderType::kDepth);
+        RenderAt(shader_program, RenderType::kDepth, camera.core());
 
         shader_program.Unuse();
     }
-
-    glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT, depth_image_out->size() * sizeof(GLfloat),
-                      depth_image_out->at(0, 0));
+    return render_target;
 }
 
-void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
-    opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawLabelImage(const ColorRenderCamera& camera) const {
     const RenderTarget render_target = GetRenderTarget(camera.core(), RenderType::kLabel);
     // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a member.
     const Rgba empty_color = RenderEngine::MakeRgbFromLabel(RenderLabel::kEmpty);
@@ -1077,7 +1236,7 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLa
         shader_program.Use();
 
         shader_program.SetProjectionMatrix(T_DC);
-        RenderAt(shader_program, RenderType::kLabel);
+        RenderAt(shader_program, RenderType::kLabel, camera.core());
 
         shader_program.Unuse();
     }
@@ -1087,11 +1246,7 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLa
     // the front buffer; reversing the order means the image we've just rendered
     // wouldn't be visible.
     SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-    // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
-    // buffer texture consisting of a single-channel, 16-bit, signed int (to match
-    // the underlying RenderLabel value). Doing so would allow us to render labels
-    // directly and eliminate this additional pass.
-    GetLabelImage(label_image_out, render_target);
+    return render_target;
 }
 
 void RenderEngineGl::AddGeometryInstance(int geometry_index, void* user_data, const Vector3d& scale) {
@@ -1121,6 +1276,14 @@ int RenderEngineGl::GetSphere() {
         RenderMesh render_mesh = MakeLongLatUnitSphere(kLongitudeBands, kLatitudeBands);
 
         sphere_ = CreateGlGeometry(render_mesh);
+
+        if (parameters_.lod_pixel_tolerance > 0) {
+            // A chord spanning an angle θ of the unit circle deviates from the
+            // circle by 1 - cos(θ/2).
+            for (const int bands : {24, 12}) {
+                AddSimplifiedGeometry(sphere_, MakeLongLatUnitSphere(bands, bands), 1 - std::cos(M_PI / bands));
+            }
+        }
     }
 
     geometries_[sphere_].throw_if_undefined("Built-in sphere has some invalid objects");
@@ -1136,6 +1299,14 @@ int RenderEngineGl::GetCylinder() {
         // along the length. For now, we'll simply save the triangles.
         RenderMesh render_mesh = MakeUnitCylinder(kLongitudeBands, 1);
         cylinder_ = CreateGlGeometry(render_mesh);
+
+        if (parameters_.lod_pixel_tolerance > 0) {
+            // As with the sphere; the unit cylinder's radius is smaller than
+            // its bounding radius, so the error is conservative.
+            for (const int strips : {24, 12}) {
+                AddSimplifiedGeometry(cylinder_, MakeUnitCylinder(strips, 1), 1 - std::cos(M_PI / strips));
+            }
+        }
     }
 
     geometries_[cylinder_].throw_if_undefined("Built-in cylinder has some invalid objects");
@@ -1224,6 +1395,20 @@ void CreateVertexArray(OpenGlGeometry* geometry) {
 
     // Bind index buffer object (IBO) with the vertex array object (VAO).
     glVertexArrayElementBuffer(geometry->vertex_array, geometry->index_buffer);
+
+    // Describe the per-instance attributes of instanced shaders. They are only
+    // enabled while drawing with an instanced shader, once RenderAt() has
+    // bound the instance buffer.
+    for (GLuint column = 0; column < 4; ++column) {
+        const GLuint attribute = ShaderProgram::kModelViewAttribute + column;
+        glVertexArrayAttribFormat(geometry->vertex_array, attribute, 4, GL_FLOAT, GL_FALSE,
+                                  4 * column * sizeof(GLfloat));
+        glVertexArrayAttribBinding(geometry->vertex_array, attribute, kInstanceBinding);
+    }
+    glVertexArrayAttribFormat(geometry->vertex_array, ShaderProgram::kInstanceValueAttribute, 4, GL_FLOAT, GL_FALSE,
+                              16 * sizeof(GLfloat));
+    glVertexArrayAttribBinding(geometry->vertex_array, ShaderProgram::kInstanceValueAttribute, kInstanceBinding);
+    glVertexArrayBindingDivisor(geometry->vertex_array, kInstanceBinding, 1);
 }
 
 }  // namespace
@@ -1834,6 +2019,7 @@ void RenderEngineGl::CacheFileMeshesMaybe(const std::string& filename, Registrat
 
                 geometries_[mesh_index].throw_if_undefined(
                         fmt::format("Error creating object for mesh {}", filename).c_str());
+                AddSimplifiedMeshesMaybe(mesh_index, render_mesh);
 
                 file_meshes.push_back({.mesh_index = mesh_index, .uv_state = render_mesh.uv_state});
 
@@ -1986,6 +2172,9 @@ int RenderEngineGl::CreateGlGeometry(const RenderMesh& render_mesh, bool is_defo
                          0);
 
     geometry.index_count = render_mesh.indices.size();
+    if (v_count > 0) {
+        geometry.radius = render_mesh.positions.rowwise().norm().maxCoeff();
+    }
 
     geometry.v_count = v_count;
     // Now configure the vertex array object with vertex attributes.
@@ -2022,6 +2211,40 @@ int RenderEngineGl::CreateGlGeometry(const RenderMesh& render_mesh, bool is_defo
     return index;
 }
 
+void RenderEngineGl::AddSimplifiedGeometry(int geometry_index,
+                                           const RenderMesh& simplified_mesh,
+                                           double relative_error) {
+    const int simplified = CreateGlGeometry(simplified_mesh);
+    while (geometries_[geometry_index].simplified >= 0) {
+        geometry_index = geometries_[geometry_index].simplified;
+    }
+    geometries_[geometry_index].simplified = simplified;
+    geometries_[geometry_index].simplified_error = relative_error;
+}
+
+void RenderEngineGl::AddSimplifiedMeshesMaybe(int geometry_index, const RenderMesh& render_mesh) {
+    // Meshes with fewer triangles than this are cheap enough to draw in full.
+    const int kMinTriangles = 1024;
+    if (parameters_.lod_pixel_tolerance <= 0 || render_mesh.indices.rows() < kMinTriangles) return;
+    // Clustering averages texture coordinates across seams.
+    if (render_mesh.material.has_value() && !render_mesh.material->diffuse_map.empty()) return;
+
+    const double radius = geometries_[geometry_index].radius;
+    if (!(radius > 0)) return;
+    Eigen::Index triangle_count = render_mesh.indices.rows();
+    // The number of grid cells spanning the mesh's bounding sphere, finest
+    // first. Each version is simplified from the full mesh, and is only kept if
+    // it has at most half of the triangles of the previous version.
+    for (const double cells_per_diameter : {64.0, 16.0}) {
+        const double cell_size = 2 * radius / cells_per_diameter;
+        const RenderMesh simplified_mesh = SimplifyMeshByClustering(render_mesh, cell_size);
+        if (simplified_mesh.indices.rows() == 0) break;
+        if (2 * simplified_mesh.indices.rows() > triangle_count) continue;
+        AddSimplifiedGeometry(geometry_index, simplified_mesh, std::sqrt(3.0) * cell_size / radius);
+        triangle_count = simplified_mesh.indices.rows();
+    }
+}
+
 void RenderEngineGl::UpdateVertexArrays() {
     DRAKE_ASSERT(opengl_context_->IsCurrent());
     // Creating the vertex arrays requires the context to be bound.
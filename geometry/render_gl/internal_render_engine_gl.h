@@ -191,6 +191,18 @@ private:
     void DoRenderLabelImage(const render::ColorRenderCamera& camera,
                             systems::sensors::ImageLabel16I* label_image_out) const final;
 
+    // @see RenderEngine::DoRenderImages().
+    void DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) final;
+
+    // Draws the color, depth, or label image seen by the given camera from the
+    // current viewpoint into the render target for its image type and size,
+    // and returns that target. The image can then be read back from the
+    // target's value_texture.
+    // @pre opengl_context_ has been bound.
+    RenderTarget DrawColorImage(const render::ColorRenderCamera& camera) const;
+    RenderTarget DrawDepthImage(const render::DepthRenderCamera& camera) const;
+    RenderTarget DrawLabelImage(const render::ColorRenderCamera& camera) const;
+
     // Copy constructor used for cloning.
     // Do *not* call this copy constructor directly. The resulting RenderEngineGl
     // is not complete -- it will render nothing except the background color.
@@ -198,8 +210,14 @@ private:
     RenderEngineGl(const RenderEngineGl& other) = default;
 
     // Renders all geometries which use the given shader program for the given
-    // render type.
-    void RenderAt(const ShaderProgram& shader_program, RenderType render_type) const;
+    // render type, as seen by the given camera. Each instance is drawn with the
+    // simplest version of its geometry whose error in the image is within
+    // parameters_.lod_pixel_tolerance. For an instanced shader, all of the
+    // instances drawn with the same version of a geometry are drawn with a
+    // single instanced draw call.
+    void RenderAt(const ShaderProgram& shader_program,
+                  RenderType render_type,
+                  const render::RenderCameraCore& camera) const;
 
     // Creates a geometry instance from the referenced geometry data, scale, and
     // user data (e.g., GeometryId, perception properties). The instance is added
@@ -283,6 +301,20 @@ private:
     // This function is *not* threadsafe.
     int CreateGlGeometry(const geometry::internal::RenderMesh& mesh_data, bool is_deformable = false);
 
+    // Creates an OpenGlGeometry from `simplified_mesh`, a simplified version of
+    // the geometry at `geometry_index` whose surface lies within
+    // `relative_error`⋅radius of it, and appends it to the end of that
+    // geometry's chain of simplified versions (see OpenGlGeometry::simplified).
+    // Versions must be added from finest to coarsest.
+    void AddSimplifiedGeometry(int geometry_index,
+                               const geometry::internal::RenderMesh& simplified_mesh,
+                               double relative_error);
+
+    // Adds simplified versions of the mesh at `geometry_index` (created from
+    // `render_mesh`) if parameters_.lod_pixel_tolerance enables them and the
+    // mesh has enough triangles to benefit.
+    void AddSimplifiedMeshesMaybe(int geometry_index, const geometry::internal::RenderMesh& render_mesh);
+
     // Updates the vertex arrays in all of the OpenGlGeometry instances owned by
     // this render engine.
     // @pre opengl_context_ has been bound.
@@ -457,6 +489,12 @@ private:
     // this directly; call active_lights() instead.
     mutable reset_on_copy<const std::vector<render::LightParameter>*> active_lights_{};
 
+    // The buffer object that holds the per-instance attributes of instanced
+    // shaders (see RenderAt()), or zero if it hasn't been created yet. Unlike
+    // the geometry buffers, it is rewritten on every render, so each copy of
+    // the engine creates its own.
+    mutable reset_on_copy<GLuint> instance_buffer_{};
+
     // Convenience vector for scaling a geometry in x,y,z-direction by 1.0 (i.e.
     // not enlarging or shrinking the geometry) for functions that require a 3d
     // scaling.
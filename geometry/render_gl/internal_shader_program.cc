@@ -108,6 +108,12 @@ void ShaderProgram::SetProjectionMatrix(const Eigen::Matrix4f& T_DC) const {
 void ShaderProgram::SetModelViewMatrix(const Eigen::Matrix4f& X_CW,
                                        const Eigen::Matrix4f& T_WM,
                                        const Eigen::Matrix3f& N_WM) const {
+    const Eigen::Matrix4f T_CglM = CalcModelViewMatrix(X_CW, T_WM);
+    glUniformMatrix4fv(model_view_loc_, 1, GL_FALSE, T_CglM.data());
+    DoSetModelViewMatrix(X_CW, T_WM, N_WM);
+}
+
+Eigen::Matrix4f ShaderProgram::CalcModelViewMatrix(const Eigen::Matrix4f& X_CW, const Eigen::Matrix4f& T_WM) {
     const Eigen::Matrix4f T_CM = X_CW * T_WM;
     // Our camera frame C wrt the OpenGL's camera frame Cgl.
     // clang-format off
@@ -118,9 +124,7 @@ void ShaderProgram::SetModelViewMatrix(const Eigen::Matrix4f& X_CW,
                             0,  0,  0, 1)
           .finished();
     // clang-format on
-    const Eigen::Matrix4f T_CglM = kT_CglC * T_CM;
-    glUniformMatrix4fv(model_view_loc_, 1, GL_FALSE, T_CglM.data());
-    DoSetModelViewMatrix(X_CW, T_WM, N_WM);
+    return kT_CglC * T_CM;
 }
 
 GLint ShaderProgram::GetUniformLocation(const std::string& uniform_name) const {
@@ -156,7 +160,9 @@ void ShaderProgram::Free() {
 
 void ShaderProgram::ConfigureUniforms() {
     projection_matrix_loc_ = GetUniformLocation("T_DC");
-    model_view_loc_ = GetUniformLocation("T_CM");
+    if (!is_instanced()) {
+        model_view_loc_ = GetUniformLocation("T_CM");
+    }
     DoConfigureUniforms();
 }
 
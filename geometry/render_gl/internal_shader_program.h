@@ -54,7 +54,10 @@ namespace internal {
    - It must specify a uniform mat4 called "T_CM" - this transforms
      vertices from the geometry's canonical frame M to the OpenGl camera frame
      C. This transform may include scale factors (meaning it is not necessarily
-     a RigidTransform).
+     a RigidTransform). An *instanced* shader (see is_instanced()) instead
+     declares T_CM as a per-instance vertex attribute at location
+     kModelViewAttribute, and may declare a per-instance vec4 at location
+     kInstanceValueAttribute.
    - It must specify a uniform mat4 called "T_DC" - this transforms
      vertices from the camera's frame C to the OpenGl normalized device frame
      D. This is a projective transform, taking points in ℜ³ and mapping them
@@ -73,6 +76,15 @@ namespace internal {
  the cloned %ShaderProgram would have to be bound at the time of cloning. */
 class ShaderProgram {
 public:
+    /* The attribute location of the per-instance model view matrix T_CM in
+     instanced shaders; as a mat4, it occupies this and the next three
+     locations. */
+    static constexpr GLuint kModelViewAttribute = 3;
+
+    /* The attribute location of the per-instance value (see GetInstanceValue())
+     in instanced shaders. */
+    static constexpr GLuint kInstanceValueAttribute = 7;
+
     ShaderProgram() : id_(ShaderId::get_new_id()) {}
 
     /* The destructor is currently superficial. The real work is done by Free()
@@ -122,6 +134,18 @@ public:
      *per-instance* shader parameters. */
     virtual void SetInstanceParameters(const ShaderProgramData& /* data */) const {}
 
+    /* Reports whether this shader reads its per-instance parameters from vertex
+     attributes, so that all instances of a geometry can be drawn with a single
+     instanced draw call. An instanced shader takes no T_CM uniform, and neither
+     SetInstanceParameters() nor SetModelViewMatrix() are called for it. */
+    virtual bool is_instanced() const { return false; }
+
+    /* For instanced shaders, extracts the per-instance value that the shader
+     reads at location kInstanceValueAttribute from the given instance data. */
+    virtual Vector4<float> GetInstanceValue(const ShaderProgramData& /* data */) const {
+        return Vector4<float>::Zero();
+    }
+
     /* Allows derived shaders to manipulate OpenGl state based on camera
      properties. This should *not* include model -> camera -> device transforms.
      they are handled elsewhere.  */
@@ -155,6 +179,11 @@ public:
                             const Eigen::Matrix4f& T_WM,
                             const Eigen::Matrix3f& N_WM) const;
 
+    /* Computes the OpenGl model view matrix for the model frame M, as set by
+     SetModelViewMatrix(). Instanced shaders receive it as a vertex attribute.
+     */
+    static Eigen::Matrix4f CalcModelViewMatrix(const Eigen::Matrix4f& X_CW, const Eigen::Matrix4f& T_WM);
+
     /* Provides the location of the named shader uniform parameter.
      @throws std::exception if the named uniform isn't part of the program. */
     GLint GetUniformLocation(const std::string& uniform_name) const;
@@ -258,9 +287,9 @@ private:
     GLuint fragment_id_{0};
 
     // Locations of the projection matrix and the model view matrix in the
-    // *supported* shader.
+    // *supported* shader. Instanced shaders have no model view matrix uniform.
     GLint projection_matrix_loc_{};
-    GLint model_view_loc_{};
+    GLint model_view_loc_{-1};
 };
 
 }  // namespace internal
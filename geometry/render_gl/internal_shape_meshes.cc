@@ -1,8 +1,10 @@
 #include "geometry/render_gl/internal_shape_meshes.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <map>
 #include <vector>
 
 #include <fmt/format.h>
@@ -883,6 +885,69 @@ RenderMesh MakeCapsule(int samples, double radius, double length) {
     return data;
 }
 
+RenderMesh SimplifyMeshByClustering(const RenderMesh& mesh, double cell_size) {
+    DRAKE_DEMAND(cell_size > 0);
+    const int v_count = mesh.positions.rows();
+
+    /* Assigns each vertex to a cluster, keyed by its grid cell and by the
+     signed axis (0-5) its normal is most closely aligned with. Separating the
+     vertices by normal keeps thin features (e.g., the two sides of a plate)
+     from collapsing into each other.  */
+    std::map<std::array<int, 4>, int> clusters;
+    vector<int> cluster_of(v_count);
+    for (int v = 0; v < v_count; ++v) {
+        const Vector3d p = mesh.positions.row(v);
+        const Vector3d n = mesh.normals.row(v);
+        int axis{};
+        n.cwiseAbs().maxCoeff(&axis);
+        const std::array<int, 4> key{static_cast<int>(std::floor(p.x() / cell_size)),
+                                     static_cast<int>(std::floor(p.y() / cell_size)),
+                                     static_cast<int>(std::floor(p.z() / cell_size)), 2 * axis + (n[axis] < 0 ? 1 : 0)};
+        const auto [iter, _] = clusters.emplace(key, static_cast<int>(clusters.size()));
+        cluster_of[v] = iter->second;
+    }
+
+    const int c_count = static_cast<int>(clusters.size());
+    RenderMesh result;
+    result.positions.setZero(c_count, 3);
+    result.normals.setZero(c_count, 3);
+    result.uvs.setZero(c_count, 2);
+    vector<int> members(c_count, 0);
+    for (int v = 0; v < v_count; ++v) {
+        const int c = cluster_of[v];
+        result.positions.row(c) += mesh.positions.row(v);
+        result.normals.row(c) += mesh.normals.row(v);
+        result.uvs.row(c) += mesh.uvs.row(v);
+        ++members[c];
+    }
+    for (int c = 0; c < c_count; ++c) {
+        result.positions.row(c) /= members[c];
+        result.uvs.row(c) /= members[c];
+        const double norm = result.normals.row(c).norm();
+        /* The members' normals all lie within the same 90° cone, so they can
+         only cancel if they are degenerate themselves.  */
+        if (norm > 0) result.normals.row(c) /= norm;
+    }
+
+    vector<std::array<unsigned int, 3>> triangles;
+    triangles.reserve(mesh.indices.rows());
+    for (int t = 0; t < mesh.indices.rows(); ++t) {
+        const unsigned int a = cluster_of[mesh.indices(t, 0)];
+        const unsigned int b = cluster_of[mesh.indices(t, 1)];
+        const unsigned int c = cluster_of[mesh.indices(t, 2)];
+        if (a == b || b == c || c == a) continue;
+        triangles.push_back({a, b, c});
+    }
+    result.indices.resize(static_cast<int>(triangles.size()), 3);
+    for (int t = 0; t < static_cast<int>(triangles.size()); ++t) {
+        result.indices.row(t) << triangles[t][0], triangles[t][1], triangles[t][2];
+    }
+
+    result.uv_state = mesh.uv_state;
+    result.material = mesh.material;
+    return result;
+}
+
 }  // namespace internal
 }  // namespace render_gl
 }  // namespace geometry
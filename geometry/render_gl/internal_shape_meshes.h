@@ -120,6 +120,21 @@ geometry::internal::RenderMesh MakeUnitBox();
  @pre radius > 0 and length > 0.  */
 geometry::internal::RenderMesh MakeCapsule(int samples, double radius, double length);
 
+/* Creates a simplified version of the given mesh by vertex clustering. The
+ vertices are grouped by the cell (of a regular grid with the given
+ `cell_size`) they lie in and by the axis their normal is most closely aligned
+ with. Each group is replaced by a single vertex whose position, normal, and
+ texture coordinate are the averages of its members', and triangles which
+ collapse are discarded. No vertex moves by more than √3⋅`cell_size`, which
+ bounds the distance between the two surfaces.
+
+ The result has the same material and uv_state as `mesh`. Because texture
+ coordinates are averaged across seams, it is only suitable for meshes which
+ are not textured.
+
+ @pre cell_size > 0.  */
+geometry::internal::RenderMesh SimplifyMeshByClustering(const geometry::internal::RenderMesh& mesh, double cell_size);
+
 }  // namespace internal
 }  // namespace render_gl
 }  // namespace geometry
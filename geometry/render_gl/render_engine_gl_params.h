@@ -19,6 +19,7 @@ struct RenderEngineGlParams {
         a->Visit(DRAKE_NVP(default_diffuse));
         a->Visit(DRAKE_NVP(default_clear_color));
         a->Visit(DRAKE_NVP(lights));
+        a->Visit(DRAKE_NVP(lod_pixel_tolerance));
     }
 
     /** Default diffuse color to apply to a geometry when none is otherwise
@@ -31,6 +32,17 @@ struct RenderEngineGlParams {
     /** Lights in the scene. More than five lights is an error. If no lights are
      defined, a single directional light, fixed to the camera frame, is used. */
     std::vector<render::LightParameter> lights;
+
+    /** (Advanced) The largest error, in pixels, that may be introduced by
+     drawing simplified versions (levels of detail) of geometries which appear
+     small in an image. Spheres, cylinders, and untextured .obj meshes with many
+     triangles are given simplified versions, which are drawn whenever the
+     largest distance between the simplified and full surfaces, projected into
+     the image, is at most this many pixels. Scenes with many distant meshes
+     render considerably faster with a value of around one pixel. Zero (the
+     default) always draws the full geometry, so that images do not depend on
+     the distance to the camera.  */
+    double lod_pixel_tolerance{0.0};
 };
 
 }  // namespace geometry
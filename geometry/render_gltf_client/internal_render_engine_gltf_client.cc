@@ -379,6 +379,10 @@ void RenderEngineGltfClient::DoRenderDepthImage(const DepthRenderCamera& camera,
     }
 }
 
+void RenderEngineGltfClient::DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) {
+    RenderEngine::DoRenderImages(requests);
+}
+
 void RenderEngineGltfClient::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
     const int64_t label_scene_id = GetNextSceneId();
 
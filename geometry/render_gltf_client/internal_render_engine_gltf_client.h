@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -73,6 +74,11 @@ private:
     void DoRenderLabelImage(const render::ColorRenderCamera& camera,
                             systems::sensors::ImageLabel16I* label_image_out) const override;
 
+    // Renders each image through the server in turn (as RenderEngine does by
+    // default), rather than with RenderEngineVtk's local batching.
+    // @see RenderEngine::DoRenderImages().
+    void DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) override;
+
     /* Exports the `RenderEngineVtk::pipelines_[image_type]` VTK scene to a
      glTF file given `export_path`. */
     void ExportScene(const std::string& export_path, render_vtk::internal::ImageType image_type) const;
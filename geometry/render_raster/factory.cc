@@ -0,0 +1,15 @@
+#include "geometry/render_raster/factory.h"
+
+#include <utility>
+
+#include "geometry/render_raster/internal_render_engine_raster.h"
+
+namespace drake {
+namespace geometry {
+
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRaster(RenderEngineRasterParams params) {
+    return std::make_unique<render_raster::internal::RenderEngineRaster>(std::move(params));
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+
+#include "geometry/render/render_engine.h"
+#include "geometry/render_raster/render_engine_raster_params.h"
+
+namespace drake {
+namespace geometry {
+
+/** Constructs a RenderEngine implementation which rasterizes images in
+ software, on the CPU. It requires no GPU, display, or OpenGL implementation,
+ which makes it well suited to headless machines (e.g., a cluster of
+ simulation hosts) where the other engines would have to fall back to a slow
+ software OpenGL driver.
+
+ The engine is optimized for depth and label images. Each image is divided into
+ tiles which are rasterized with SIMD instructions (chosen at runtime for the
+ host CPU), optionally in parallel (see RenderEngineRasterParams::num_threads),
+ and geometries outside of the camera's view are culled with a bounding volume
+ hierarchy before any of their triangles are considered.
+
+ Color images are supported, but with a simple lighting model: every geometry
+ is drawn with its (phong, diffuse) color (textures are ignored), lit by a
+ single directional light fixed to the camera. All geometries are treated as
+ opaque. Requests to show a window are ignored.
+
+ The engine does not support deformable geometries. Mesh and Convex shapes
+ must reference .obj files; Mesh shapes referencing any other file type are
+ ignored.
+
+ As with the other engines, a single %RenderEngineRaster should not be used in
+ multiple threads at the same time, but it and its clones can be.  */
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRaster(RenderEngineRasterParams params = {});
+
+}  // namespace geometry
+}  // namespace drake
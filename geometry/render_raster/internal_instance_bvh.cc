@@ -0,0 +1,118 @@
+#include "geometry/render_raster/internal_instance_bvh.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "common/drake_assert.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+
+using Eigen::Vector3d;
+using geometry::internal::Aabb;
+
+namespace {
+
+// The maximum number of instances in a leaf.
+constexpr int kLeafSize = 4;
+
+}  // namespace
+
+void InstanceBvh::Build(const std::vector<Aabb>& boxes) {
+    nodes_.clear();
+    order_.resize(boxes.size());
+    std::iota(order_.begin(), order_.end(), 0);
+    if (boxes.empty()) return;
+    nodes_.reserve(2 * boxes.size() / kLeafSize + 1);
+    nodes_.emplace_back();
+    BuildNode(0, boxes, 0, static_cast<int>(boxes.size()));
+}
+
+void InstanceBvh::BuildNode(int node_index, const std::vector<Aabb>& boxes, int begin, int end) {
+    Vector3d lower = Vector3d::Constant(std::numeric_limits<double>::infinity());
+    Vector3d upper = -lower;
+    for (int i = begin; i < end; ++i) {
+        lower = lower.cwiseMin(boxes[order_[i]].lower());
+        upper = upper.cwiseMax(boxes[order_[i]].upper());
+    }
+    nodes_[node_index].lower = lower;
+    nodes_[node_index].upper = upper;
+
+    if (end - begin <= kLeafSize) {
+        nodes_[node_index].begin = begin;
+        nodes_[node_index].count = end - begin;
+        return;
+    }
+
+    int axis{};
+    (upper - lower).maxCoeff(&axis);
+    const int mid = begin + (end - begin) / 2;
+    std::nth_element(order_.begin() + begin, order_.begin() + mid, order_.begin() + end, [&boxes, axis](int a, int b) {
+        return boxes[a].center()[axis] < boxes[b].center()[axis];
+    });
+
+    const int child = static_cast<int>(nodes_.size());
+    nodes_.resize(nodes_.size() + 2);
+    nodes_[node_index].begin = child;
+    nodes_[node_index].count = 0;
+    BuildNode(child, boxes, begin, mid);
+    BuildNode(child + 1, boxes, mid, end);
+}
+
+void InstanceBvh::Cull(const std::vector<Vector4<double>>& planes, std::vector<int>* visible) const {
+    DRAKE_DEMAND(visible != nullptr);
+    DRAKE_DEMAND(planes.size() <= 32);
+    if (nodes_.empty()) return;
+    const auto first = static_cast<std::ptrdiff_t>(visible->size());
+    CullNode(0, planes, 0, visible);
+    std::sort(visible->begin() + first, visible->end());
+}
+
+void InstanceBvh::CullNode(int node_index,
+                           const std::vector<Vector4<double>>& planes,
+                           unsigned int inside_mask,
+                           std::vector<int>* visible) const {
+    const Node& node = nodes_[node_index];
+    // Test the box against each plane it isn't already known to be inside of:
+    // it is outside of the plane if its corner farthest along the plane normal
+    // is, and inside if its nearest corner is. Children inherit the planes
+    // their parent is inside of.
+    for (int i = 0; i < static_cast<int>(planes.size()); ++i) {
+        const unsigned int bit = 1u << i;
+        if ((inside_mask & bit) != 0) continue;
+        const Vector3d n = planes[i].head<3>();
+        const double d = planes[i][3];
+        const Vector3d farthest = (n.array() >= 0).select(node.upper, node.lower);
+        if (n.dot(farthest) + d < 0) return;
+        const Vector3d nearest = (n.array() >= 0).select(node.lower, node.upper);
+        if (n.dot(nearest) + d >= 0) inside_mask |= bit;
+    }
+
+    const unsigned int all_inside = planes.size() == 32 ? ~0u : (1u << planes.size()) - 1;
+    if (inside_mask == all_inside) {
+        AddAll(node_index, visible);
+    } else if (node.count > 0) {
+        visible->insert(visible->end(), order_.begin() + node.begin, order_.begin() + node.begin + node.count);
+    } else {
+        CullNode(node.begin, planes, inside_mask, visible);
+        CullNode(node.begin + 1, planes, inside_mask, visible);
+    }
+}
+
+void InstanceBvh::AddAll(int node_index, std::vector<int>* visible) const {
+    const Node& node = nodes_[node_index];
+    if (node.count > 0) {
+        visible->insert(visible->end(), order_.begin() + node.begin, order_.begin() + node.begin + node.count);
+    } else {
+        AddAll(node.begin, visible);
+        AddAll(node.begin + 1, visible);
+    }
+}
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+
+#include "common/eigen_types.h"
+#include "geometry/proximity/aabb.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+
+/* A bounding volume hierarchy over the world-aligned bounding boxes of a set
+ of render instances, used to find the instances that may be visible to a
+ camera without testing each of them.
+
+ The hierarchy is built top down, splitting each node's boxes at the median of
+ their centers along the node's longest axis. It is rebuilt (rather than
+ refit) whenever the boxes change; for the few thousand instances of a typical
+ scene, the build takes a small fraction of the time spent rasterizing.  */
+class InstanceBvh {
+public:
+    InstanceBvh() = default;
+
+    /* Builds the hierarchy over the given boxes, replacing any previous one.
+     The box at index i represents the instance i.  */
+    void Build(const std::vector<geometry::internal::Aabb>& boxes);
+
+    /* Appends to `visible` the indices of the instances whose boxes lie at
+     least partially inside the convex region {p : n·p + d ≥ 0 for each plane
+     (n, d)} (e.g., a camera's view frustum, with the plane normals pointing
+     inward), in increasing order. Boxes that straddle a plane are reported
+     even if they are outside of the region's corners; this is conservative.  */
+    void Cull(const std::vector<Vector4<double>>& planes, std::vector<int>* visible) const;
+
+    int num_instances() const { return static_cast<int>(order_.size()); }
+
+private:
+    struct Node {
+        Vector3<double> lower;
+        Vector3<double> upper;
+        // For a leaf, the range [begin, begin + count) of order_; otherwise,
+        // count is zero and the children are at `begin` and `begin + 1`.
+        int begin{};
+        int count{};
+    };
+
+    // Fills in nodes_[node_index] (and its descendants) for the instances
+    // order_[begin, end).
+    void BuildNode(int node_index, const std::vector<geometry::internal::Aabb>& boxes, int begin, int end);
+
+    void CullNode(int node_index,
+                  const std::vector<Vector4<double>>& planes,
+                  unsigned int inside_mask,
+                  std::vector<int>* visible) const;
+
+    void AddAll(int node_index, std::vector<int>* visible) const;
+
+    std::vector<Node> nodes_;
+    // The instance indices, permuted so that each leaf's are contiguous.
+    std::vector<int> order_;
+};
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
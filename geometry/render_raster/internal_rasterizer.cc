@@ -0,0 +1,152 @@
+/* clang-format off to disable clang-format-includes */
+#include "geometry/render_raster/internal_rasterizer.h"
+/* clang-format on */
+
+#include <algorithm>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "geometry/render_raster/internal_rasterizer.cc"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+#pragma GCC diagnostic pop
+
+#include "common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+/* Each row of a triangle's pixels (within the tile) is processed a vector at a
+time, starting from the vector-aligned pixel at or before the triangle's first
+pixel. Capping the vector at 16 lanes means that the lanes always evenly divide
+kTileSize, so a vector never straddles two tiles (which are rasterized by
+different threads) and never runs past the padded end of the buffer's row. Any
+lanes outside the triangle's pixel range are rejected by its edge functions. */
+void RasterizeTileImpl(const ScreenTriangle* triangles,
+                       const int32_t* indices,
+                       int count,
+                       int tile_u,
+                       int tile_v,
+                       float inv_far,
+                       int width,
+                       int height,
+                       int stride,
+                       float* inv_depth,
+                       int32_t* ids) {
+    const hn::CappedTag<float, 16> df;
+    const hn::RebindToSigned<decltype(df)> di;
+    const int lanes = static_cast<int>(hn::Lanes(df));
+    static_assert(kTileSize % 16 == 0);
+
+    const int tile_u_end = std::min(tile_u + kTileSize, width);
+    const int tile_v_end = std::min(tile_v + kTileSize, height);
+    const auto center_offsets = hn::Add(hn::Iota(df, 0), hn::Set(df, 0.5f));
+    const auto zero = hn::Zero(df);
+    const auto min_inv_z = hn::Set(df, inv_far);
+
+    for (int k = 0; k < count; ++k) {
+        const ScreenTriangle& t = triangles[indices[k]];
+        const int u_begin = std::max(t.u_min, tile_u);
+        const int u_last = std::min(t.u_max, tile_u_end - 1);
+        const int v_begin = std::max(t.v_min, tile_v);
+        const int v_last = std::min(t.v_max, tile_v_end - 1);
+        if (u_begin > u_last || v_begin > v_last) continue;
+        const int u_aligned = tile_u + ((u_begin - tile_u) / lanes) * lanes;
+
+        const auto a0 = hn::Set(df, t.edge_a[0]);
+        const auto a1 = hn::Set(df, t.edge_a[1]);
+        const auto a2 = hn::Set(df, t.edge_a[2]);
+        const auto z_a = hn::Set(df, t.inv_z_a);
+        const auto id = hn::Set(di, t.id);
+
+        for (int v = v_begin; v <= v_last; ++v) {
+            const float y = static_cast<float>(v) + 0.5f;
+            // The edge functions and inverse depth at x = 0 in this row.
+            const auto r0 = hn::Set(df, t.edge_b[0] * y + t.edge_c[0]);
+            const auto r1 = hn::Set(df, t.edge_b[1] * y + t.edge_c[1]);
+            const auto r2 = hn::Set(df, t.edge_b[2] * y + t.edge_c[2]);
+            const auto r_z = hn::Set(df, t.inv_z_b * y + t.inv_z_c);
+            float* const depth_row = inv_depth + static_cast<size_t>(v) * stride;
+            int32_t* const id_row = ids + static_cast<size_t>(v) * stride;
+
+            for (int u = u_aligned; u <= u_last; u += lanes) {
+                const auto x = hn::Add(hn::Set(df, static_cast<float>(u)), center_offsets);
+                const auto e0 = hn::MulAdd(a0, x, r0);
+                const auto e1 = hn::MulAdd(a1, x, r1);
+                const auto e2 = hn::MulAdd(a2, x, r2);
+                const auto inside = hn::And(hn::And(hn::Ge(e0, zero), hn::Ge(e1, zero)), hn::Ge(e2, zero));
+                if (hn::AllFalse(df, inside)) continue;
+
+                const auto inv_z = hn::MulAdd(z_a, x, r_z);
+                const auto old_inv_z = hn::LoadU(df, depth_row + u);
+                const auto nearer =
+                        hn::And(inside, hn::And(hn::Gt(inv_z, old_inv_z), hn::Ge(inv_z, min_inv_z)));
+                if (hn::AllFalse(df, nearer)) continue;
+
+                hn::StoreU(hn::IfThenElse(nearer, inv_z, old_inv_z), df, depth_row + u);
+                const auto old_id = hn::LoadU(di, id_row + u);
+                hn::StoreU(hn::IfThenElse(hn::RebindMask(di, nearer), id, old_id), di, id_row + u);
+            }
+        }
+    }
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(RasterizeTileImpl);
+struct ChooseBestRasterizeTile {
+    auto operator()() { return HWY_DYNAMIC_POINTER(RasterizeTileImpl); }
+};
+
+}  // namespace
+
+void VisibilityBuffer::Reset(int width_in, int height_in) {
+    width = width_in;
+    height = height_in;
+    stride = (width + kTileSize - 1) / kTileSize * kTileSize;
+    const size_t size = static_cast<size_t>(stride) * height;
+    inv_depth.assign(size, 0.0f);
+    ids.assign(size, -1);
+}
+
+void RasterizeTile(const ScreenTriangle* triangles,
+                   const int32_t* indices,
+                   int count,
+                   int tile_u,
+                   int tile_v,
+                   float inv_far,
+                   VisibilityBuffer* buffer) {
+    LateBoundFunction<ChooseBestRasterizeTile>::Call(triangles, indices, count, tile_u, tile_v, inv_far,
+                                                     buffer->width, buffer->height, buffer->stride,
+                                                     buffer->inv_depth.data(), buffer->ids.data());
+}
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
+#endif  // HWY_ONCE
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+
+/* The edge length (in pixels) of the square tiles into which an image is
+ divided for rasterization. Tiles are the unit of parallelism: each one is
+ rasterized by a single thread, from the list of triangles that overlap it. */
+constexpr int kTileSize = 64;
+
+/* A triangle that has been projected into the image and set up for
+ rasterization.
+
+ For the pixel whose center is at (x, y) (i.e., the pixel (u, v) has its center
+ at (u + 0.5, v + 0.5)), the pixel lies inside the triangle if all three edge
+ functions eᵢ(x, y) = edge_a[i] * x + edge_b[i] * y + edge_c[i] are
+ non-negative. The inverse depth 1/z of the triangle at the pixel is
+ inv_z_a * x + inv_z_b * y + inv_z_c; unlike z itself, it is linear in the
+ image. */
+struct ScreenTriangle {
+    float edge_a[3];
+    float edge_b[3];
+    float edge_c[3];
+    float inv_z_a;
+    float inv_z_b;
+    float inv_z_c;
+    /* The inclusive range of pixels that may lie in the triangle, clipped to
+     the image. */
+    int u_min;
+    int u_max;
+    int v_min;
+    int v_max;
+    /* The value written to VisibilityBuffer::ids for the pixels the triangle
+     covers. */
+    int32_t id;
+};
+
+/* The result of rasterizing a scene: for each pixel, the inverse depth of the
+ nearest surface (or zero if the pixel is empty) and the ScreenTriangle::id of
+ the triangle it belongs to (or -1). Pixel (u, v) is at index v * stride + u;
+ the rows are padded to a multiple of kTileSize. */
+struct VisibilityBuffer {
+    /* Resizes the buffer for an image of the given size and clears it. The
+     storage is reused when the buffer is already large enough. */
+    void Reset(int width_in, int height_in);
+
+    int width{};
+    int height{};
+    int stride{};
+    std::vector<float> inv_depth;
+    std::vector<int32_t> ids;
+};
+
+/* Rasterizes the triangles `triangles[indices[k]]` for k in [0, count) into
+ the tile whose first pixel is (tile_u, tile_v) in `buffer`, keeping for each
+ pixel the nearest triangle (i.e., the one with the greatest 1/z) that is no
+ farther than 1/inv_far. Triangles are drawn in order; when two triangles are
+ equally near a pixel, the first one is kept.
+
+ The pixels of each tile row are processed a vector at a time with SIMD
+ instructions, chosen at runtime for the host CPU.
+
+ @pre `tile_u` and `tile_v` are multiples of kTileSize and lie in `buffer`.
+ @pre Each of the triangles' pixel ranges lies in the image. */
+void RasterizeTile(const ScreenTriangle* triangles,
+                   const int32_t* indices,
+                   int count,
+                   int tile_u,
+                   int tile_v,
+                   float inv_far,
+                   VisibilityBuffer* buffer);
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
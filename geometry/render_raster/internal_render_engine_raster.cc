@@ -0,0 +1,704 @@
+#include "geometry/render_raster/internal_render_engine_raster.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "common/diagnostic_policy.h"
+#include "common/text_logging.h"
+#include "geometry/proximity/make_box_mesh.h"
+#include "geometry/proximity/make_capsule_mesh.h"
+#include "geometry/proximity/make_cylinder_mesh.h"
+#include "geometry/proximity/make_sphere_mesh.h"
+#include "geometry/proximity/polygon_to_triangle_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+
+using Eigen::Matrix3f;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using Eigen::Vector4d;
+using geometry::internal::Aabb;
+using geometry::internal::LoadRenderMeshesFromObj;
+using geometry::internal::RenderMesh;
+using math::RigidTransformd;
+using render::ColorRenderCamera;
+using render::DepthRenderCamera;
+using render::ImageRenderRequest;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using std::shared_ptr;
+using std::vector;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+namespace {
+
+// The resolution hint for the canonical unit sphere and cylinder. It gives
+// about 2000 triangles for the sphere: finer than the pixels of most images of
+// a typical robot scene, and coarse enough that projecting them isn't the
+// bottleneck.
+constexpr double kUnitResolutionHint = 0.125;
+
+// The number of pixels beyond the edges of the image within which projected
+// triangles aren't clipped. Clipping the rare triangles that extend beyond this
+// band keeps the projected coordinates (and so the precision of the edge
+// functions) bounded.
+constexpr double kGuardBand = 4096;
+
+// The most vertices a triangle can have after being clipped by the near plane
+// and the four guard band planes.
+constexpr int kMaxClippedVertices = 8;
+
+// A vertex of a polygon being clipped.
+using ClipPolygon = std::array<Vector3f, kMaxClippedVertices>;
+
+// Clips the convex polygon with vertices `in[0, in_count)` to the half space
+// {p : n·p + d ≥ 0}, writing the vertices of the result to `out`. Returns the
+// number of vertices written.
+int ClipPolygonToPlane(const ClipPolygon& in, int in_count, const Vector3f& n, float d, ClipPolygon* out) {
+    int out_count = 0;
+    for (int i = 0; i < in_count; ++i) {
+        const Vector3f& a = in[i];
+        const Vector3f& b = in[(i + 1) % in_count];
+        const float s_a = n.dot(a) + d;
+        const float s_b = n.dot(b) + d;
+        if (s_a >= 0) {
+            (*out)[out_count++] = a;
+        }
+        if ((s_a >= 0) != (s_b >= 0)) {
+            (*out)[out_count++] = a + (s_a / (s_a - s_b)) * (b - a);
+        }
+    }
+    return out_count;
+}
+
+// The properties of a camera needed to project points into its image.
+struct Projection {
+    explicit Projection(const RenderCameraCore& core)
+            : width(core.intrinsics().width()),
+              height(core.intrinsics().height()),
+              focal_x(core.intrinsics().focal_x()),
+              focal_y(core.intrinsics().focal_y()),
+              center_x(core.intrinsics().center_x()),
+              center_y(core.intrinsics().center_y()),
+              near(core.clipping().near()),
+              far(core.clipping().far()) {}
+
+    int width;
+    int height;
+    double focal_x;
+    double focal_y;
+    double center_x;
+    double center_y;
+    double near;
+    double far;
+};
+
+// Appends to `triangles` the set up for the triangle with the given image
+// coordinates (x, y) and inverse depths, if it covers any pixel centers.
+// Returns true if it was appended.
+bool AddScreenTriangle(const std::array<double, 3>& x,
+                       const std::array<double, 3>& y,
+                       const std::array<double, 3>& inv_z,
+                       int32_t id,
+                       const Projection& projection,
+                       vector<ScreenTriangle>* triangles) {
+    // Twice the signed area; its sign gives the winding in the image.
+    const double area2 = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (!(std::abs(area2) > 1e-12)) return false;
+
+    // The range of pixels whose centers (at u + 0.5, v + 0.5) can be inside.
+    const auto [x_min, x_max] = std::minmax({x[0], x[1], x[2]});
+    const auto [y_min, y_max] = std::minmax({y[0], y[1], y[2]});
+    const int u_min = std::max(0, static_cast<int>(std::ceil(x_min - 0.5)));
+    const int u_max = std::min(projection.width - 1, static_cast<int>(std::floor(x_max - 0.5)));
+    const int v_min = std::max(0, static_cast<int>(std::ceil(y_min - 0.5)));
+    const int v_max = std::min(projection.height - 1, static_cast<int>(std::floor(y_max - 0.5)));
+    if (u_min > u_max || v_min > v_max) return false;
+
+    ScreenTriangle t;
+    t.u_min = u_min;
+    t.u_max = u_max;
+    t.v_min = v_min;
+    t.v_max = v_max;
+    t.id = id;
+    // The edge function of the edge opposite vertex k is zero on the edge and
+    // area2 at vertex k; dividing by area2 gives vertex k's barycentric
+    // coordinate, which we scale by |area2| so that it's positive inside.
+    const double sign = area2 > 0 ? 1.0 : -1.0;
+    double z_a = 0, z_b = 0, z_c = 0;
+    for (int k = 0; k < 3; ++k) {
+        const int i = (k + 1) % 3;
+        const int j = (k + 2) % 3;
+        const double a = -(y[j] - y[i]) * sign;
+        const double b = (x[j] - x[i]) * sign;
+        const double c = ((y[j] - y[i]) * x[i] - (x[j] - x[i]) * y[i]) * sign;
+        t.edge_a[k] = static_cast<float>(a);
+        t.edge_b[k] = static_cast<float>(b);
+        t.edge_c[k] = static_cast<float>(c);
+        const double weight = inv_z[k] / std::abs(area2);
+        z_a += a * weight;
+        z_b += b * weight;
+        z_c += c * weight;
+    }
+    t.inv_z_a = static_cast<float>(z_a);
+    t.inv_z_b = static_cast<float>(z_b);
+    t.inv_z_c = static_cast<float>(z_c);
+    triangles->push_back(t);
+    return true;
+}
+
+// Reports whether images rendered by the two cameras would have identical
+// visibility buffers (when posed identically).
+bool HaveSameRaster(const RenderCameraCore& a, const RenderCameraCore& b) {
+    const CameraInfo& i_a = a.intrinsics();
+    const CameraInfo& i_b = b.intrinsics();
+    return i_a.width() == i_b.width() && i_a.height() == i_b.height() && i_a.focal_x() == i_b.focal_x() &&
+           i_a.focal_y() == i_b.focal_y() && i_a.center_x() == i_b.center_x() && i_a.center_y() == i_b.center_y() &&
+           a.clipping().near() == b.clipping().near() && a.clipping().far() == b.clipping().far();
+}
+
+void WarnIfShowWindow(const ColorRenderCamera& camera) {
+    if (camera.show_window()) {
+        static const logging::Warn one_time("RenderEngineRaster is headless; requests to show a window are ignored.");
+    }
+}
+
+uint8_t ToByte(double value) {
+    return static_cast<uint8_t>(std::clamp(value, 0.0, 1.0) * 255 + 0.5);
+}
+
+}  // namespace
+
+shared_ptr<const RasterMesh> RasterMesh::Make(const TriangleSurfaceMesh<double>& mesh) {
+    auto result = std::make_shared<RasterMesh>();
+    result->vertices.reserve(mesh.num_vertices());
+    for (int v = 0; v < mesh.num_vertices(); ++v) {
+        result->vertices.push_back(mesh.vertex(v).cast<float>());
+    }
+    result->triangles.reserve(mesh.num_elements());
+    for (const auto& element : mesh.triangles()) {
+        result->triangles.emplace_back(element.vertex(0), element.vertex(1), element.vertex(2));
+    }
+    result->lower = Vector3d::Constant(std::numeric_limits<double>::infinity());
+    result->upper = -result->lower;
+    for (int v = 0; v < mesh.num_vertices(); ++v) {
+        result->lower = result->lower.cwiseMin(mesh.vertex(v));
+        result->upper = result->upper.cwiseMax(mesh.vertex(v));
+    }
+    return result;
+}
+
+shared_ptr<const RasterMesh> RasterMesh::Make(const RenderMesh& mesh) {
+    auto result = std::make_shared<RasterMesh>();
+    result->vertices.reserve(mesh.positions.rows());
+    for (int v = 0; v < mesh.positions.rows(); ++v) {
+        result->vertices.push_back(mesh.positions.row(v).transpose().cast<float>());
+    }
+    result->triangles.reserve(mesh.indices.rows());
+    for (int t = 0; t < mesh.indices.rows(); ++t) {
+        result->triangles.push_back(mesh.indices.row(t).transpose().cast<int>());
+    }
+    result->lower = mesh.positions.colwise().minCoeff().transpose();
+    result->upper = mesh.positions.colwise().maxCoeff().transpose();
+    return result;
+}
+
+RenderEngineRaster::RenderEngineRaster(RenderEngineRasterParams params)
+    : RenderEngine(RenderLabel::kDontCare), parameters_(std::move(params)) {
+    DRAKE_THROW_UNLESS(parameters_.num_threads >= 1);
+}
+
+RenderEngineRaster::~RenderEngineRaster() = default;
+
+void RenderEngineRaster::UpdateViewpoint(const RigidTransformd& X_WR) {
+    X_WC_ = X_WR;
+}
+
+void RenderEngineRaster::ImplementGeometry(const Box& box, void* user_data) {
+    AddInstance(GetBox(), Vector3d(box.width(), box.depth(), box.height()), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const Capsule& capsule, void* user_data) {
+    // Each capsule is unique; it can't be realized by scaling a canonical one.
+    const double resolution_hint = kUnitResolutionHint * capsule.radius();
+    AddInstance(RasterMesh::Make(geometry::internal::MakeCapsuleSurfaceMesh<double>(capsule, resolution_hint)),
+                Vector3d::Ones(), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const Convex& convex, void* user_data) {
+    const std::string key = "convex?" + convex.filename();
+    if (!file_meshes_.contains(key)) {
+        const Convex unit_convex(convex.filename(), 1.0);
+        const TriangleSurfaceMesh<double> hull =
+                geometry::internal::MakeTriangleFromPolygonMesh(unit_convex.GetConvexHull());
+        file_meshes_[key] = {{.mesh = RasterMesh::Make(hull), .diffuse = std::nullopt}};
+    }
+    AddInstance(file_meshes_.at(key)[0].mesh, Vector3d::Constant(convex.scale()), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const Cylinder& cylinder, void* user_data) {
+    const double r = cylinder.radius();
+    AddInstance(GetCylinder(), Vector3d(r, r, cylinder.length()), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) {
+    AddInstance(GetSphere(), Vector3d(ellipsoid.a(), ellipsoid.b(), ellipsoid.c()), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const HalfSpace&, void* user_data) {
+    AddInstance(GetHalfSpace(), Vector3d::Ones(), user_data);
+}
+
+void RenderEngineRaster::ImplementGeometry(const Mesh& mesh, void* user_data) {
+    RegistrationData* data = static_cast<RegistrationData*>(user_data);
+    if (mesh.extension() != ".obj") {
+        static const logging::Warn one_time(
+                "RenderEngineRaster only supports Mesh specifications which use "
+                ".obj files. Mesh specifications using other mesh types "
+                "(e.g., .gltf, .stl, .dae, etc.) will be ignored.");
+        data->accepted = false;
+        return;
+    }
+    const std::string key = "mesh?" + mesh.filename();
+    if (!file_meshes_.contains(key)) {
+        // As in RenderEngineGl, only the materials defined by the file are kept;
+        // the others come from each instance's properties.
+        vector<FileMesh> file_meshes;
+        for (const RenderMesh& render_mesh : LoadRenderMeshesFromObj(
+                     mesh.filename(), PerceptionProperties(), parameters_.default_diffuse,
+                     drake::internal::DiagnosticPolicy())) {
+            std::optional<Rgba> diffuse;
+            if (render_mesh.material.has_value() && render_mesh.material->from_mesh_file) {
+                diffuse = render_mesh.material->diffuse;
+            }
+            file_meshes.push_back({.mesh = RasterMesh::Make(render_mesh), .diffuse = diffuse});
+        }
+        file_meshes_[key] = std::move(file_meshes);
+    }
+    for (const FileMesh& file_mesh : file_meshes_.at(key)) {
+        AddInstance(file_mesh.mesh, Vector3d::Constant(mesh.scale()), user_data, file_mesh.diffuse);
+    }
+}
+
+void RenderEngineRaster::ImplementGeometry(const Sphere& sphere, void* user_data) {
+    const double r = sphere.radius();
+    AddInstance(GetSphere(), Vector3d(r, r, r), user_data);
+}
+
+bool RenderEngineRaster::DoRegisterVisual(GeometryId id,
+                                          const Shape& shape,
+                                          const PerceptionProperties& properties,
+                                          const RigidTransformd& X_WG) {
+    RegistrationData data{.id = id, .X_WG = X_WG, .properties = properties};
+    shape.Reify(this, &data);
+    return data.accepted;
+}
+
+void RenderEngineRaster::DoUpdateVisualPose(GeometryId id, const RigidTransformd& X_WG) {
+    for (Instance& instance : visuals_.at(id)) {
+        instance.X_WG = X_WG;
+    }
+    culling_hierarchy_valid_ = false;
+}
+
+bool RenderEngineRaster::DoRemoveGeometry(GeometryId id) {
+    if (visuals_.erase(id) == 0) {
+        return false;
+    }
+    culling_hierarchy_valid_ = false;
+    return true;
+}
+
+std::unique_ptr<RenderEngine> RenderEngineRaster::DoClone() const {
+    return std::unique_ptr<RenderEngineRaster>(new RenderEngineRaster(*this));
+}
+
+void RenderEngineRaster::DoRenderColorImage(const ColorRenderCamera& camera, ImageRgba8U* color_image_out) const {
+    WarnIfShowWindow(camera);
+    Rasterize(camera.core(), X_WC_);
+    ResolveColorImage(camera, color_image_out);
+}
+
+void RenderEngineRaster::DoRenderDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
+    Rasterize(camera.core(), X_WC_);
+    ResolveDepthImage(camera, depth_image_out);
+}
+
+void RenderEngineRaster::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
+    WarnIfShowWindow(camera);
+    Rasterize(camera.core(), X_WC_);
+    ResolveLabelImage(label_image_out);
+}
+
+void RenderEngineRaster::DoRenderImages(const vector<ImageRenderRequest>& requests) {
+    for (const ImageRenderRequest& request : requests) {
+        // The color and label images come from the same rasterization; so does
+        // the depth image, if the depth camera sees exactly what the color
+        // camera does.
+        std::optional<RigidTransformd> X_WC;
+        if (request.color_image != nullptr || request.label_image != nullptr) {
+            WarnIfShowWindow(*request.color_camera);
+            X_WC = request.X_WB * request.color_camera->core().sensor_pose_in_camera_body();
+            Rasterize(request.color_camera->core(), *X_WC);
+            if (request.color_image != nullptr) {
+                ResolveColorImage(*request.color_camera, request.color_image);
+            }
+            if (request.label_image != nullptr) {
+                ResolveLabelImage(request.label_image);
+            }
+        }
+        if (request.depth_image != nullptr) {
+            const RigidTransformd X_WD = request.X_WB * request.depth_camera->core().sensor_pose_in_camera_body();
+            if (!X_WC.has_value() || !X_WD.IsExactlyEqualTo(*X_WC) ||
+                !HaveSameRaster(request.color_camera->core(), request.depth_camera->core())) {
+                Rasterize(request.depth_camera->core(), X_WD);
+            }
+            ResolveDepthImage(*request.depth_camera, request.depth_image);
+        }
+    }
+}
+
+void RenderEngineRaster::AddInstance(shared_ptr<const RasterMesh> mesh,
+                                     const Vector3d& scale,
+                                     void* user_data,
+                                     const std::optional<Rgba>& diffuse) {
+    const RegistrationData& data = *static_cast<RegistrationData*>(user_data);
+    const RenderLabel label = GetRenderLabelOrThrow(data.properties);
+    const Rgba color = diffuse.has_value() ? *diffuse
+                                           : data.properties.GetPropertyOrDefault("phong", "diffuse",
+                                                                                  parameters_.default_diffuse);
+    visuals_[data.id].push_back(
+            {.mesh = std::move(mesh), .scale = scale, .X_WG = data.X_WG, .label = label, .diffuse = color});
+    culling_hierarchy_valid_ = false;
+}
+
+shared_ptr<const RasterMesh> RenderEngineRaster::GetSphere() {
+    if (sphere_ == nullptr) {
+        sphere_ = RasterMesh::Make(geometry::internal::MakeSphereSurfaceMesh<double>(Sphere(1.0), kUnitResolutionHint));
+    }
+    return sphere_;
+}
+
+shared_ptr<const RasterMesh> RenderEngineRaster::GetCylinder() {
+    if (cylinder_ == nullptr) {
+        cylinder_ = RasterMesh::Make(
+                geometry::internal::MakeCylinderSurfaceMesh<double>(Cylinder(1.0, 1.0), kUnitResolutionHint));
+    }
+    return cylinder_;
+}
+
+shared_ptr<const RasterMesh> RenderEngineRaster::GetBox() {
+    if (box_ == nullptr) {
+        // The coarsest box mesh: two triangles per face.
+        box_ = RasterMesh::Make(geometry::internal::MakeBoxSurfaceMesh<double>(Box(1.0, 1.0, 1.0), 1.0));
+    }
+    return box_;
+}
+
+shared_ptr<const RasterMesh> RenderEngineRaster::GetHalfSpace() {
+    if (half_space_ == nullptr) {
+        // This matches the size of the RenderEngineVtk and RenderEngineGl half
+        // spaces: a square, 100 units on a side, centered on the origin of its
+        // frame and facing +z.
+        const double kHalfMeasure = 50.0;
+        vector<Vector3d> vertices{{-kHalfMeasure, -kHalfMeasure, 0},
+                                  {kHalfMeasure, -kHalfMeasure, 0},
+                                  {kHalfMeasure, kHalfMeasure, 0},
+                                  {-kHalfMeasure, kHalfMeasure, 0}};
+        vector<SurfaceTriangle> triangles{{0, 1, 2}, {0, 2, 3}};
+        half_space_ = RasterMesh::Make(TriangleSurfaceMesh<double>(std::move(triangles), std::move(vertices)));
+    }
+    return half_space_;
+}
+
+void RenderEngineRaster::UpdateCullingHierarchy() const {
+    if (culling_hierarchy_valid_) return;
+    flat_instances_.clear();
+    vector<Aabb> boxes;
+    for (const auto& [id, instances] : visuals_) {
+        for (const Instance& instance : instances) {
+            flat_instances_.push_back(&instance);
+            // The mesh's box, scaled into G and then bounded in W.
+            const Vector3d a = instance.scale.cwiseProduct(instance.mesh->lower);
+            const Vector3d b = instance.scale.cwiseProduct(instance.mesh->upper);
+            const Vector3d p_GoBo = (a + b) / 2;
+            const Vector3d half_width_G = (a - b).cwiseAbs() / 2;
+            const Vector3d half_width_W = instance.X_WG.rotation().matrix().cwiseAbs() * half_width_G;
+            boxes.emplace_back(instance.X_WG * p_GoBo, half_width_W);
+        }
+    }
+    culling_hierarchy_.Build(boxes);
+    culling_hierarchy_valid_ = true;
+}
+
+void RenderEngineRaster::Rasterize(const RenderCameraCore& core, const RigidTransformd& X_WC) const {
+    UpdateCullingHierarchy();
+    const Projection projection(core);
+    const RigidTransformd X_CW = X_WC.inverse();
+
+    // The view frustum's planes, with inward normals, measured and expressed
+    // in C and then in W: n_C·p_C + d ≥ 0 ⇔ n_W·p_W + (n_C·p_CW + d) ≥ 0.
+    const double w = projection.width;
+    const double h = projection.height;
+    const double fx = projection.focal_x;
+    const double fy = projection.focal_y;
+    const double cx = projection.center_x;
+    const double cy = projection.center_y;
+    const std::array<Vector4d, 6> planes_C{Vector4d(0, 0, 1, -projection.near), Vector4d(0, 0, -1, projection.far),
+                                           Vector4d(fx, 0, cx, 0),              Vector4d(-fx, 0, w - cx, 0),
+                                           Vector4d(0, fy, cy, 0),              Vector4d(0, -fy, h - cy, 0)};
+    vector<Vector4d> planes_W;
+    for (const Vector4d& plane_C : planes_C) {
+        const Vector3d n_C = plane_C.head<3>();
+        const Vector3d n_W = X_WC.rotation() * n_C;
+        planes_W.emplace_back(n_W.x(), n_W.y(), n_W.z(), n_C.dot(X_CW.translation()) + plane_C[3]);
+    }
+    visible_.clear();
+    culling_hierarchy_.Cull(planes_W, &visible_);
+
+    // Project the visible instances' triangles. Each thread takes a contiguous
+    // block of the instances so that, once the blocks are concatenated, the
+    // triangles are in the same order for any number of threads.
+    const int num_visible = static_cast<int>(visible_.size());
+    const int num_threads = std::max(1, std::min(parameters_.num_threads, num_visible));
+    thread_scratch_.resize(num_threads);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (int t = 0; t < num_threads; ++t) {
+        ThreadScratch& scratch = thread_scratch_[t];
+        scratch.triangles.clear();
+        scratch.records.clear();
+        const int begin = static_cast<int>(static_cast<int64_t>(num_visible) * t / num_threads);
+        const int end = static_cast<int>(static_cast<int64_t>(num_visible) * (t + 1) / num_threads);
+        for (int i = begin; i < end; ++i) {
+            ProjectInstance(visible_[i], X_CW, core, &scratch);
+        }
+    }
+    triangles_.clear();
+    records_.clear();
+    for (int t = 0; t < num_threads; ++t) {
+        const auto offset = static_cast<int32_t>(records_.size());
+        const ThreadScratch& scratch = thread_scratch_[t];
+        records_.insert(records_.end(), scratch.records.begin(), scratch.records.end());
+        const size_t first = triangles_.size();
+        triangles_.insert(triangles_.end(), scratch.triangles.begin(), scratch.triangles.end());
+        for (size_t i = first; i < triangles_.size(); ++i) {
+            triangles_[i].id += offset;
+        }
+    }
+
+    // Bin the triangles into the tiles they overlap.
+    const int tiles_u = (projection.width + kTileSize - 1) / kTileSize;
+    const int tiles_v = (projection.height + kTileSize - 1) / kTileSize;
+    tile_bins_.resize(tiles_u * tiles_v);
+    for (auto& bin : tile_bins_) {
+        bin.clear();
+    }
+    for (int i = 0; i < static_cast<int>(triangles_.size()); ++i) {
+        const ScreenTriangle& triangle = triangles_[i];
+        for (int tile_v = triangle.v_min / kTileSize; tile_v <= triangle.v_max / kTileSize; ++tile_v) {
+            for (int tile_u = triangle.u_min / kTileSize; tile_u <= triangle.u_max / kTileSize; ++tile_u) {
+                tile_bins_[tile_v * tiles_u + tile_u].push_back(i);
+            }
+        }
+    }
+
+    // Rasterize the tiles.
+    visibility_.Reset(projection.width, projection.height);
+    const float inv_far = static_cast<float>(1.0 / projection.far);
+    const int num_tiles = tiles_u * tiles_v;
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) num_threads(parameters_.num_threads)
+#endif
+    for (int tile = 0; tile < num_tiles; ++tile) {
+        const vector<int32_t>& bin = tile_bins_[tile];
+        if (bin.empty()) continue;
+        RasterizeTile(triangles_.data(), bin.data(), static_cast<int>(bin.size()), (tile % tiles_u) * kTileSize,
+                      (tile / tiles_u) * kTileSize, inv_far, &visibility_);
+    }
+}
+
+void RenderEngineRaster::ProjectInstance(int instance_index,
+                                         const RigidTransformd& X_CW,
+                                         const RenderCameraCore& core,
+                                         ThreadScratch* scratch) const {
+    const Instance& instance = *flat_instances_[instance_index];
+    const RasterMesh& mesh = *instance.mesh;
+    const Projection projection(core);
+    const float near = static_cast<float>(projection.near);
+    const float far = static_cast<float>(projection.far);
+
+    // Transform the vertices from the mesh frame M to the camera frame C.
+    const RigidTransformd X_CG = X_CW * instance.X_WG;
+    const Matrix3f A_CM = (X_CG.rotation().matrix() * instance.scale.asDiagonal()).cast<float>();
+    const Vector3f p_CG = X_CG.translation().cast<float>();
+    vector<Vector3f>& p_CVs = scratch->p_CVs;
+    p_CVs.resize(mesh.vertices.size());
+    for (size_t v = 0; v < mesh.vertices.size(); ++v) {
+        p_CVs[v] = A_CM * mesh.vertices[v] + p_CG;
+    }
+    // A negative scale mirrors the mesh, reversing its triangles' winding.
+    const float winding = instance.scale.prod() < 0 ? -1.0f : 1.0f;
+
+    const double u_low = -kGuardBand;
+    const double u_high = projection.width + kGuardBand;
+    const double v_low = -kGuardBand;
+    const double v_high = projection.height + kGuardBand;
+    // The guard band's planes in C (through Co, with inward normals).
+    const std::array<Vector3f, 4> guard_band_normals{
+            Vector3d(projection.focal_x, 0, projection.center_x - u_low).cast<float>(),
+            Vector3d(-projection.focal_x, 0, u_high - projection.center_x).cast<float>(),
+            Vector3d(0, projection.focal_y, projection.center_y - v_low).cast<float>(),
+            Vector3d(0, -projection.focal_y, v_high - projection.center_y).cast<float>()};
+
+    auto project = [&projection](const Vector3f& p_CV, double* x, double* y, double* inv_z) {
+        *inv_z = 1.0 / p_CV.z();
+        *x = projection.focal_x * p_CV.x() * *inv_z + projection.center_x;
+        *y = projection.focal_y * p_CV.y() * *inv_z + projection.center_y;
+    };
+
+    // Project the vertices, marking those which aren't in front of the near
+    // plane and within the guard band (and whose triangles must be clipped)
+    // with NaN.
+    vector<Vector3d>& p_IVs = scratch->p_IVs;
+    p_IVs.resize(mesh.vertices.size());
+    for (size_t v = 0; v < mesh.vertices.size(); ++v) {
+        Vector3d& q = p_IVs[v];
+        if (p_CVs[v].z() < near) {
+            q.x() = std::numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+        project(p_CVs[v], &q.x(), &q.y(), &q.z());
+        if (q.x() < u_low || q.x() > u_high || q.y() < v_low || q.y() > v_high) {
+            q.x() = std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+    for (const Vector3<int>& triangle : mesh.triangles) {
+        const Vector3f& p0 = p_CVs[triangle[0]];
+        const Vector3f& p1 = p_CVs[triangle[1]];
+        const Vector3f& p2 = p_CVs[triangle[2]];
+        if (p0.z() < near && p1.z() < near && p2.z() < near) continue;
+        if (p0.z() > far && p1.z() > far && p2.z() > far) continue;
+        // Cull the triangles facing away from the camera (at Co).
+        const Vector3f n_C = winding * (p1 - p0).cross(p2 - p0);
+        if (n_C.dot(p0) >= 0) continue;
+
+        const auto id = static_cast<int32_t>(scratch->records.size());
+        bool added = false;
+        std::array<double, 3> x, y, inv_z;
+        const Vector3d& q0 = p_IVs[triangle[0]];
+        const Vector3d& q1 = p_IVs[triangle[1]];
+        const Vector3d& q2 = p_IVs[triangle[2]];
+        if (!std::isnan(q0.x()) && !std::isnan(q1.x()) && !std::isnan(q2.x())) {
+            x = {q0.x(), q1.x(), q2.x()};
+            y = {q0.y(), q1.y(), q2.y()};
+            inv_z = {q0.z(), q1.z(), q2.z()};
+            added = AddScreenTriangle(x, y, inv_z, id, projection, &scratch->triangles);
+        } else {
+            ClipPolygon polygon{p0, p1, p2};
+            ClipPolygon clipped;
+            int count = ClipPolygonToPlane(polygon, 3, Vector3f::UnitZ(), -near, &clipped);
+            for (const Vector3f& normal : guard_band_normals) {
+                std::swap(polygon, clipped);
+                count = ClipPolygonToPlane(polygon, count, normal, 0.0f, &clipped);
+            }
+            // Triangulate the clipped (convex) polygon as a fan.
+            for (int k = 1; k + 1 < count; ++k) {
+                project(clipped[0], &x[0], &y[0], &inv_z[0]);
+                project(clipped[k], &x[1], &y[1], &inv_z[1]);
+                project(clipped[k + 1], &x[2], &y[2], &inv_z[2]);
+                added = AddScreenTriangle(x, y, inv_z, id, projection, &scratch->triangles) || added;
+            }
+        }
+        if (added) {
+            scratch->records.push_back({.instance = instance_index, .n_C = n_C.normalized()});
+        }
+    }
+}
+
+void RenderEngineRaster::ResolveColorImage(const ColorRenderCamera& camera, ImageRgba8U* color_image) const {
+    const Rgba& clear = parameters_.default_clear_color;
+    const std::array<uint8_t, 4> background{ToByte(clear.r()), ToByte(clear.g()), ToByte(clear.b()),
+                                            ToByte(clear.a())};
+    const VisibilityBuffer& buffer = visibility_;
+    DRAKE_DEMAND(buffer.width == camera.core().intrinsics().width());
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parameters_.num_threads)
+#endif
+    for (int v = 0; v < buffer.height; ++v) {
+        const int32_t* ids = buffer.ids.data() + static_cast<size_t>(v) * buffer.stride;
+        for (int u = 0; u < buffer.width; ++u) {
+            uint8_t* pixel = color_image->at(u, v);
+            if (ids[u] < 0) {
+                std::copy(background.begin(), background.end(), pixel);
+                continue;
+            }
+            // A directional light shining along Cz (a "head lamp").
+            const TriangleRecord& record = records_[ids[u]];
+            const Rgba& diffuse = flat_instances_[record.instance]->diffuse;
+            const double intensity = std::max(0.0f, -record.n_C.z());
+            pixel[0] = ToByte(diffuse.r() * intensity);
+            pixel[1] = ToByte(diffuse.g() * intensity);
+            pixel[2] = ToByte(diffuse.b() * intensity);
+            pixel[3] = 255;
+        }
+    }
+}
+
+void RenderEngineRaster::ResolveDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image) const {
+    using Traits = ImageTraits<PixelType::kDepth32F>;
+    const float min_depth = static_cast<float>(camera.depth_range().min_depth());
+    const float max_depth = static_cast<float>(camera.depth_range().max_depth());
+    const VisibilityBuffer& buffer = visibility_;
+    DRAKE_DEMAND(buffer.width == camera.core().intrinsics().width());
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parameters_.num_threads)
+#endif
+    for (int v = 0; v < buffer.height; ++v) {
+        const float* inv_depth = buffer.inv_depth.data() + static_cast<size_t>(v) * buffer.stride;
+        float* row = depth_image->at(0, v);
+        for (int u = 0; u < buffer.width; ++u) {
+            if (inv_depth[u] <= 0) {
+                row[u] = Traits::kTooFar;
+                continue;
+            }
+            const float depth = 1.0f / inv_depth[u];
+            row[u] = depth < min_depth ? Traits::kTooClose : (depth > max_depth ? Traits::kTooFar : depth);
+        }
+    }
+}
+
+void RenderEngineRaster::ResolveLabelImage(ImageLabel16I* label_image) const {
+    const VisibilityBuffer& buffer = visibility_;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parameters_.num_threads)
+#endif
+    for (int v = 0; v < buffer.height; ++v) {
+        const int32_t* ids = buffer.ids.data() + static_cast<size_t>(v) * buffer.stride;
+        int16_t* row = label_image->at(0, v);
+        for (int u = 0; u < buffer.width; ++u) {
+            const RenderLabel label =
+                    ids[u] < 0 ? RenderLabel::kEmpty : flat_instances_[records_[ids[u]].instance]->label;
+            row[u] = static_cast<RenderLabel::ValueType>(label);
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
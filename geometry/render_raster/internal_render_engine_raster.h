@@ -0,0 +1,258 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/eigen_types.h"
+#include "common/reset_on_copy.h"
+#include "geometry/geometry_roles.h"
+#include "geometry/proximity/aabb.h"
+#include "geometry/proximity/triangle_surface_mesh.h"
+#include "geometry/render/render_engine.h"
+#include "geometry/render/render_mesh.h"
+#include "geometry/render_raster/internal_instance_bvh.h"
+#include "geometry/render_raster/internal_rasterizer.h"
+#include "geometry/render_raster/render_engine_raster_params.h"
+#include "math/rigid_transform.h"
+#include "systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render_raster {
+namespace internal {
+
+/* A triangle mesh, expressed in its own frame M, as consumed by the
+ rasterizer. Meshes are immutable once made and are shared by all of the
+ instances (in all of the engine clones) that draw them.  */
+struct RasterMesh {
+    /* Makes the mesh from the vertices and triangles of the given mesh. The
+     triangles must be wound counter-clockwise when seen from outside.  */
+    static std::shared_ptr<const RasterMesh> Make(const TriangleSurfaceMesh<double>& mesh);
+    static std::shared_ptr<const RasterMesh> Make(const geometry::internal::RenderMesh& mesh);
+
+    std::vector<Vector3<float>> vertices;
+    std::vector<Vector3<int>> triangles;
+    /* The bounding box of the vertices in M.  */
+    Vector3<double> lower;
+    Vector3<double> upper;
+};
+
+/* See documentation of MakeRenderEngineRaster().
+
+ Rendering an image proceeds in stages:
+
+   1. The instances whose bounding boxes intersect the camera's view frustum
+      are found with an InstanceBvh (rebuilt when poses have changed since the
+      last image).
+   2. The triangles of the visible instances are transformed into the camera
+      frame, back faces are culled, the triangles are clipped to the near plane
+      (and, if they extend far beyond the image, to a guard band around it) and
+      projected into the image. This is done in parallel over the instances.
+   3. Each projected triangle is appended to the list of every tile its pixels
+      overlap, and the tiles are rasterized in parallel into a VisibilityBuffer
+      which records the nearest triangle at each pixel.
+   4. The requested image is computed from the visibility buffer: depth from
+      the inverse depth, label from the triangle's instance, and color from the
+      instance's diffuse color and the triangle's normal.
+
+ Because stage 4 is the only one that depends on the image type, RenderImages()
+ rasterizes each camera only once for all of the images requested from it
+ (when the depth camera matches the color camera).  */
+class RenderEngineRaster final : public render::RenderEngine, private ShapeReifier {
+public:
+    /* @name Does not allow public copy, move, or assignment  */
+    //@{
+
+    // Note: the copy constructor is actually private to serve as the basis for
+    // implementing the DoClone() method.
+    RenderEngineRaster& operator=(const RenderEngineRaster&) = delete;
+    RenderEngineRaster(RenderEngineRaster&&) = delete;
+    RenderEngineRaster& operator=(RenderEngineRaster&&) = delete;
+    //@}}
+
+    /* Constructs an instance of the render engine with the given `params`.  */
+    explicit RenderEngineRaster(RenderEngineRasterParams params = {});
+
+    ~RenderEngineRaster() final;
+
+    /* @see RenderEngine::UpdateViewpoint().  */
+    void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
+
+    const RenderEngineRasterParams& parameters() const { return parameters_; }
+
+    /* @name    Shape reification  */
+    //@{
+    using ShapeReifier::ImplementGeometry;
+    void ImplementGeometry(const Box& box, void* user_data) final;
+    void ImplementGeometry(const Capsule& capsule, void* user_data) final;
+    void ImplementGeometry(const Convex& convex, void* user_data) final;
+    void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+    void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) final;
+    void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+    void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+    void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+    //@}
+
+private:
+    // Data to pass through the reification process.
+    struct RegistrationData {
+        const GeometryId id;
+        const math::RigidTransformd& X_WG;
+        const PerceptionProperties& properties;
+        bool accepted{true};
+    };
+
+    // A mesh drawn at a geometry's pose. A geometry may have several instances
+    // (e.g., a Mesh with several materials).
+    struct Instance {
+        std::shared_ptr<const RasterMesh> mesh;
+        // The scale S_GM of the mesh's vertices into the geometry frame.
+        Vector3<double> scale;
+        math::RigidTransformd X_WG;
+        render::RenderLabel label;
+        Rgba diffuse;
+    };
+
+    // A triangle that survived culling, for computing the images from the
+    // visibility buffer.
+    struct TriangleRecord {
+        // The index of the triangle's instance in flat_instances_.
+        int instance{};
+        // The triangle's unit normal, expressed in the camera frame.
+        Vector3<float> n_C;
+    };
+
+    // The per-thread outputs of transforming and projecting triangles.
+    struct ThreadScratch {
+        // The positions of the current instance's vertices in the camera frame
+        // and their image coordinates and inverse depths (x, y, 1/z).
+        std::vector<Vector3<float>> p_CVs;
+        std::vector<Vector3<double>> p_IVs;
+        std::vector<ScreenTriangle> triangles;
+        std::vector<TriangleRecord> records;
+    };
+
+    // A mesh parsed from a file, with the diffuse color its file assigns it
+    // (if any).
+    struct FileMesh {
+        std::shared_ptr<const RasterMesh> mesh;
+        std::optional<Rgba> diffuse;
+    };
+
+    // @see RenderEngine::DoRegisterVisual().
+    bool DoRegisterVisual(GeometryId id,
+                          const Shape& shape,
+                          const PerceptionProperties& properties,
+                          const math::RigidTransformd& X_WG) final;
+
+    // @see RenderEngine::DoUpdateVisualPose().
+    void DoUpdateVisualPose(GeometryId id, const math::RigidTransformd& X_WG) final;
+
+    // @see RenderEngine::DoRemoveGeometry().
+    bool DoRemoveGeometry(GeometryId id) final;
+
+    // @see RenderEngine::DoClone().
+    std::unique_ptr<RenderEngine> DoClone() const final;
+
+    // @see RenderEngine::DoRenderColorImage().
+    void DoRenderColorImage(const render::ColorRenderCamera& camera,
+                            systems::sensors::ImageRgba8U* color_image_out) const final;
+
+    // @see RenderEngine::DoRenderDepthImage().
+    void DoRenderDepthImage(const render::DepthRenderCamera& camera,
+                            systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+    // @see RenderEngine::DoRenderLabelImage().
+    void DoRenderLabelImage(const render::ColorRenderCamera& camera,
+                            systems::sensors::ImageLabel16I* label_image_out) const final;
+
+    // @see RenderEngine::DoRenderImages().
+    void DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) final;
+
+    // Copy constructor used for cloning.
+    RenderEngineRaster(const RenderEngineRaster& other) = default;
+
+    // Adds an instance of the given mesh to the geometry being registered.
+    // If `diffuse` is not given, the instance takes its color from the
+    // geometry's properties.
+    void AddInstance(std::shared_ptr<const RasterMesh> mesh,
+                     const Vector3<double>& scale,
+                     void* user_data,
+                     const std::optional<Rgba>& diffuse = std::nullopt);
+
+    // Provides the meshes of the canonical, "unit" geometries which instances
+    // scale to the size of the registered shape. The meshes are made on first
+    // use.
+    std::shared_ptr<const RasterMesh> GetSphere();
+    std::shared_ptr<const RasterMesh> GetCylinder();
+    std::shared_ptr<const RasterMesh> GetBox();
+    std::shared_ptr<const RasterMesh> GetHalfSpace();
+
+    // Rebuilds flat_instances_ and the culling hierarchy if geometries have
+    // been added, removed, or moved since they were last built.
+    void UpdateCullingHierarchy() const;
+
+    // Rasterizes the scene, as seen by a camera with the given properties at
+    // the pose X_WC, into visibility_. Afterwards, records_ holds the
+    // triangles referenced by the buffer.
+    void Rasterize(const render::RenderCameraCore& core, const math::RigidTransformd& X_WC) const;
+
+    // Transforms, culls, clips, and projects the triangles of the given
+    // instance into `scratch`.
+    void ProjectInstance(int instance_index,
+                         const math::RigidTransformd& X_CW,
+                         const render::RenderCameraCore& core,
+                         ThreadScratch* scratch) const;
+
+    // Computes the images from visibility_ (as filled in by Rasterize() for
+    // a camera with the same intrinsics).
+    void ResolveColorImage(const render::ColorRenderCamera& camera, systems::sensors::ImageRgba8U* color_image) const;
+    void ResolveDepthImage(const render::DepthRenderCamera& camera, systems::sensors::ImageDepth32F* depth_image) const;
+    void ResolveLabelImage(systems::sensors::ImageLabel16I* label_image) const;
+
+    // The engine's configuration parameters.
+    const RenderEngineRasterParams parameters_;
+
+    // The cached pose of the camera in the world.
+    math::RigidTransformd X_WC_;
+
+    // The instances of each registered geometry.
+    std::map<GeometryId, std::vector<Instance>> visuals_;
+
+    // The canonical meshes (see GetSphere(), etc.).
+    std::shared_ptr<const RasterMesh> sphere_;
+    std::shared_ptr<const RasterMesh> cylinder_;
+    std::shared_ptr<const RasterMesh> box_;
+    std::shared_ptr<const RasterMesh> half_space_;
+
+    // The meshes parsed from files, keyed by the file name (prefixed to
+    // distinguish a Convex's hull from a Mesh).
+    std::unordered_map<std::string, std::vector<FileMesh>> file_meshes_;
+
+    // N.B. The following members are caches and scratch space for rendering,
+    // which is why they are mutable. As documented, an engine must not be
+    // rendering in more than one thread at a time.
+
+    // Whether flat_instances_ and culling_hierarchy_ reflect visuals_. This
+    // resets to false in a clone, whose flat_instances_ would point into the
+    // source engine's visuals_.
+    mutable reset_on_copy<bool> culling_hierarchy_valid_;
+    mutable std::vector<const Instance*> flat_instances_;
+    mutable InstanceBvh culling_hierarchy_;
+
+    mutable std::vector<int> visible_;
+    mutable std::vector<ThreadScratch> thread_scratch_;
+    mutable std::vector<ScreenTriangle> triangles_;
+    mutable std::vector<TriangleRecord> records_;
+    mutable std::vector<std::vector<int32_t>> tile_bins_;
+    mutable VisibilityBuffer visibility_;
+};
+
+}  // namespace internal
+}  // namespace render_raster
+}  // namespace geometry
+}  // namespace drake
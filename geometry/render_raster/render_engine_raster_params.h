@@ -0,0 +1,37 @@
+#pragma once
+
+#include "common/name_value.h"
+#include "geometry/rgba.h"
+
+namespace drake {
+namespace geometry {
+
+/** Construction parameters for RenderEngineRaster.  */
+struct RenderEngineRasterParams {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(default_diffuse));
+        a->Visit(DRAKE_NVP(default_clear_color));
+        a->Visit(DRAKE_NVP(num_threads));
+    }
+
+    /** Default diffuse color to apply to a geometry when none is otherwise
+     specified in the (phong, diffuse) property.  */
+    Rgba default_diffuse{0.9, 0.7, 0.2, 1.0};
+
+    /** The default background color for color images.  */
+    Rgba default_clear_color{204 / 255., 229 / 255., 255 / 255., 1.0};
+
+    /** The number of threads used to render each image. The image is divided
+     into tiles which are rasterized in parallel. When several engines (e.g.,
+     the clones in the Contexts of a parallel simulation) are rendering at the
+     same time, leaving this at 1 and rendering from each engine in its own
+     thread is usually best.
+     @pre num_threads >= 1.  */
+    int num_threads{1};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -410,7 +410,10 @@ void RenderEngineVtk::DoRenderColorImage(const ColorRenderCamera& camera, ImageR
 void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
     UpdateWindow(camera, *pipelines_[ImageType::kDepth]);
     PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
+    ReadDepthImage(camera, depth_image_out);
+}
 
+void RenderEngineVtk::ReadDepthImage(const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
     const CameraInfo& intrinsics = camera.core().intrinsics();
     ImageRgba8U image(intrinsics.width(), intrinsics.height());
     // TODO(SeanCurtis-TRI): We're doing multiple passes on the pixel data. This
@@ -444,7 +447,58 @@ void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera, ImageD
 void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
     UpdateWindow(camera.core(), camera.show_window(), *pipelines_[ImageType::kLabel], "Label Image");
     PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
+    ReadLabelImage(camera, label_image_out);
+}
+
+void RenderEngineVtk::DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) {
+    const RenderingPipeline& color = *pipelines_[ImageType::kColor];
+    const RenderingPipeline& depth = *pipelines_[ImageType::kDepth];
+    const RenderingPipeline& label = *pipelines_[ImageType::kLabel];
+    for (const render::ImageRenderRequest& request : requests) {
+        // Each image type has its own pipeline (and window), and
+        // UpdateViewpoint() poses the cameras of all of them at once. So we
+        // render every requested image of this camera before reading any of
+        // them back, rather than waiting on each image in turn.
+        std::optional<RigidTransformd> X_WC;
+        std::optional<ColorRenderCamera> shadow_camera;
+        if (request.color_image != nullptr || request.label_image != nullptr) {
+            X_WC = request.X_WB * request.color_camera->core().sensor_pose_in_camera_body();
+            UpdateViewpoint(*X_WC);
+            if (request.color_image != nullptr) {
+                shadow_camera = MakeShadowCamera(*request.color_camera, parameters_.cast_shadows);
+                UpdateWindow(shadow_camera->core(), shadow_camera->show_window(), color, "Color Image");
+                color.window->Render();
+            }
+            if (request.label_image != nullptr) {
+                UpdateWindow(request.color_camera->core(), request.color_camera->show_window(), label, "Label Image");
+                label.window->Render();
+            }
+        }
+        if (request.depth_image != nullptr) {
+            const RigidTransformd X_WD = request.X_WB * request.depth_camera->core().sensor_pose_in_camera_body();
+            if (!X_WC.has_value() || !X_WD.IsExactlyEqualTo(*X_WC)) {
+                UpdateViewpoint(X_WD);
+            }
+            UpdateWindow(*request.depth_camera, depth);
+            depth.window->Render();
+        }
 
+        if (request.color_image != nullptr) {
+            UpdateImageFilter(color);
+            ExtractImage(*shadow_camera, color.exporter, request.color_image);
+        }
+        if (request.depth_image != nullptr) {
+            UpdateImageFilter(depth);
+            ReadDepthImage(*request.depth_camera, request.depth_image);
+        }
+        if (request.label_image != nullptr) {
+            UpdateImageFilter(label);
+            ReadLabelImage(*request.color_camera, request.label_image);
+        }
+    }
+}
+
+void RenderEngineVtk::ReadLabelImage(const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
     // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
     // would be much better to process the pixels directly. The solution is to
     // simply call exporter->GetPointerToData() and process the pixels myself.
@@ -1013,6 +1067,10 @@ void RenderEngineVtk::SetPbrMaterials() {
 }
 void RenderEngineVtk::PerformVtkUpdate(const RenderingPipeline& p) {
     p.window->Render();
+    UpdateImageFilter(p);
+}
+
+void RenderEngineVtk::UpdateImageFilter(const RenderingPipeline& p) {
     p.filter->Modified();
     p.filter->Update();
 }
@@ -146,6 +146,10 @@ protected:
      vtkActors' pose update for rendering. */
     static void PerformVtkUpdate(const RenderingPipeline& p);
 
+    /* Copies the last image rendered into the pipeline's window through its
+     vtkWindowToImageFilter (the second half of PerformVtkUpdate()). */
+    static void UpdateImageFilter(const RenderingPipeline& p);
+
     /* Provides access to the private data member pipelines_ by returning a
      mutable RenderingPipeline reference. Only image types in ImageType enum are
      valid. */
@@ -187,6 +191,17 @@ protected:
     void DoRenderLabelImage(const render::ColorRenderCamera& camera,
                             systems::sensors::ImageLabel16I* label_image_out) const override;
 
+    // @see RenderEngine::DoRenderImages().
+    void DoRenderImages(const std::vector<render::ImageRenderRequest>& requests) override;
+
+    // Converts the depth (or label) image exported by the depth (or label)
+    // pipeline into the output image.
+    // @pre The pipeline has rendered the camera's image and updated its filter.
+    void ReadDepthImage(const render::DepthRenderCamera& camera,
+                        systems::sensors::ImageDepth32F* depth_image_out) const;
+    void ReadLabelImage(const render::ColorRenderCamera& camera,
+                        systems::sensors::ImageLabel16I* label_image_out) const;
+
     // Helper function for mapping a RenderMesh instance into the appropriate VTK
     // polydata.
     void ImplementRenderMesh(geometry::internal::RenderMesh&& mesh, double scale, const RegistrationData& data);
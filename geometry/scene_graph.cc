@@ -85,8 +85,8 @@ private:
  Scene graph's "model" contains whatever geometry and properties were specified
  by model file parsing and explicit method calls. When a context is created,
  the default values from SceneGraphConfig::DefaultProximityProperties are
- applied to all geometry. Call the resulting GeometryState object the
- "augmented model".
+ applied to all geometry, and the SceneGraphConfig::static_distance_field (if
+ any) is baked. Call the resulting GeometryState object the "augmented model".
 
  Creating the augmented model can be expensive; users that allocate multiple
  contexts from an identical underlying model and configuration should not have
@@ -143,6 +143,9 @@ public:
             // Our cache was out-of-date, so we need to refresh it.
             auto result = std::make_unique<GeometryState<T>>(model_);
             result->ApplyProximityDefaults(config_.default_proximity_properties);
+            if (config_.static_distance_field.has_value()) {
+                result->BakeStaticDistanceField(*config_.static_distance_field);
+            }
             augmented_model_cache_ = std::make_unique<const GeometryState<T>>(*result);
             return result;
         }
@@ -625,7 +628,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context, int*) const {
         }
     }
 
-    state.FinalizePoseUpdate(kinematics_data, &state.mutable_proximity_engine(), state.GetMutableRenderEngines());
+    state.FinalizePoseUpdate(&kinematics_data, &state.mutable_proximity_engine(), state.GetMutableRenderEngines());
 }
 
 template <typename T>
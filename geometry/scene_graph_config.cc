@@ -2,6 +2,7 @@
 
 #include <functional>
 
+#include "common/fmt_eigen.h"
 #include "geometry/proximity_properties.h"
 #include "multibody/plant/coulomb_friction.h"
 
@@ -92,8 +93,27 @@ void DefaultProximityProperties::ValidateOrThrow() const {
     }
 }
 
+void StaticDistanceFieldConfig::ValidateOrThrow() const {
+#define DRAKE_ENFORCE(prop, cond) ThrowUnlessAbsentOr(#prop, prop, cond)
+    DRAKE_ENFORCE(resolution, kPositiveFinite);
+    DRAKE_ENFORCE(narrow_band, kPositiveFinite);
+    DRAKE_ENFORCE(sample_spacing, kPositiveFinite);
+    DRAKE_ENFORCE(exact_distance, kNonNegativeFinite);
+#undef DRAKE_ENFORCE
+
+    if (!(lower.array() < upper.array()).all()) {
+        throw std::logic_error(
+                fmt::format("Invalid scene graph configuration: each element of the static distance field's "
+                            "'lower' ({}) must be less than the corresponding element of 'upper' ({}).",
+                            fmt_eigen(lower.transpose()), fmt_eigen(upper.transpose())));
+    }
+}
+
 void SceneGraphConfig::ValidateOrThrow() const {
     default_proximity_properties.ValidateOrThrow();
+    if (static_distance_field.has_value()) {
+        static_distance_field->ValidateOrThrow();
+    }
 }
 
 }  // namespace geometry
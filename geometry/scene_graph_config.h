@@ -3,6 +3,8 @@
 #include <optional>
 #include <string>
 
+#include <Eigen/Core>
+
 #include "common/name_value.h"
 
 namespace drake {
@@ -104,6 +106,80 @@ struct DefaultProximityProperties {
     void ValidateOrThrow() const;
 };
 
+/** These properties control the signed distance field that SceneGraph can
+bake from its anchored geometry to accelerate signed distance queries between
+dynamic and anchored geometry. @see SceneGraphConfig::static_distance_field.
+
+The field samples the signed distance to the anchored geometries with a
+proximity role on a grid of nodes spaced `resolution` apart over the box
+[`lower`, `upper`], storing only the nodes within `narrow_band` of their
+surfaces. A dynamic geometry is represented by points sampled from it: a
+sphere by its center, a capsule by points along its axis, and other shapes by
+points on their surfaces (meshes by points on their convex hulls'). Its
+distance to an anchored geometry is the least interpolated distance at its
+points (less its radius, for spheres and capsules), and it is only paired with
+the anchored geometries that are nearest to at least one of its points.
+
+The field's distances are approximate: they may overestimate the true distance
+by up to about half the `sample_spacing` (for shapes represented by surface
+points) plus the interpolation error, which is at most about the diagonal of a
+grid cell. Pairs whose approximate distance is less than `exact_distance` plus
+this bound are recomputed exactly, so that every pair within `exact_distance`
+is reported with its exact distance.
+
+Surface points can't tell that a dynamic geometry encloses an anchored one, so
+a dynamic geometry represented by surface points is queried exactly whenever
+its bounding box contains the bounding box of an anchored geometry. */
+struct StaticDistanceFieldConfig {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(lower));
+        a->Visit(DRAKE_NVP(upper));
+        a->Visit(DRAKE_NVP(resolution));
+        a->Visit(DRAKE_NVP(narrow_band));
+        a->Visit(DRAKE_NVP(sample_spacing));
+        a->Visit(DRAKE_NVP(exact_distance));
+        a->Visit(DRAKE_NVP(cache_file));
+        ValidateOrThrow();
+    }
+
+    /** The corners of the box of the world frame covered by the field, in
+    meters. Dynamic geometry with points outside of the box is queried exactly
+    instead. */
+    Eigen::Vector3d lower{-2.0, -2.0, -0.5};
+    Eigen::Vector3d upper{2.0, 2.0, 2.5};
+
+    /** The spacing of the field's nodes, in meters. */
+    double resolution{0.01};
+
+    /** The distance from the anchored geometry's surfaces (in meters) within
+    which the field is stored. Queries with a `max_distance` larger than this
+    (less the radius of a sphere or capsule) are answered exactly instead; so
+    are dynamic geometries with points deeper than this inside anchored
+    geometry. */
+    double narrow_band{0.2};
+
+    /** The approximate spacing of the points sampled from the dynamic geometry,
+    in meters. */
+    double sample_spacing{0.02};
+
+    /** Pairs whose distance may be less than this (in meters) have their
+    distance recomputed exactly; the approximate distance is compared against
+    this plus the field's error bound (see above). Zero disables exact
+    recomputation for pairs that aren't in contact. */
+    double exact_distance{0.02};
+
+    /** If not empty, the file from which to load the field. If the file doesn't
+    exist, or was baked from different anchored geometry or with different
+    values of the properties above, the field is baked and saved to it. */
+    std::string cache_file;
+
+    /** Throws if the values are inconsistent. */
+    void ValidateOrThrow() const;
+};
+
 /** The set of configurable properties on a SceneGraph. */
 struct SceneGraphConfig {
     /** Passes this object to an Archive.
@@ -111,12 +187,22 @@ struct SceneGraphConfig {
     template <typename Archive>
     void Serialize(Archive* a) {
         a->Visit(DRAKE_NVP(default_proximity_properties));
+        a->Visit(DRAKE_NVP(static_distance_field));
     }
 
     /** Provides SceneGraph-wide contact material values to use when none have
     been otherwise specified. */
     DefaultProximityProperties default_proximity_properties;
 
+    /** If set, every context's proximity engine has a signed distance field of
+    the anchored geometry, which QueryObject::ComputeSignedDistancePairwiseClosestPoints()
+    uses (for the scalar type double) to compute the distances between dynamic
+    and anchored geometry. The field is baked (or loaded) once for each version
+    of the model and shared by the contexts allocated from it; changing the
+    anchored geometry of a context discards its field. See
+    StaticDistanceFieldConfig for its accuracy. */
+    std::optional<StaticDistanceFieldConfig> static_distance_field;
+
     /** Throws if the values are inconsistent. */
     void ValidateOrThrow() const;
 };
@@ -1,6 +1,8 @@
 #include "lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <stdexcept>
@@ -10,7 +12,9 @@
 #include "lcm/lcm.h"
 
 #include "common/drake_assert.h"
+#include "common/drake_throw.h"
 #include "common/string_map.h"
+#include "lcm/memory_mapped_lcm_log.h"
 
 namespace drake {
 namespace lcm {
@@ -20,12 +24,49 @@ using MultichannelHandlerFunction = DrakeLcmInterface::MultichannelHandlerFuncti
 
 class DrakeLcmLog::Impl {
 public:
+    // Returns the file-order index of the message under the playback cursor,
+    // or nullopt at the end of the log.
+    std::optional<int64_t> current_entry() const {
+        if (playable_entries_.has_value()) {
+            if (cursor_ < static_cast<int64_t>(playable_entries_->size())) {
+                return (*playable_entries_)[cursor_];
+            }
+            return std::nullopt;
+        }
+        if (cursor_ < reader_->num_entries()) {
+            return cursor_;
+        }
+        return std::nullopt;
+    }
+
+    // Moves the playback cursor to the first playable message whose timestamp
+    // is not less than `timestamp`.
+    void Seek(int64_t timestamp) {
+        const int64_t first = reader_->LowerBound(timestamp);
+        if (!playable_entries_.has_value()) {
+            cursor_ = first;
+            return;
+        }
+        // The playable entries are a file-ordered subsequence of all entries.
+        cursor_ = std::lower_bound(playable_entries_->begin(), playable_entries_->end(), first) -
+                  playable_entries_->begin();
+    }
+
     string_multimap<HandlerFunction> subscriptions_;
     std::vector<MultichannelHandlerFunction> multichannel_subscriptions_;
+
+    // Only used in write mode.
     std::unique_ptr<::lcm_eventlog_t, decltype(&::lcm_eventlog_destroy)>  // BR
             log_{nullptr, &::lcm_eventlog_destroy};
-    std::unique_ptr<::lcm_eventlog_event_t, decltype(&::lcm_eventlog_free_event)> next_event_{
-            nullptr, &::lcm_eventlog_free_event};
+
+    // Only used in read mode.
+    std::unique_ptr<internal::MemoryMappedLcmLog> reader_;
+    // When channels are filtered, the file-order indices of the messages that
+    // are played back; otherwise nullopt (all messages are played back).
+    std::optional<std::vector<int64_t>> playable_entries_;
+    // The index of the next message to be played back, into playable_entries_
+    // when it is present and otherwise into the reader's entries.
+    int64_t cursor_{0};
 };
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write, bool overwrite_publish_time_with_system_clock)
@@ -35,12 +76,34 @@ DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write, bool overw
       impl_(new Impl) {
     if (is_write_) {
         impl_->log_.reset(lcm_eventlog_create(file_name.c_str(), "w"));
+        if (impl_->log_ == nullptr) {
+            throw std::runtime_error("Failed to open log file: " + file_name);
+        }
     } else {
-        impl_->log_.reset(lcm_eventlog_create(file_name.c_str(), "r"));
-        impl_->next_event_.reset(lcm_eventlog_read_next_event(impl_->log_.get()));
+        impl_->reader_ = std::make_unique<internal::MemoryMappedLcmLog>(file_name, false);
     }
-    if (impl_->log_ == nullptr) {
-        throw std::runtime_error("Failed to open log file: " + file_name);
+}
+
+DrakeLcmLog::DrakeLcmLog(const std::string& file_name, const DrakeLcmLogPlaybackParams& params)
+    : is_write_(false),
+      overwrite_publish_time_with_system_clock_(false),
+      url_("lcmlog://" + file_name),
+      impl_(new Impl) {
+    impl_->reader_ = std::make_unique<internal::MemoryMappedLcmLog>(file_name, params.cache_index);
+    if (!params.channels.empty()) {
+        const internal::MemoryMappedLcmLog& reader = *impl_->reader_;
+        std::vector<bool> is_played(reader.channels().size(), false);
+        for (const std::string& channel : params.channels) {
+            if (const std::optional<uint32_t> index = reader.FindChannel(channel)) {
+                is_played[*index] = true;
+            }
+        }
+        std::vector<int64_t>& playable = impl_->playable_entries_.emplace();
+        for (int64_t i = 0; i < reader.num_entries(); ++i) {
+            if (is_played[reader.entry(i).channel_index]) {
+                playable.push_back(i);
+            }
+        }
     }
 }
 
@@ -109,10 +172,11 @@ double DrakeLcmLog::GetNextMessageTime() const {
     }
 
     std::lock_guard<std::mutex> lock(mutex_);
-    if (impl_->next_event_ == nullptr) {
+    const std::optional<int64_t> next = impl_->current_entry();
+    if (!next.has_value()) {
         return std::numeric_limits<double>::infinity();
     }
-    return timestamp_to_second(impl_->next_event_->timestamp);
+    return timestamp_to_second(impl_->reader_->entry(*next).timestamp);
 }
 
 void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
@@ -122,29 +186,48 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
 
     std::lock_guard<std::mutex> lock(mutex_);
     // End of log, do nothing.
-    if (impl_->next_event_ == nullptr) {
+    const std::optional<int64_t> next = impl_->current_entry();
+    if (!next.has_value()) {
         return;
     }
-    const ::lcm_eventlog_event_t& next_event = *impl_->next_event_;
+    const internal::MemoryMappedLcmLog& reader = *impl_->reader_;
+    const internal::LcmLogEntry& next_event = reader.entry(*next);
 
     // Do nothing if the call time does not match the event's time.
     if (current_time != timestamp_to_second(next_event.timestamp)) {
         return;
     }
 
-    // Dispatch message if necessary.
-    const std::string_view channel(next_event.channel, next_event.channellen);
+    // Dispatch message if necessary. The payload is handed out directly from
+    // the memory-mapped log.
+    const std::string_view channel = reader.channel(next_event);
+    const void* const data = reader.data(next_event);
+    const int data_size = static_cast<int>(next_event.data_size);
     const auto& range = impl_->subscriptions_.equal_range(channel);
     for (auto iter = range.first; iter != range.second; ++iter) {
         const HandlerFunction& handler = iter->second;
-        handler(next_event.data, next_event.datalen);
+        handler(data, data_size);
     }
     for (const auto& multi_handler : impl_->multichannel_subscriptions_) {
-        multi_handler(channel, next_event.data, next_event.datalen);
+        multi_handler(channel, data, data_size);
     }
 
     // Advance log.
-    impl_->next_event_.reset(lcm_eventlog_read_next_event(impl_->log_.get()));
+    ++impl_->cursor_;
+}
+
+void DrakeLcmLog::Seek(double time_sec) {
+    if (is_write_) {
+        throw std::logic_error("Seek is only available for log playback.");
+    }
+
+    DRAKE_THROW_UNLESS(!std::isnan(time_sec));
+    // Round up, so that we never land before a message at exactly time_sec.
+    const double timestamp =
+            std::clamp(std::ceil(time_sec * 1e6), static_cast<double>(std::numeric_limits<int64_t>::min()),
+                       static_cast<double>(std::numeric_limits<int64_t>::max() / 2));
+    std::lock_guard<std::mutex> lock(mutex_);
+    impl_->Seek(static_cast<int64_t>(timestamp));
 }
 
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
@@ -5,6 +5,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "common/drake_copyable.h"
 #include "lcm/drake_lcm_interface.h"
@@ -12,6 +13,20 @@
 namespace drake {
 namespace lcm {
 
+/** The set of parameters for reading back a log with DrakeLcmLog. */
+struct DrakeLcmLogPlaybackParams {
+    /** When true, the log's message index (the timestamp, channel, and file
+    offset of every message) is saved alongside the log as `<file_name>.idx` and
+    reused the next time the same log is opened, so that only the first opening
+    of a large log pays for a full scan of the file. A cached index is ignored
+    (and rebuilt) if the log's size or modification time has changed. */
+    bool cache_index{false};
+
+    /** When non-empty, only messages on these channels are played back; all
+    other messages are skipped without being read. */
+    std::vector<std::string> channels;
+};
+
 /**
  * A LCM interface for logging LCM messages to a file or playing back from a
  * existing log. Note the user is responsible for offsetting the clock used
@@ -19,6 +34,11 @@ namespace lcm {
  * is generated by some external logger (the lcm-logger binary), which uses the
  * unix epoch time clock to record message arrival time, the user needs to
  * offset those timestamps properly to match and the clock used for playback.
+ *
+ * In read-only mode the log file is memory-mapped and indexed when it is
+ * opened, so that Seek() takes O(log n) time in the number of messages and
+ * message payloads are handed to subscribers directly from the mapping, without
+ * copying.
  */
 class DrakeLcmLog : public DrakeLcmInterface {
 public:
@@ -41,6 +61,14 @@ public:
      */
     DrakeLcmLog(const std::string& file_name, bool is_write, bool overwrite_publish_time_with_system_clock = false);
 
+    /**
+     * Constructs a read-only DrakeLcmLog for playback of the log identified by
+     * @p file_name, as configured by @p params.
+     *
+     * @throws std::exception if unable to open file.
+     */
+    DrakeLcmLog(const std::string& file_name, const DrakeLcmLogPlaybackParams& params);
+
     ~DrakeLcmLog() override;
 
     /**
@@ -113,6 +141,23 @@ public:
      */
     void DispatchMessageAndAdvanceLog(double current_time);
 
+    /**
+     * Moves the playback cursor to the first message (on a played-back channel)
+     * whose time is at or after @p time_sec, so that it becomes the message
+     * reported by GetNextMessageTime(). Seeking backward is allowed. This takes
+     * O(log n) time in the number of messages as long as the log's timestamps
+     * are non-decreasing (as they are for logs written by lcm-logger or by this
+     * class); otherwise it falls back to a linear scan.
+     *
+     * When used with systems::lcm::LcmLogPlaybackSystem, seek before starting
+     * the simulation, and start the simulation at (or just before) the time of
+     * the next message.
+     *
+     * @throws std::exception if this instance is not constructed in read-only
+     * mode.
+     */
+    void Seek(double time_sec);
+
     /**
      * Returns true if this instance is constructed in write-only mode.
      */
@@ -0,0 +1,262 @@
+#include "lcm/memory_mapped_lcm_log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "common/drake_assert.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+namespace {
+
+// The on-disk event header used by LCM logs: a magic number, an event number,
+// a timestamp (microseconds), the channel name length, and the payload length,
+// all stored big-endian. The channel name and payload follow the header.
+constexpr uint32_t kEventMagic = 0xEDA1DA01;
+constexpr uint64_t kEventHeaderSize = 4 + 8 + 8 + 4 + 4;
+
+// The maximum channel name length accepted by lcm_eventlog_read_next_event().
+constexpr uint32_t kMaxChannelLength = 1000;
+
+// Identifies (and versions) our index cache files.
+constexpr char kIndexMagic[8] = {'D', 'L', 'C', 'M', 'I', 'D', 'X', '1'};
+
+uint32_t ReadBigEndian32(const char* bytes) {
+    const auto* b = reinterpret_cast<const unsigned char*>(bytes);
+    return (uint32_t{b[0]} << 24) | (uint32_t{b[1]} << 16) | (uint32_t{b[2]} << 8) | uint32_t{b[3]};
+}
+
+uint64_t ReadBigEndian64(const char* bytes) {
+    return (uint64_t{ReadBigEndian32(bytes)} << 32) | uint64_t{ReadBigEndian32(bytes + 4)};
+}
+
+template <typename T>
+void WritePod(std::ostream* out, const T& value) {
+    out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool ReadPod(std::istream* in, T* value) {
+    in->read(reinterpret_cast<char*>(value), sizeof(*value));
+    return static_cast<bool>(*in);
+}
+
+}  // namespace
+
+MemoryMappedLcmLog::MemoryMappedLcmLog(const std::string& file_name, bool cache_index) {
+    const int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open log file: " + file_name);
+    }
+    struct stat file_stat {};
+    if (::fstat(fd, &file_stat) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Failed to stat log file: " + file_name);
+    }
+    size_ = static_cast<uint64_t>(file_stat.st_size);
+#ifdef __APPLE__
+    const struct timespec& mtime = file_stat.st_mtimespec;
+#else
+    const struct timespec& mtime = file_stat.st_mtim;
+#endif
+    mtime_ns_ = int64_t{mtime.tv_sec} * 1'000'000'000 + mtime.tv_nsec;
+    // An empty log has nothing to map (and mmap rejects zero-length requests).
+    if (size_ > 0) {
+        void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error(
+                    fmt::format("Failed to memory-map log file {}: {}", file_name, std::strerror(error)));
+        }
+        base_ = static_cast<const char*>(mapped);
+        // Playback mostly walks forward through the file.
+        ::madvise(mapped, size_, MADV_SEQUENTIAL);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+
+    const std::string index_file_name = GetIndexFileName(file_name);
+    if (!(cache_index && LoadIndex(index_file_name))) {
+        BuildIndex();
+        if (cache_index) {
+            SaveIndex(index_file_name);
+        }
+    }
+}
+
+MemoryMappedLcmLog::~MemoryMappedLcmLog() {
+    if (base_ != nullptr) {
+        ::munmap(const_cast<char*>(base_), size_);
+    }
+}
+
+std::string MemoryMappedLcmLog::GetIndexFileName(const std::string& file_name) {
+    return file_name + ".idx";
+}
+
+std::optional<uint32_t> MemoryMappedLcmLog::FindChannel(std::string_view channel) const {
+    for (size_t i = 0; i < channels_.size(); ++i) {
+        if (channels_[i] == channel) {
+            return static_cast<uint32_t>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+const void* MemoryMappedLcmLog::data(const LcmLogEntry& entry) const {
+    DRAKE_ASSERT(entry.offset + kEventHeaderSize <= size_);
+    return base_ + entry.offset + kEventHeaderSize + channels_[entry.channel_index].size();
+}
+
+int64_t MemoryMappedLcmLog::LowerBound(int64_t timestamp) const {
+    auto is_before = [timestamp](const LcmLogEntry& entry) {
+        return entry.timestamp < timestamp;
+    };
+    const auto iter = timestamps_sorted_ ? std::partition_point(entries_.begin(), entries_.end(), is_before)
+                                         : std::find_if_not(entries_.begin(), entries_.end(), is_before);
+    return iter - entries_.begin();
+}
+
+void MemoryMappedLcmLog::BuildIndex() {
+    channels_.clear();
+    entries_.clear();
+    timestamps_sorted_ = true;
+    std::unordered_map<std::string_view, uint32_t> channel_lookup;
+
+    uint64_t offset = 0;
+    while (offset + kEventHeaderSize <= size_) {
+        const char* header = base_ + offset;
+        if (ReadBigEndian32(header) != kEventMagic) {
+            // Resynchronize on the next event header.
+            ++offset;
+            continue;
+        }
+        const int64_t timestamp = static_cast<int64_t>(ReadBigEndian64(header + 12));
+        const uint32_t channel_length = ReadBigEndian32(header + 20);
+        const uint32_t data_size = ReadBigEndian32(header + 24);
+        if (channel_length > kMaxChannelLength) {
+            ++offset;
+            continue;
+        }
+        const uint64_t end = offset + kEventHeaderSize + channel_length + data_size;
+        if (end > size_) {
+            // A truncated final event (e.g., from a logger that was killed).
+            break;
+        }
+
+        const std::string_view channel(header + kEventHeaderSize, channel_length);
+        auto [iter, inserted] = channel_lookup.emplace(channel, static_cast<uint32_t>(channels_.size()));
+        if (inserted) {
+            channels_.emplace_back(channel);
+        }
+        if (!entries_.empty() && timestamp < entries_.back().timestamp) {
+            timestamps_sorted_ = false;
+        }
+        entries_.push_back(LcmLogEntry{timestamp, offset, iter->second, data_size});
+        offset = end;
+    }
+}
+
+bool MemoryMappedLcmLog::LoadIndex(const std::string& index_file_name) {
+    std::ifstream in(index_file_name, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    char magic[sizeof(kIndexMagic)]{};
+    uint64_t log_size{};
+    int64_t log_mtime_ns{};
+    uint8_t sorted{};
+    uint64_t num_channels{};
+    if (!(in.read(magic, sizeof(magic)) && std::equal(magic, magic + sizeof(magic), kIndexMagic) &&
+          ReadPod(&in, &log_size) && ReadPod(&in, &log_mtime_ns) && ReadPod(&in, &sorted) &&
+          ReadPod(&in, &num_channels))) {
+        return false;
+    }
+    // A stale index describes some other version of the log.
+    if (log_size != size_ || log_mtime_ns != mtime_ns_ || num_channels > size_) {
+        return false;
+    }
+    std::vector<std::string> channels(num_channels);
+    for (std::string& channel : channels) {
+        uint32_t length{};
+        if (!ReadPod(&in, &length) || length > kMaxChannelLength) {
+            return false;
+        }
+        channel.resize(length);
+        if (!in.read(channel.data(), length)) {
+            return false;
+        }
+    }
+    uint64_t num_entries{};
+    if (!ReadPod(&in, &num_entries) || num_entries > size_ / kEventHeaderSize) {
+        return false;
+    }
+    std::vector<LcmLogEntry> entries(num_entries);
+    if (!in.read(reinterpret_cast<char*>(entries.data()),
+                 static_cast<std::streamsize>(num_entries * sizeof(LcmLogEntry)))) {
+        return false;
+    }
+    for (const LcmLogEntry& entry : entries) {
+        if (entry.channel_index >= num_channels ||
+            entry.offset + kEventHeaderSize + channels[entry.channel_index].size() + entry.data_size > size_) {
+            return false;
+        }
+    }
+    channels_ = std::move(channels);
+    entries_ = std::move(entries);
+    timestamps_sorted_ = (sorted != 0);
+    return true;
+}
+
+void MemoryMappedLcmLog::SaveIndex(const std::string& index_file_name) const {
+    // Write to a temporary file and rename it into place, so that concurrent
+    // readers never observe a partially-written index.
+    const std::string temp_file_name = index_file_name + fmt::format(".tmp{}", ::getpid());
+    {
+        std::ofstream out(temp_file_name, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return;
+        }
+        out.write(kIndexMagic, sizeof(kIndexMagic));
+        WritePod(&out, size_);
+        WritePod(&out, mtime_ns_);
+        WritePod(&out, uint8_t{timestamps_sorted_});
+        WritePod(&out, uint64_t{channels_.size()});
+        for (const std::string& channel : channels_) {
+            WritePod(&out, static_cast<uint32_t>(channel.size()));
+            out.write(channel.data(), channel.size());
+        }
+        WritePod(&out, uint64_t{entries_.size()});
+        out.write(reinterpret_cast<const char*>(entries_.data()),
+                  static_cast<std::streamsize>(entries_.size() * sizeof(LcmLogEntry)));
+        if (!out) {
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(temp_file_name, ignored);
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_file_name, index_file_name, error);
+    if (error) {
+        std::filesystem::remove(temp_file_name, error);
+    }
+}
+
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/drake_copyable.h"
+
+namespace drake {
+namespace lcm {
+namespace internal {
+
+/* The location of one message within a memory-mapped LCM log. */
+struct LcmLogEntry {
+    /* The message's timestamp, in microseconds. */
+    int64_t timestamp{};
+    /* The byte offset of the message's event header within the log file. */
+    uint64_t offset{};
+    /* The index of the message's channel name within channels(). */
+    uint32_t channel_index{};
+    /* The size of the message payload, in bytes. */
+    uint32_t data_size{};
+};
+
+/* A read-only view of an LCM log file (in the format written by lcm-logger or
+DrakeLcmLog) that memory-maps the file and indexes every message by timestamp
+and channel, so that clients can seek within the log in O(log n) time and read
+message payloads directly from the mapping without copying.
+
+Building the index requires one pass over the file. When `cache_index` is
+true, the index is saved alongside the log (see GetIndexFileName()) and is
+reused by later instances as long as the log's size and modification time are
+unchanged. Failure to write the cache is not an error; the index is simply
+kept in memory.
+
+Like lcm_eventlog_read_next_event(), corrupt bytes between events are skipped
+by scanning forward for the next event header; a truncated final event is
+ignored. */
+class MemoryMappedLcmLog {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MemoryMappedLcmLog);
+
+    /* Maps `file_name` and loads or builds its index.
+    @throws std::exception if the file cannot be opened or mapped. */
+    MemoryMappedLcmLog(const std::string& file_name, bool cache_index);
+
+    ~MemoryMappedLcmLog();
+
+    /* Returns the name of the index cache file used for `file_name`. */
+    static std::string GetIndexFileName(const std::string& file_name);
+
+    /* Returns the number of (complete) messages in the log. */
+    int64_t num_entries() const { return static_cast<int64_t>(entries_.size()); }
+
+    /* Returns the i'th message in file order. */
+    const LcmLogEntry& entry(int64_t i) const { return entries_[i]; }
+
+    /* Returns the distinct channel names that appear in the log, in order of
+    first appearance. */
+    const std::vector<std::string>& channels() const { return channels_; }
+
+    /* Returns the index of `channel` within channels(), or nullopt if no message
+    in the log was sent on that channel. */
+    std::optional<uint32_t> FindChannel(std::string_view channel) const;
+
+    /* Returns the channel name of the given message. */
+    std::string_view channel(const LcmLogEntry& entry) const { return channels_[entry.channel_index]; }
+
+    /* Returns a pointer to the given message's payload, which lives inside the
+    memory mapping and remains valid for the lifetime of this object. */
+    const void* data(const LcmLogEntry& entry) const;
+
+    /* Returns true iff the message timestamps are non-decreasing in file order,
+    in which case LowerBound() uses binary search. */
+    bool timestamps_sorted() const { return timestamps_sorted_; }
+
+    /* Returns the file-order index of the first message whose timestamp is not
+    less than `timestamp`, or num_entries() if there is none. This is O(log n)
+    when timestamps_sorted() is true, and a linear scan otherwise. */
+    int64_t LowerBound(int64_t timestamp) const;
+
+private:
+    void BuildIndex();
+    bool LoadIndex(const std::string& index_file_name);
+    void SaveIndex(const std::string& index_file_name) const;
+
+    const char* base_{nullptr};
+    uint64_t size_{};
+    int64_t mtime_ns_{};
+    std::vector<std::string> channels_;
+    std::vector<LcmLogEntry> entries_;
+    bool timestamps_sorted_{true};
+};
+
+}  // namespace internal
+}  // namespace lcm
+}  // namespace drake
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <gflags/gflags.h>
+
+#include "perception/point_cloud.h"
+#include "perception/point_cloud_registration.h"
+
+DEFINE_int32(size, 100000, "number of points in each cloud");
+DEFINE_int32(repeats, 10, "number of registrations timed per configuration");
+
+namespace drake {
+namespace perception {
+namespace {
+
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Samples a bumpy height field z = 0.1 sin(4x) cos(4y) over [-1, 1]².
+PointCloud MakeSurface(int size) {
+    PointCloud cloud(size, pc_flags::kXYZs);
+    auto xyzs = cloud.mutable_xyzs();
+    xyzs.topRows<2>().setRandom();
+    for (int i = 0; i < size; ++i) {
+        xyzs(2, i) = 0.1f * std::sin(4 * xyzs(0, i)) * std::cos(4 * xyzs(1, i));
+    }
+    return cloud;
+}
+
+void TimeRegistration(const char* name,
+                      const PointCloud& source,
+                      const PointCloud& target,
+                      const RigidTransformd& X_TS_expected,
+                      const IcpParams& params) {
+    IcpResult result;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < FLAGS_repeats; ++i) {
+        result = RegisterPointClouds(source, target, RigidTransformd(), params);
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double duration = static_cast<std::chrono::duration<double>>(end - start).count() / FLAGS_repeats;
+    const double error = (result.X_TS.inverse() * X_TS_expected).translation().norm();
+    std::cout << name << " time " << duration << " iterations " << result.num_iterations << " rms error "
+              << result.rms_error << " translation error " << error << std::endl;
+}
+
+int DoMain() {
+    std::srand(5432);
+    PointCloud target = MakeSurface(FLAGS_size);
+
+    // The source is another sampling of the same surface, seen from a slightly
+    // different pose.
+    const RigidTransformd X_TS(RollPitchYawd(0.02, -0.03, 0.05), Eigen::Vector3d(0.02, -0.01, 0.01));
+    PointCloud source = MakeSurface(FLAGS_size);
+    {
+        const Eigen::Matrix3f R_ST = X_TS.inverse().rotation().matrix().cast<float>();
+        const Eigen::Vector3f p_ST = X_TS.inverse().translation().cast<float>();
+        auto xyzs = source.mutable_xyzs();
+        xyzs = (R_ST * xyzs).colwise() + p_ST;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    target.BuildSpatialIndex();
+    auto post_index = std::chrono::high_resolution_clock::now();
+    target.EstimateNormals(0.05, 30, true);
+    auto post_normals = std::chrono::high_resolution_clock::now();
+    std::cout << "spatial index time " << static_cast<std::chrono::duration<double>>(post_index - start).count()
+              << std::endl
+              << "normal estimation time "
+              << static_cast<std::chrono::duration<double>>(post_normals - post_index).count() << std::endl;
+
+    IcpParams params;
+    params.max_correspondence_distance = 0.1;
+    params.metric = IcpMetric::kPointToPoint;
+    TimeRegistration("point-to-point serial", source, target, X_TS, params);
+    params.parallelize = Parallelism::Max();
+    TimeRegistration("point-to-point parallel", source, target, X_TS, params);
+    params.metric = IcpMetric::kPointToPlane;
+    params.parallelize = false;
+    TimeRegistration("point-to-plane serial", source, target, X_TS, params);
+    params.parallelize = Parallelism::Max();
+    TimeRegistration("point-to-plane parallel", source, target, X_TS, params);
+    return 0;
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+int main(int argc, char* argv[]) {
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    return drake::perception::DoMain();
+}
@@ -1,10 +1,11 @@
 #include "perception/depth_image_to_point_cloud.h"
 
-#include <limits>
 #include <optional>
+#include <vector>
 
 #include "common/drake_throw.h"
 #include "common/never_destroyed.h"
+#include "perception/depth_image_to_point_cloud_kernels.h"
 
 using drake::AbstractValue;
 using drake::Value;
@@ -42,9 +43,6 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
     throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
-// TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
-// cloud output? (This would require adding support for colored point clouds,
-// because current implementation assume that an RGB image will still line up).
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
@@ -52,16 +50,30 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image,
                const float scale,
+               const DepthImageToPointCloudParams& params,
                PointCloud* output) {
     if (exact_base_fields) {
         DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
     }
 
+    const int stride = params.stride;
+    const int height = depth_image.height();
+    const int width = depth_image.width();
+    const int num_rows = (height + stride - 1) / stride;
+    const int num_cols = (width + stride - 1) / stride;
+    const int max_size = num_rows * num_cols;
+
     // Reset the output size, if necessary.  We can leave the memory
-    // uninitialized iff we are going to fill it in below.
-    if (output->size() != depth_image.size()) {
+    // uninitialized iff we are going to fill it in below.  When removing
+    // invalid points, the final size is only known at the end; the capacity
+    // is kept at the full size so that the cloud is not reallocated from one
+    // image to the next.
+    if (params.remove_invalid_points) {
+        output->reserve(max_size);
+    }
+    if (output->size() != max_size) {
         const bool skip_initialize = (output->fields().base_fields() == kXYZs);
-        output->resize(depth_image.size(), skip_initialize);
+        output->resize(max_size, skip_initialize);
     }
     Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
     std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
@@ -69,32 +81,42 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
         output_rgb = output->mutable_rgbs();
     }
 
-    const int height = depth_image.height();
-    const int width = depth_image.width();
-    const float cx = camera_info.center_x();
-    const float cy = camera_info.center_y();
-    const float fx_inv = 1.f / camera_info.focal_x();
-    const float fy_inv = 1.f / camera_info.focal_y();
+    internal::DepthBackProjection projection{};
     const math::RigidTransform<float> X_PC =
             (camera_pose != nullptr) ? camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
+    Eigen::Map<Eigen::Matrix3f>(projection.X_PC) = X_PC.rotation().matrix();
+    Eigen::Map<Vector3f>(projection.X_PC + 9) = X_PC.translation();
+    projection.scale = scale;
+    projection.center_x = camera_info.center_x();
+    projection.center_y = camera_info.center_y();
+    projection.focal_x_inv = 1.f / camera_info.focal_x();
+    projection.focal_y_inv = 1.f / camera_info.focal_y();
+    projection.stride = stride;
+    projection.remove_invalid = params.remove_invalid_points;
+
+    // The columns (in units of the stride) of the pixels that were kept.
+    std::vector<int> kept;
+    if (color_image && params.remove_invalid_points) {
+        kept.resize(num_cols);
+    }
 
-    for (int v = 0; v < height; ++v) {
-        for (int u = 0; u < width; ++u) {
-            const int col = v * width + u;
-            const auto z = depth_image.at(u, v)[0];
-            if ((z == ImageTraits<pixel_type>::kTooClose) || (z == ImageTraits<pixel_type>::kTooFar)) {
-                output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-            } else {
-                // N.B. This clause handles both true depths *and* NaNs.
-                output_xyz.col(col) =
-                        X_PC * Vector3f(scale * z * (u - cx) * fx_inv, scale * z * (v - cy) * fy_inv, scale * z);
-            }
-            if (color_image) {
-                const auto color = color_image->at(u, v);
+    int num_points = 0;
+    for (int v = 0; v < height; v += stride) {
+        const int row_start = num_points;
+        num_points += internal::BackProjectDepthRow(projection, depth_image.at(0, v), v, num_cols,
+                                                    output_xyz.data() + 3 * row_start,
+                                                    kept.empty() ? nullptr : kept.data());
+        if (color_image) {
+            for (int col = row_start; col < num_points; ++col) {
+                const int i = kept.empty() ? (col - row_start) : kept[col - row_start];
+                const auto color = color_image->at(i * stride, v);
                 output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
             }
         }
     }
+    if (num_points != max_size) {
+        output->resize(num_points);
+    }
 }
 
 }  // namespace
@@ -102,8 +124,11 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
 DepthImageToPointCloud::DepthImageToPointCloud(const CameraInfo& camera_info,
                                                PixelType depth_pixel_type,
                                                float scale,
-                                               const pc_flags::BaseFieldT fields)
-    : camera_info_(camera_info), depth_pixel_type_(depth_pixel_type), scale_(scale), fields_(fields) {
+                                               const pc_flags::BaseFieldT fields,
+                                               const DepthImageToPointCloudParams& params)
+    : camera_info_(camera_info), depth_pixel_type_(depth_pixel_type), scale_(scale), fields_(fields), params_(params) {
+    DRAKE_THROW_UNLESS(params.stride >= 1);
+
     // Input port for depth image.
     depth_image_input_port_ =
             this->DeclareAbstractInputPort("depth_image", GetModelValue(depth_pixel_type)).get_index();
@@ -129,7 +154,7 @@ void DepthImageToPointCloud::Convert(const systems::sensors::CameraInfo& camera_
                                      const std::optional<float>& scale,
                                      PointCloud* output) {
     DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr, depth_image,
-              color_image ? &*color_image : nullptr, scale.value_or(1.0f), output);
+              color_image ? &*color_image : nullptr, scale.value_or(1.0f), {}, output);
 }
 
 void DepthImageToPointCloud::Convert(const systems::sensors::CameraInfo& camera_info,
@@ -139,7 +164,7 @@ void DepthImageToPointCloud::Convert(const systems::sensors::CameraInfo& camera_
                                      const std::optional<float>& scale,
                                      PointCloud* output) {
     DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr, depth_image,
-              color_image ? &*color_image : nullptr, scale.value_or(1.0f), output);
+              color_image ? &*color_image : nullptr, scale.value_or(1.0f), {}, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(const systems::Context<double>& context, PointCloud* output) const {
@@ -147,7 +172,7 @@ void DepthImageToPointCloud::CalcOutput32F(const systems::Context<double>& conte
     const auto* const color_image_or_null = this->EvalInputValue<ImageRgba8U>(context, color_image_input_port_);
     const auto* const pose_or_null = this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
     DRAKE_THROW_UNLESS(depth_image != nullptr);
-    DoConvert(fields_, camera_info_, pose_or_null, *depth_image, color_image_or_null, scale_, output);
+    DoConvert(fields_, camera_info_, pose_or_null, *depth_image, color_image_or_null, scale_, params_, output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(const systems::Context<double>& context, PointCloud* output) const {
@@ -155,7 +180,7 @@ void DepthImageToPointCloud::CalcOutput16U(const systems::Context<double>& conte
     const auto* const color_image_or_null = this->EvalInputValue<ImageRgba8U>(context, color_image_input_port_);
     const auto* const pose_or_null = this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
     DRAKE_THROW_UNLESS(depth_image != nullptr);
-    DoConvert(fields_, camera_info_, pose_or_null, *depth_image, color_image_or_null, scale_, output);
+    DoConvert(fields_, camera_info_, pose_or_null, *depth_image, color_image_or_null, scale_, params_, output);
 }
 
 }  // namespace perception
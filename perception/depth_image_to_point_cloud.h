@@ -17,6 +17,19 @@
 namespace drake {
 namespace perception {
 
+/// The set of optional parameters for DepthImageToPointCloud.
+struct DepthImageToPointCloudParams {
+    /// Only every `stride`-th pixel of every `stride`-th row (starting from the
+    /// pixel (0, 0)) is converted, which reduces the size of the cloud (and the
+    /// cost of the conversion) by a factor of about `stride`².
+    int stride{1};
+
+    /// When true, the pixels without a valid depth (NaN, kTooClose, or kTooFar)
+    /// are omitted from the point cloud instead of being converted to
+    /// non-finite points, so the size of the cloud varies from image to image.
+    bool remove_invalid_points{false};
+};
+
 /// Converts a depth image to a point cloud.
 ///
 /// @system
@@ -42,7 +55,12 @@ namespace perception {
 /// If a pixel is NaN, the converted point will be (NaN, NaN, NaN).  If a pixel
 /// is kTooClose or kTooFar (as defined by ImageTraits), the converted point
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
-/// the Point Cloud Library (PCL).
+/// the Point Cloud Library (PCL).  Refer to DepthImageToPointCloudParams for
+/// how to subsample the image or omit such points instead.
+///
+/// The conversion uses SIMD instructions to convert many pixels at once, and
+/// it reuses the memory of the output port's PointCloud from one evaluation to
+/// the next (even when its size varies because invalid points are omitted).
 ///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
@@ -58,11 +76,13 @@ public:
     ///   before projecting to a point cloud.  (This is useful for converting mm
     ///   to meters, etc.)
     /// @param[in] fields The fields the point cloud contains.
+    /// @param[in] params The optional parameters of the conversion.
     explicit DepthImageToPointCloud(
             const systems::sensors::CameraInfo& camera_info,
             systems::sensors::PixelType depth_pixel_type = systems::sensors::PixelType::kDepth32F,
             float scale = 1.0,
-            pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+            pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+            const DepthImageToPointCloudParams& params = {});
 
     /// Returns the abstract valued input port that expects either an
     /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -125,6 +145,7 @@ private:
     const systems::sensors::PixelType depth_pixel_type_;
     const float scale_;
     const pc_flags::BaseFieldT fields_;
+    const DepthImageToPointCloudParams params_;
 
     systems::InputPortIndex depth_image_input_port_{};
     systems::InputPortIndex color_image_input_port_{};
@@ -0,0 +1,212 @@
+/* clang-format off to disable clang-format-includes */
+#include "perception/depth_image_to_point_cloud_kernels.h"
+/* clang-format on */
+
+#include <algorithm>
+#include <cstdint>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "perception/depth_image_to_point_cloud_kernels.cc"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+#pragma GCC diagnostic pop
+
+#include "common/hwy_dynamic_impl.h"
+#include "systems/sensors/pixel_types.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace perception {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+/* The kernel processes one vector of Lanes(df) pixels at a time: it loads the
+depths (directly from the image, except for a partial vector at the end of the
+row or when subsampling, which are gathered into a buffer), back-projects and
+transforms all of the lanes with fused multiply-adds, and then either stores the
+xyz triples interleaved or, when removing invalid pixels, compresses the valid
+lanes before storing them. */
+
+// The number of elements in a buffer that can hold any vector of floats.
+constexpr int kMaxLanes = HWY_MAX_BYTES / sizeof(float);
+
+// Loads the depths of the `num` samples starting at sample i (where sample j is
+// the pixel depth_row[j * stride]) into the leading lanes of a vector.
+template <class DF>
+hn::Vec<DF> LoadDepths(DF df, const float* depth_row, int i, int num, int stride) {
+    if (stride == 1 && num == static_cast<int>(hn::Lanes(df))) {
+        return hn::LoadU(df, depth_row + i);
+    }
+    HWY_ALIGN float buffer[kMaxLanes] = {};
+    for (int j = 0; j < num; ++j) {
+        buffer[j] = depth_row[(i + j) * stride];
+    }
+    return hn::Load(df, buffer);
+}
+
+template <class DF>
+hn::Vec<DF> LoadDepths(DF df, const uint16_t* depth_row, int i, int num, int stride) {
+    if (stride == 1 && num == static_cast<int>(hn::Lanes(df))) {
+        const hn::Rebind<uint16_t, DF> d16;
+        const hn::Rebind<int32_t, DF> d32;
+        return hn::ConvertTo(df, hn::PromoteTo(d32, hn::LoadU(d16, depth_row + i)));
+    }
+    HWY_ALIGN float buffer[kMaxLanes] = {};
+    for (int j = 0; j < num; ++j) {
+        buffer[j] = static_cast<float>(depth_row[(i + j) * stride]);
+    }
+    return hn::Load(df, buffer);
+}
+
+template <PixelType pixel_type, typename DepthType>
+int BackProjectRow(const DepthBackProjection* projection,
+                   const DepthType* depth_row,
+                   int v,
+                   int count,
+                   float* xyz,
+                   int* kept) {
+    const hn::ScalableTag<float> df;
+    const hn::RebindToSigned<decltype(df)> di;
+    const int lanes = static_cast<int>(hn::Lanes(df));
+
+    const float* const X_PC = projection->X_PC;
+    const auto r00 = hn::Set(df, X_PC[0]);
+    const auto r10 = hn::Set(df, X_PC[1]);
+    const auto r20 = hn::Set(df, X_PC[2]);
+    const auto r01 = hn::Set(df, X_PC[3]);
+    const auto r11 = hn::Set(df, X_PC[4]);
+    const auto r21 = hn::Set(df, X_PC[5]);
+    const auto r02 = hn::Set(df, X_PC[6]);
+    const auto r12 = hn::Set(df, X_PC[7]);
+    const auto r22 = hn::Set(df, X_PC[8]);
+    const auto p_x = hn::Set(df, X_PC[9]);
+    const auto p_y = hn::Set(df, X_PC[10]);
+    const auto p_z = hn::Set(df, X_PC[11]);
+
+    const auto scale = hn::Set(df, projection->scale);
+    // For the sample i, (u - cx) / fx = i * (stride / fx) - cx / fx.
+    const auto x_slope = hn::Set(df, projection->stride * projection->focal_x_inv);
+    const auto x_offset = hn::Set(df, -projection->center_x * projection->focal_x_inv);
+    const auto y_factor = hn::Set(df, (v - projection->center_y) * projection->focal_y_inv);
+    const auto too_close = hn::Set(df, static_cast<float>(ImageTraits<pixel_type>::kTooClose));
+    const auto too_far = hn::Set(df, static_cast<float>(ImageTraits<pixel_type>::kTooFar));
+    const auto infinity = hn::Inf(df);
+
+    HWY_ALIGN float x_buffer[kMaxLanes];
+    HWY_ALIGN float y_buffer[kMaxLanes];
+    HWY_ALIGN float z_buffer[kMaxLanes];
+    HWY_ALIGN int32_t i_buffer[kMaxLanes];
+
+    int num_written = 0;
+    for (int i = 0; i < count; i += lanes) {
+        const int num = std::min(lanes, count - i);
+        const auto depth = LoadDepths(df, depth_row, i, num, projection->stride);
+
+        // Back-project into C, then transform into P.
+        const auto z_C = hn::Mul(depth, scale);
+        const auto x_C = hn::Mul(z_C, hn::MulAdd(hn::Iota(df, i), x_slope, x_offset));
+        const auto y_C = hn::Mul(z_C, y_factor);
+        auto x_P = hn::MulAdd(r02, z_C, hn::MulAdd(r01, y_C, hn::MulAdd(r00, x_C, p_x)));
+        auto y_P = hn::MulAdd(r12, z_C, hn::MulAdd(r11, y_C, hn::MulAdd(r10, x_C, p_y)));
+        auto z_P = hn::MulAdd(r22, z_C, hn::MulAdd(r21, y_C, hn::MulAdd(r20, x_C, p_z)));
+        const auto out_of_range = hn::Or(hn::Eq(depth, too_close), hn::Eq(depth, too_far));
+
+        if (!projection->remove_invalid) {
+            // N.B. NaN depths already produce NaN points.
+            x_P = hn::IfThenElse(out_of_range, infinity, x_P);
+            y_P = hn::IfThenElse(out_of_range, infinity, y_P);
+            z_P = hn::IfThenElse(out_of_range, infinity, z_P);
+            float* const output = xyz + 3 * i;
+            if (num == lanes) {
+                hn::StoreInterleaved3(x_P, y_P, z_P, df, output);
+            } else {
+                hn::Store(x_P, df, x_buffer);
+                hn::Store(y_P, df, y_buffer);
+                hn::Store(z_P, df, z_buffer);
+                for (int j = 0; j < num; ++j) {
+                    output[3 * j] = x_buffer[j];
+                    output[3 * j + 1] = y_buffer[j];
+                    output[3 * j + 2] = z_buffer[j];
+                }
+            }
+            num_written += num;
+        } else {
+            const auto valid = hn::AndNot(hn::Or(out_of_range, hn::IsNaN(depth)), hn::FirstN(df, num));
+            const int num_valid = static_cast<int>(hn::CompressStore(x_P, valid, df, x_buffer));
+            hn::CompressStore(y_P, valid, df, y_buffer);
+            hn::CompressStore(z_P, valid, df, z_buffer);
+            float* const output = xyz + 3 * num_written;
+            for (int j = 0; j < num_valid; ++j) {
+                output[3 * j] = x_buffer[j];
+                output[3 * j + 1] = y_buffer[j];
+                output[3 * j + 2] = z_buffer[j];
+            }
+            if (kept != nullptr) {
+                hn::CompressStore(hn::Iota(di, i), hn::RebindMask(di, valid), di, i_buffer);
+                std::copy(i_buffer, i_buffer + num_valid, kept + num_written);
+            }
+            num_written += num_valid;
+        }
+    }
+    return num_written;
+}
+
+int BackProjectRow32FImpl(
+        const DepthBackProjection* projection, const float* depth_row, int v, int count, float* xyz, int* kept) {
+    return BackProjectRow<PixelType::kDepth32F>(projection, depth_row, v, count, xyz, kept);
+}
+
+int BackProjectRow16UImpl(
+        const DepthBackProjection* projection, const uint16_t* depth_row, int v, int count, float* xyz, int* kept) {
+    return BackProjectRow<PixelType::kDepth16U>(projection, depth_row, v, count, xyz, kept);
+}
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace perception {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(BackProjectRow32FImpl);
+struct ChooseBestBackProjectRow32F {
+    auto operator()() { return HWY_DYNAMIC_POINTER(BackProjectRow32FImpl); }
+};
+HWY_EXPORT(BackProjectRow16UImpl);
+struct ChooseBestBackProjectRow16U {
+    auto operator()() { return HWY_DYNAMIC_POINTER(BackProjectRow16UImpl); }
+};
+
+}  // namespace
+
+int BackProjectDepthRow(
+        const DepthBackProjection& projection, const float* depth_row, int v, int count, float* xyz, int* kept) {
+    return LateBoundFunction<ChooseBestBackProjectRow32F>::Call(&projection, depth_row, v, count, xyz, kept);
+}
+
+int BackProjectDepthRow(
+        const DepthBackProjection& projection, const uint16_t* depth_row, int v, int count, float* xyz, int* kept) {
+    return LateBoundFunction<ChooseBestBackProjectRow16U>::Call(&projection, depth_row, v, count, xyz, kept);
+}
+
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
+#endif  // HWY_ONCE
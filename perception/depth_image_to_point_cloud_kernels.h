@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+
+namespace drake {
+namespace perception {
+namespace internal {
+
+/* The parameters of BackProjectDepthRow() that are shared by all of the rows
+of an image. */
+struct DepthBackProjection {
+    /* The pose X_PC of the camera C in the output frame P, in column-major
+    order: the nine elements of R_PC followed by the three of p_PC. */
+    float X_PC[12];
+    /* The factor by which each depth is multiplied. */
+    float scale;
+    /* The camera intrinsics (see CameraInfo). */
+    float center_x;
+    float center_y;
+    float focal_x_inv;
+    float focal_y_inv;
+    /* Only the pixels in the columns u = 0, stride, 2 * stride, ... of each
+    row are back-projected. */
+    int stride;
+    /* When true, the pixels without a valid depth are omitted from the
+    output (see below). */
+    bool remove_invalid;
+};
+
+/* Back-projects the pixels (u = i * stride, v) for i in [0, count) of a depth
+image, where `depth_row` points at the pixel (0, v), and writes the points (in
+the frame P) as consecutive xyz triples to `xyz`. Returns the number of points
+written.
+
+Depths of kTooClose or kTooFar (see ImageTraits) produce points of (+Inf, +Inf,
++Inf), and NaN depths produce points of (NaN, NaN, NaN); or, if
+`remove_invalid` is set, such pixels are skipped and (if `kept` is non-null)
+the index i of each pixel that was written is stored in `kept`.
+
+These functions use SIMD instructions (chosen at runtime for the host CPU) to
+convert many pixels at once.
+
+@pre `xyz` has room for 3 * count floats, and `kept` (if non-null) for count
+ints. */
+int BackProjectDepthRow(const DepthBackProjection& projection, const float* depth_row, int v, int count, float* xyz,
+                        int* kept);
+int BackProjectDepthRow(const DepthBackProjection& projection, const uint16_t* depth_row, int v, int count,
+                        float* xyz, int* kept);
+
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
@@ -2,7 +2,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <bit>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -33,6 +37,96 @@ typedef PointCloud::T T;
 typedef PointCloud::C C;
 typedef PointCloud::D D;
 
+// Adapts the finite columns of a 3xN matrix of xyzs into a nanoflann dataset,
+// without copying them. The k-th point of the dataset is the column
+// point_index(k) of the matrix.
+class XyzsDatasetAdaptor {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(XyzsDatasetAdaptor);
+
+    explicit XyzsDatasetAdaptor(const Eigen::Ref<const Matrix3X<T>>& xyzs) : xyzs_(xyzs) {
+        point_indices_.reserve(xyzs.cols());
+        for (int i = 0; i < xyzs.cols(); ++i) {
+            if (xyzs.col(i).array().isFinite().all()) {
+                point_indices_.push_back(i);
+            }
+        }
+    }
+
+    int point_index(uint32_t k) const { return point_indices_[k]; }
+
+    // The interface required by nanoflann.
+    size_t kdtree_get_point_count() const { return point_indices_.size(); }
+    T kdtree_get_pt(uint32_t k, size_t dim) const { return xyzs_(dim, point_indices_[k]); }
+    template <class BoundingBox>
+    bool kdtree_get_bbox(BoundingBox&) const {
+        return false;
+    }
+
+private:
+    const Eigen::Ref<const Matrix3X<T>> xyzs_;
+    std::vector<int> point_indices_;
+};
+
+// A k-d tree over the finite xyzs of a point cloud. The xyzs must not be
+// reallocated during the lifetime of this index, and the index must not be
+// used once they have been modified.
+class SpatialIndex {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SpatialIndex);
+
+    explicit SpatialIndex(const Eigen::Ref<const Matrix3X<T>>& xyzs)
+        : dataset_(xyzs), tree_(3, dataset_, nanoflann::KDTreeSingleIndexAdaptorParams(kLeafMaxSize)) {}
+
+    // Writes the indices and squared distances of the (up to) `num_closest`
+    // points nearest to `query` in order of increasing distance; returns the
+    // number found.
+    int FindNearest(const T* query, int num_closest, int* indices, T* squared_distances) const {
+        if (dataset_.kdtree_get_point_count() == 0) {
+            return 0;
+        }
+        // nanoflann reports dataset positions, which we then map (in place) to
+        // point indices. (Accessing an int through its unsigned counterpart is
+        // allowed by the aliasing rules.)
+        uint32_t* const positions = reinterpret_cast<uint32_t*>(indices);
+        const int num_found = tree_.knnSearch(query, num_closest, positions, squared_distances);
+        for (int j = 0; j < num_found; ++j) {
+            indices[j] = dataset_.point_index(positions[j]);
+        }
+        return num_found;
+    }
+
+    // Sets `indices` to the indices of the points within `squared_radius`
+    // (squared distance) of `query` in order of increasing distance. Uses
+    // `matches` as scratch space.
+    void FindWithinRadius(const T* query,
+                          T squared_radius,
+                          std::vector<nanoflann::ResultItem<uint32_t, T>>* matches,
+                          std::vector<int>* indices) const {
+        matches->clear();
+        indices->clear();
+        if (dataset_.kdtree_get_point_count() == 0) {
+            return;
+        }
+        tree_.radiusSearch(query, squared_radius, *matches);
+        indices->reserve(matches->size());
+        for (const auto& match : *matches) {
+            indices->push_back(dataset_.point_index(match.first));
+        }
+    }
+
+private:
+    using KdTree = nanoflann::
+            KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<T, XyzsDatasetAdaptor>, XyzsDatasetAdaptor, 3>;
+
+    // The maximum number of points per leaf of the tree; nanoflann's default.
+    static constexpr int kLeafMaxSize = 10;
+
+    // N.B. The tree refers to the dataset, so it must be declared after it.
+    const XyzsDatasetAdaptor dataset_;
+    const KdTree tree_;
+};
+
 }  // namespace
 
 /*
@@ -60,57 +154,129 @@ public:
     // Returns size of the storage.
     int size() const { return size_; }
 
-    // Resize to parent cloud's size.
+    // Returns the number of points for which memory is allocated.
+    int capacity() const { return capacity_; }
+
+    // Resize to parent cloud's size. Memory is only reallocated when the new
+    // size exceeds the capacity.
     void resize(int new_size) {
+        InvalidateSpatialIndex();
+        if (new_size > capacity_) {
+            Reallocate(new_size);
+        }
         size_ = new_size;
-        if (fields_.contains(pc_flags::kXYZs)) xyzs_.conservativeResize(NoChange, new_size);
-        if (fields_.contains(pc_flags::kNormals)) normals_.conservativeResize(NoChange, new_size);
-        if (fields_.contains(pc_flags::kRGBs)) rgbs_.conservativeResize(NoChange, new_size);
-        if (fields_.has_descriptor()) descriptors_.conservativeResize(NoChange, new_size);
         CheckInvariants();
     }
 
+    // Ensures that the capacity is at least `new_capacity`.
+    void reserve(int new_capacity) {
+        if (new_capacity > capacity_) {
+            InvalidateSpatialIndex();
+            Reallocate(new_capacity);
+            CheckInvariants();
+        }
+    }
+
     // Update fields, allocating (but not initializing) new fields when needed.
     void UpdateFields(pc_flags::Fields f) {
-        xyzs_.conservativeResize(NoChange, f.contains(pc_flags::kXYZs) ? size_ : 0);
-        normals_.conservativeResize(NoChange, f.contains(pc_flags::kNormals) ? size_ : 0);
-        rgbs_.conservativeResize(NoChange, f.contains(pc_flags::kRGBs) ? size_ : 0);
+        if (f.contains(pc_flags::kXYZs) != fields_.contains(pc_flags::kXYZs)) {
+            InvalidateSpatialIndex();
+        }
+        xyzs_.conservativeResize(NoChange, f.contains(pc_flags::kXYZs) ? capacity_ : 0);
+        normals_.conservativeResize(NoChange, f.contains(pc_flags::kNormals) ? capacity_ : 0);
+        rgbs_.conservativeResize(NoChange, f.contains(pc_flags::kRGBs) ? capacity_ : 0);
         // Note: The row size can change depends on whether 'f' contains a
         // descriptor field and the type of the descriptor.
-        descriptors_.conservativeResize(f.descriptor_type().size(), f.has_descriptor() ? size_ : 0);
+        descriptors_.conservativeResize(f.descriptor_type().size(), f.has_descriptor() ? capacity_ : 0);
         fields_ = f;
         CheckInvariants();
     }
 
-    Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_; }
-    Eigen::Ref<Matrix3X<T>> normals() { return normals_; }
-    Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_; }
-    Eigen::Ref<MatrixX<T>> descriptors() { return descriptors_; }
+    // The matrices may have more columns than points (see capacity()), so
+    // only their leading columns are exposed.
+    Eigen::Ref<Matrix3X<T>> xyzs() { return xyzs_.leftCols(size_); }
+    Eigen::Ref<Matrix3X<T>> normals() { return normals_.leftCols(size_); }
+    Eigen::Ref<Matrix3X<C>> rgbs() { return rgbs_.leftCols(size_); }
+    Eigen::Ref<MatrixX<T>> descriptors() { return descriptors_.leftCols(size_); }
+
+    // Returns the spatial index over the xyzs, (re)building it if there is
+    // none or the xyzs have changed since it was built.
+    // @pre The fields contain kXYZs.
+    const SpatialIndex& GetSpatialIndex() {
+        std::lock_guard<std::mutex> lock(spatial_index_mutex_);
+        const uint64_t xyzs_hash = CalcXyzsHash();
+        if (spatial_index_ == nullptr || xyzs_hash != spatial_index_xyzs_hash_) {
+            spatial_index_ = std::make_unique<SpatialIndex>(xyzs_.leftCols(size_));
+            spatial_index_xyzs_hash_ = xyzs_hash;
+        }
+        return *spatial_index_;
+    }
+
+    // Returns the spatial index over the xyzs if it is built and the xyzs
+    // haven't changed since, or nullptr.
+    const SpatialIndex* MaybeGetSpatialIndex() {
+        std::lock_guard<std::mutex> lock(spatial_index_mutex_);
+        if (spatial_index_ != nullptr && CalcXyzsHash() != spatial_index_xyzs_hash_) {
+            spatial_index_.reset();
+        }
+        return spatial_index_.get();
+    }
+
+    // Discards the spatial index; this must be called whenever the xyzs may be
+    // reallocated. (Changes to their values are detected by the queries.)
+    void InvalidateSpatialIndex() {
+        std::lock_guard<std::mutex> lock(spatial_index_mutex_);
+        spatial_index_.reset();
+    }
 
 private:
+    // Returns a hash (FNV-1a) of the bit patterns of the xyzs, with which the
+    // queries detect that the xyzs have been written since the spatial index
+    // was built.
+    uint64_t CalcXyzsHash() const {
+        static_assert(sizeof(T) == sizeof(uint32_t));
+        uint64_t hash = 14695981039346656037ULL;
+        const T* const values = xyzs_.data();
+        const int num_values = 3 * (fields_.contains(pc_flags::kXYZs) ? size_ : 0);
+        for (int i = 0; i < num_values; ++i) {
+            hash = (hash ^ std::bit_cast<uint32_t>(values[i])) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Reallocates every field's matrix to have `new_capacity` columns,
+    // preserving the first size_ columns.
+    void Reallocate(int new_capacity) {
+        capacity_ = new_capacity;
+        if (fields_.contains(pc_flags::kXYZs)) xyzs_.conservativeResize(NoChange, new_capacity);
+        if (fields_.contains(pc_flags::kNormals)) normals_.conservativeResize(NoChange, new_capacity);
+        if (fields_.contains(pc_flags::kRGBs)) rgbs_.conservativeResize(NoChange, new_capacity);
+        if (fields_.has_descriptor()) descriptors_.conservativeResize(NoChange, new_capacity);
+    }
+
     void CheckInvariants() const {
         const int xyz_size = xyzs_.cols();
         if (fields_.contains(pc_flags::kXYZs)) {
-            DRAKE_DEMAND(xyz_size == size());
+            DRAKE_DEMAND(xyz_size == capacity());
         } else {
             DRAKE_DEMAND(xyz_size == 0);
         }
         const int normals_size = normals_.cols();
         if (fields_.contains(pc_flags::kNormals)) {
-            DRAKE_DEMAND(normals_size == size());
+            DRAKE_DEMAND(normals_size == capacity());
         } else {
             DRAKE_DEMAND(normals_size == 0);
         }
         const int rgbs_size = rgbs_.cols();
         if (fields_.contains(pc_flags::kRGBs)) {
-            DRAKE_DEMAND(rgbs_size == size());
+            DRAKE_DEMAND(rgbs_size == capacity());
         } else {
             DRAKE_DEMAND(rgbs_size == 0);
         }
         const int descriptor_cols = descriptors_.cols();
         const int descriptor_rows = descriptors_.rows();
         if (fields_.has_descriptor()) {
-            DRAKE_DEMAND(descriptor_cols == size());
+            DRAKE_DEMAND(descriptor_cols == capacity());
             DRAKE_DEMAND(descriptor_rows == fields_.descriptor_type().size());
         } else {
             DRAKE_DEMAND(descriptor_cols == 0);
@@ -120,10 +286,17 @@ private:
 
     pc_flags::Fields fields_;
     int size_{};
+    int capacity_{};
     Matrix3X<T> xyzs_;
     Matrix3X<T> normals_;
     Matrix3X<C> rgbs_;
     MatrixX<T> descriptors_;
+
+    // A lazily-built index over xyzs_, and the hash of the xyzs it was built
+    // over; see PointCloud's "Spatial Queries".
+    std::mutex spatial_index_mutex_;
+    std::unique_ptr<SpatialIndex> spatial_index_;
+    uint64_t spatial_index_xyzs_hash_{};
 };
 
 namespace {
@@ -207,6 +380,15 @@ void PointCloud::resize(int new_size, bool skip_initialization) {
     }
 }
 
+int PointCloud::capacity() const {
+    return storage_->capacity();
+}
+
+void PointCloud::reserve(int new_capacity) {
+    DRAKE_DEMAND(new_capacity >= 0);
+    storage_->reserve(new_capacity);
+}
+
 void PointCloud::SetFields(pc_flags::Fields new_fields, bool skip_initialize) {
     const pc_flags::Fields old_fields = storage_->fields();
     if (old_fields == new_fields) return;
@@ -369,10 +551,32 @@ PointCloud PointCloud::Crop(const Eigen::Ref<const Vector3<T>>& lower_xyz,
         throw std::runtime_error("PointCloud must have xyzs in order to Crop");
     }
     PointCloud crop(size(), storage_->fields(), true);
+    auto is_inside = [this, &lower_xyz, &upper_xyz](int i) {
+        return ((xyzs().col(i).array() >= lower_xyz.array()) && (xyzs().col(i).array() <= upper_xyz.array())).all();
+    };
+    // If the spatial index is available, only visit the points within the
+    // box's circumscribed sphere (in their original order).
+    std::vector<int> candidates;
+    const SpatialIndex* const spatial_index =
+            lower_xyz.allFinite() && upper_xyz.allFinite() ? storage_->MaybeGetSpatialIndex() : nullptr;
+    const bool use_index = spatial_index != nullptr;
+    if (use_index) {
+        const Vector3<T> center = (lower_xyz + upper_xyz) / 2;
+        // Pad the radius so that round-off (and the search's exclusion of
+        // points at exactly the radius) cannot drop the box's corners.
+        const T radius = (upper_xyz - lower_xyz).norm() / 2 * T(1.001) + T(1e-6);
+        const T squared_radius = radius * radius;
+        std::vector<nanoflann::ResultItem<uint32_t, T>> matches;
+        spatial_index->FindWithinRadius(center.data(), squared_radius, &matches, &candidates);
+        std::sort(candidates.begin(), candidates.end());
+    }
+    const int num_candidates = use_index ? static_cast<int>(candidates.size()) : size();
+    Eigen::Ref<Matrix3X<T>> crop_xyzs = crop.mutable_xyzs();
     int index = 0;
-    for (int i = 0; i < size(); ++i) {
-        if (((xyzs().col(i).array() >= lower_xyz.array()) && (xyzs().col(i).array() <= upper_xyz.array())).all()) {
-            crop.mutable_xyzs().col(index) = xyzs().col(i);
+    for (int k = 0; k < num_candidates; ++k) {
+        const int i = use_index ? candidates[k] : k;
+        if (is_inside(i)) {
+            crop_xyzs.col(index) = xyzs().col(i);
             if (has_normals()) {
                 crop.mutable_normals().col(index) = normals().col(i);
             }
@@ -568,8 +772,7 @@ bool PointCloud::EstimateNormals(const double radius,
         storage_->UpdateFields(storage_->fields() | pc_flags::kNormals);
     }
 
-    const Eigen::MatrixX3f data = xyzs().transpose();
-    nanoflann::KDTreeEigenMatrixAdaptor<Eigen::MatrixX3f, 3, nanoflann::metric_L2_Simple> kd_tree(3, data);
+    const SpatialIndex& spatial_index = storage_->GetSpatialIndex();
 
     // Iterate through all points and compute their normals.
     std::atomic<bool> all_points_have_at_least_three_neighbors(true);
@@ -578,16 +781,18 @@ bool PointCloud::EstimateNormals(const double radius,
 #pragma omp parallel for num_threads(parallelize.num_threads())
 #endif
     for (int i = 0; i < size(); ++i) {
-        VectorX<Eigen::Index> indices(num_closest);
+        VectorX<int> indices(num_closest);
         Eigen::VectorXf distances(num_closest);
+        const Eigen::Vector3f query = xyz(i);
 
         // nanoflann allows two types of queries:
         // 1. search for the num_closest points, and then keep those within radius
         // 2. search for points within radius, and then keep the num_closest
         // for dense clouds where the number of points within radius would be high,
         // approach (1) is considerably faster.
-        const int num_neighbors =
-                kd_tree.index_->knnSearch(xyz(i).data(), num_closest, indices.data(), distances.data());
+        const int num_neighbors = query.allFinite() ? spatial_index.FindNearest(query.data(), num_closest,
+                                                                                  indices.data(), distances.data())
+                                                    : 0;
 
         if (num_neighbors < 3) {
             all_points_have_at_least_three_neighbors = false;
@@ -638,5 +843,72 @@ bool PointCloud::EstimateNormals(const double radius,
     return all_points_have_at_least_three_neighbors.load();
 }
 
+void PointCloud::FindNearestNeighbors(const Eigen::Ref<const Matrix3X<T>>& queries,
+                                      const int num_neighbors,
+                                      MatrixX<int>* indices,
+                                      MatrixX<T>* squared_distances,
+                                      [[maybe_unused]] const Parallelism parallelize) const {
+    DRAKE_DEMAND(num_neighbors >= 1);
+    DRAKE_THROW_UNLESS(has_xyzs());
+    DRAKE_THROW_UNLESS(indices != nullptr);
+    const SpatialIndex& spatial_index = storage_->GetSpatialIndex();
+
+    const int num_queries = queries.cols();
+    MatrixX<T> distances_storage;
+    MatrixX<T>& distances = (squared_distances != nullptr) ? *squared_distances : distances_storage;
+    indices->setConstant(num_neighbors, num_queries, -1);
+    distances.setConstant(num_neighbors, num_queries, std::numeric_limits<T>::infinity());
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parallelize.num_threads())
+#endif
+    for (int q = 0; q < num_queries; ++q) {
+        const Vector3<T> query = queries.col(q);
+        if (query.allFinite()) {
+            spatial_index.FindNearest(query.data(), num_neighbors, indices->col(q).data(), distances.col(q).data());
+        }
+    }
+}
+
+std::vector<std::vector<int>> PointCloud::FindNeighborsWithinRadius(const Eigen::Ref<const Matrix3X<T>>& queries,
+                                                                    const double radius,
+                                                                    [[maybe_unused]] const Parallelism parallelize)
+        const {
+    DRAKE_DEMAND(radius >= 0);
+    DRAKE_THROW_UNLESS(has_xyzs());
+    const SpatialIndex& spatial_index = storage_->GetSpatialIndex();
+    const T squared_radius = static_cast<T>(radius * radius);
+
+    const int num_queries = queries.cols();
+    std::vector<std::vector<int>> neighbors(num_queries);
+
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(parallelize.num_threads())
+#endif
+    {
+        // Each thread reuses its own scratch space across queries.
+        std::vector<nanoflann::ResultItem<uint32_t, T>> matches;
+#if defined(_OPENMP)
+#pragma omp for
+#endif
+        for (int q = 0; q < num_queries; ++q) {
+            const Vector3<T> query = queries.col(q);
+            if (query.allFinite()) {
+                spatial_index.FindWithinRadius(query.data(), squared_radius, &matches, &neighbors[q]);
+            }
+        }
+    }
+    return neighbors;
+}
+
+void PointCloud::BuildSpatialIndex() const {
+    DRAKE_THROW_UNLESS(has_xyzs());
+    storage_->GetSpatialIndex();
+}
+
+bool PointCloud::has_spatial_index() const {
+    return storage_->MaybeGetSpatialIndex() != nullptr;
+}
+
 }  // namespace perception
 }  // namespace drake
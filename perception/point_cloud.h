@@ -130,6 +130,16 @@ public:
     ///    Do not default-initialize new values.
     void resize(int new_size, bool skip_initialize = false);
 
+    /// Returns the number of points for which memory is allocated. Resizing
+    /// to at most this many points does not reallocate memory.
+    int capacity() const;
+
+    /// Allocates memory for (at least) `new_capacity` points, so that later
+    /// calls to resize() up to that size do not reallocate, e.g., when a cloud
+    /// whose size varies from frame to frame is refilled at each frame. Does
+    /// not change size() or the values of the points.
+    void reserve(int new_capacity);
+
     /// @name Geometric Descriptors - XYZs
     /// @{
 
@@ -296,7 +306,10 @@ public:
 
     /// Returns a new point cloud containing only the points in `this` with xyz
     /// values within the axis-aligned bounding box defined by `lower_xyz` and
-    /// `upper_xyz`. Requires that xyz values are defined.
+    /// `upper_xyz`. Requires that xyz values are defined. If this cloud's
+    /// spatial index has already been built (see
+    /// @ref point_cloud_spatial_queries "Spatial Queries"), it is used to visit
+    /// only the points near the box.
     /// @pre lower_xyz <= upper_xyz (elementwise).
     /// @throws std::exception if has_xyzs() != true.
     PointCloud Crop(const Eigen::Ref<const Vector3<T>>& lower_xyz, const Eigen::Ref<const Vector3<T>>& upper_xyz);
@@ -341,10 +354,66 @@ public:
     /// @returns true iff all points were assigned normals by having at least
     /// *three* closest points within @p radius.
     ///
+    /// This uses (and, if needed, builds) the spatial index described in
+    /// @ref point_cloud_spatial_queries "Spatial Queries".
+    ///
     /// @pre @p radius > 0 and @p num_closest >= 3.
     /// @throws std::exception if has_xyzs() is false.
     bool EstimateNormals(double radius, int num_closest, Parallelism parallelize = false);
 
+    /// @anchor point_cloud_spatial_queries
+    /// @name Spatial Queries
+    /// Neighbor queries are answered by a k-d tree over the finite xyz values
+    /// of this cloud, which is built on first use and then kept (and reused by
+    /// EstimateNormals() and Crop()) until the xyzs are modified. Resizing the
+    /// cloud discards the index. Each query also checks a hash of the xyzs
+    /// (recorded when the index was built), so the index is rebuilt after any
+    /// write to the xyzs, however it was made; this costs a pass over the xyzs
+    /// per call. Points with non-finite xyz values are never reported as
+    /// neighbors.
+    ///
+    /// @note Queries may be made concurrently from multiple threads (the lazy
+    /// construction of the index is synchronized), but not concurrently with
+    /// any modification of the cloud.
+    /// @{
+
+    /// Finds, for each column of `queries`, the (up to) `num_neighbors` points
+    /// of this cloud nearest to it. On return, column j of `indices` holds the
+    /// indices of the neighbors of query j in order of increasing distance, and
+    /// column j of `squared_distances` (if non-null) holds their squared
+    /// distances. If fewer than `num_neighbors` neighbors are found (e.g.,
+    /// because the cloud is small, or the query is not finite), the remaining
+    /// entries are -1 and infinity, respectively. @p parallelize enables
+    /// OpenMP parallelization across the queries.
+    /// @pre num_neighbors >= 1.
+    /// @throws std::exception if has_xyzs() is false or `indices` is null.
+    void FindNearestNeighbors(const Eigen::Ref<const Matrix3X<T>>& queries,
+                              int num_neighbors,
+                              MatrixX<int>* indices,
+                              MatrixX<T>* squared_distances = nullptr,
+                              Parallelism parallelize = false) const;
+
+    /// Finds, for each column of `queries`, all points of this cloud within
+    /// Euclidean distance `radius` of it. Element j of the result holds the
+    /// indices of the neighbors of query j in order of increasing distance.
+    /// @p parallelize enables OpenMP parallelization across the queries.
+    /// @pre radius >= 0.
+    /// @throws std::exception if has_xyzs() is false.
+    std::vector<std::vector<int>> FindNeighborsWithinRadius(const Eigen::Ref<const Matrix3X<T>>& queries,
+                                                            double radius,
+                                                            Parallelism parallelize = false) const;
+
+    /// Builds the spatial index now, if it is not already built. Queries build
+    /// the index on demand; this allows paying that cost up front instead.
+    /// @throws std::exception if has_xyzs() is false.
+    void BuildSpatialIndex() const;
+
+    /// Returns true iff the spatial index is currently built (and the xyzs
+    /// haven't changed since).
+    bool has_spatial_index() const;
+
+    /// @}
+
 private:
     void SetDefault(int start, int num);
 
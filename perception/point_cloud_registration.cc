@@ -0,0 +1,274 @@
+#include "perception/point_cloud_registration.h"
+
+#include <cmath>
+#include <limits>
+#include <optional>
+
+#include <Eigen/Cholesky>
+#include <Eigen/SVD>
+
+#include "common/drake_assert.h"
+#include "common/drake_throw.h"
+
+using drake::AbstractValue;
+using drake::Value;
+using drake::math::RigidTransformd;
+using drake::math::RotationMatrixd;
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+
+// Sums of the per-correspondence quantities needed to compute a pose update.
+// The point-to-point fields are the first and second moments of the pairs
+// (p, q); the point-to-plane fields are the normal equations JᵀJ and Jᵀr.
+// All of the updates are fixed-size Eigen operations, which Eigen vectorizes.
+struct Accumulator {
+    Accumulator& operator+=(const Accumulator& other) {
+        num_pairs += other.num_pairs;
+        sum_squared_residuals += other.sum_squared_residuals;
+        sum_p += other.sum_p;
+        sum_q += other.sum_q;
+        sum_pq += other.sum_pq;
+        JtJ += other.JtJ;
+        Jtr += other.Jtr;
+        return *this;
+    }
+
+    int num_pairs{0};
+    double sum_squared_residuals{0.0};
+    Vector3d sum_p{Vector3d::Zero()};
+    Vector3d sum_q{Vector3d::Zero()};
+    Matrix3d sum_pq{Matrix3d::Zero()};
+    Matrix6d JtJ{Matrix6d::Zero()};
+    Vector6d Jtr{Vector6d::Zero()};
+};
+
+// Calls accumulate(i, &accumulator) for each i in [0, num_items), using a
+// separate accumulator per thread, and returns the sum of the accumulators.
+template <typename Accumulate>
+Accumulator ParallelAccumulate(int num_items, [[maybe_unused]] Parallelism parallelize, const Accumulate& accumulate) {
+    Accumulator total;
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(parallelize.num_threads())
+#endif
+    {
+        Accumulator partial;
+#if defined(_OPENMP)
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < num_items; ++i) {
+            accumulate(i, &partial);
+        }
+#if defined(_OPENMP)
+#pragma omp critical
+#endif
+        total += partial;
+    }
+    return total;
+}
+
+// Returns the transform X that minimizes ∑ |X p - q|², or nullopt if there are
+// too few pairs to determine it.
+std::optional<RigidTransformd> SolvePointToPoint(const Accumulator& sums) {
+    if (sums.num_pairs < 3) {
+        return std::nullopt;
+    }
+    const double n = sums.num_pairs;
+    const Vector3d p_mean = sums.sum_p / n;
+    const Vector3d q_mean = sums.sum_q / n;
+    // The cross-covariance ∑ (p - p̄)(q - q̄)ᵀ.
+    const Matrix3d H = sums.sum_pq - n * p_mean * q_mean.transpose();
+    const Eigen::JacobiSVD<Matrix3d> svd(H, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    // Guard against a reflection.
+    Vector3d d = Vector3d::Ones();
+    if ((svd.matrixV() * svd.matrixU().transpose()).determinant() < 0) {
+        d(2) = -1;
+    }
+    const Matrix3d R = svd.matrixV() * d.asDiagonal() * svd.matrixU().transpose();
+    if (!R.allFinite()) {
+        return std::nullopt;
+    }
+    return RigidTransformd(RotationMatrixd(R), q_mean - R * p_mean);
+}
+
+// Returns the transform X = [exp(ω), t] where (ω, t) minimizes the linearized
+// point-to-plane error ∑ (nᵀ(p + ω × p + t - q))², or nullopt if the pairs do
+// not determine it.
+std::optional<RigidTransformd> SolvePointToPlane(const Accumulator& sums) {
+    if (sums.num_pairs < 6) {
+        return std::nullopt;
+    }
+    const Eigen::LDLT<Matrix6d> ldlt(sums.JtJ);
+    if (ldlt.info() != Eigen::Success) {
+        return std::nullopt;
+    }
+    const Vector6d x = -ldlt.solve(sums.Jtr);
+    if (!x.allFinite()) {
+        return std::nullopt;
+    }
+    const Vector3d w = x.head<3>();
+    const double angle = w.norm();
+    const RotationMatrixd R =
+            (angle > 0) ? RotationMatrixd(Eigen::AngleAxisd(angle, w / angle)) : RotationMatrixd::Identity();
+    return RigidTransformd(R, x.tail<3>());
+}
+
+}  // namespace
+
+IcpResult RegisterPointClouds(const PointCloud& source,
+                              const PointCloud& target,
+                              const RigidTransformd& X_TS_initial,
+                              const IcpParams& params) {
+    DRAKE_THROW_UNLESS(source.has_xyzs());
+    DRAKE_THROW_UNLESS(target.has_xyzs());
+    DRAKE_THROW_UNLESS(params.max_iterations >= 0);
+    DRAKE_THROW_UNLESS(params.max_correspondence_distance > 0);
+    const bool point_to_plane = (params.metric == IcpMetric::kPointToPlane);
+    if (point_to_plane && !target.has_normals()) {
+        throw std::runtime_error(
+                "RegisterPointClouds(): the point-to-plane metric requires a target "
+                "cloud with normals (see PointCloud::EstimateNormals())");
+    }
+
+    const int num_source = source.size();
+    const auto& s = source.xyzs();
+    const auto& q = target.xyzs();
+    // The target normals (unused for point-to-point).
+    const auto& normals = point_to_plane ? target.normals() : target.xyzs();
+    const float max_squared_distance = static_cast<float>(params.max_correspondence_distance *
+                                                          params.max_correspondence_distance);
+
+    IcpResult result;
+    result.X_TS = X_TS_initial;
+    // Scratch space, reused across iterations.
+    Matrix3X<float> p_T(3, num_source);
+    MatrixX<int> nearest;
+    MatrixX<float> squared_distances;
+    for (int iteration = 0; iteration < params.max_iterations; ++iteration) {
+        // Pair each source point (in T) with its nearest target point.
+        const Matrix3d R_TS = result.X_TS.rotation().matrix();
+        const Vector3d p_TS = result.X_TS.translation();
+        p_T.noalias() = R_TS.cast<float>() * s;
+        p_T.colwise() += p_TS.cast<float>();
+        target.FindNearestNeighbors(p_T, 1, &nearest, &squared_distances, params.parallelize);
+
+        // Accumulate the pairs within the correspondence distance. The
+        // residuals and Jacobians are formed in double precision.
+        const Accumulator sums =
+                ParallelAccumulate(num_source, params.parallelize, [&](int i, Accumulator* partial) {
+                    const int j = nearest(0, i);
+                    if (j < 0 || !(squared_distances(0, i) <= max_squared_distance)) {
+                        return;
+                    }
+                    const Vector3d p = R_TS * s.col(i).cast<double>() + p_TS;
+                    const Vector3d q_j = q.col(j).cast<double>();
+                    if (point_to_plane) {
+                        const Vector3d n = normals.col(j).cast<double>();
+                        if (!n.allFinite()) {
+                            return;
+                        }
+                        const double r = n.dot(p - q_j);
+                        Vector6d J;
+                        J << p.cross(n), n;
+                        partial->JtJ.noalias() += J * J.transpose();
+                        partial->Jtr.noalias() += J * r;
+                        partial->sum_squared_residuals += r * r;
+                    } else {
+                        partial->sum_p += p;
+                        partial->sum_q += q_j;
+                        partial->sum_pq.noalias() += p * q_j.transpose();
+                        partial->sum_squared_residuals += (p - q_j).squaredNorm();
+                    }
+                    ++partial->num_pairs;
+                });
+
+        result.num_iterations = iteration + 1;
+        result.num_correspondences = sums.num_pairs;
+        result.rms_error = (sums.num_pairs > 0) ? std::sqrt(sums.sum_squared_residuals / sums.num_pairs)
+                                                : std::numeric_limits<double>::quiet_NaN();
+
+        const std::optional<RigidTransformd> update = point_to_plane ? SolvePointToPlane(sums)
+                                                                     : SolvePointToPoint(sums);
+        if (!update.has_value()) {
+            break;
+        }
+        result.X_TS = *update * result.X_TS;
+        if (update->translation().norm() < params.translation_tolerance &&
+            std::abs(update->rotation().ToAngleAxis().angle()) < params.rotation_tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    return result;
+}
+
+std::vector<RigidTransformd> RegisterPointCloudSequence(const std::vector<PointCloud>& clouds,
+                                                        const IcpParams& params) {
+    std::vector<RigidTransformd> X_0i;
+    X_0i.reserve(clouds.size());
+    if (clouds.empty()) {
+        return X_0i;
+    }
+    X_0i.emplace_back();
+    // The pose of each cloud in its predecessor's frame.
+    RigidTransformd X_prev_i;
+    for (size_t i = 1; i < clouds.size(); ++i) {
+        X_prev_i = RegisterPointClouds(clouds[i], clouds[i - 1], X_prev_i, params).X_TS;
+        X_0i.push_back(X_0i.back() * X_prev_i);
+    }
+    return X_0i;
+}
+
+IterativeClosestPoint::IterativeClosestPoint(const IcpParams& params) : params_(params) {
+    DRAKE_THROW_UNLESS(params.max_iterations >= 0);
+    DRAKE_THROW_UNLESS(params.max_correspondence_distance > 0);
+
+    source_point_cloud_input_port_ =
+            this->DeclareAbstractInputPort("source_point_cloud", Value<PointCloud>{}).get_index();
+    target_point_cloud_input_port_ =
+            this->DeclareAbstractInputPort("target_point_cloud", Value<PointCloud>{}).get_index();
+
+    // Optional input port for the initial guess.
+    initial_pose_input_port_ = this->DeclareAbstractInputPort("initial_pose", Value<RigidTransformd>{}).get_index();
+
+    // Both outputs are served by a single registration.
+    registration_cache_index_ = this->DeclareCacheEntry("registration", &IterativeClosestPoint::CalcRegistration,
+                                                        {this->all_input_ports_ticket()})
+                                        .cache_index();
+    const systems::DependencyTicket registration_ticket = this->cache_entry_ticket(registration_cache_index_);
+    pose_output_port_ =
+            this->DeclareAbstractOutputPort("pose", &IterativeClosestPoint::CalcPose, {registration_ticket})
+                    .get_index();
+    registration_result_output_port_ =
+            this->DeclareAbstractOutputPort("registration_result", &IterativeClosestPoint::CalcRegistrationResult,
+                                            {registration_ticket})
+                    .get_index();
+}
+
+void IterativeClosestPoint::CalcRegistration(const systems::Context<double>& context, IcpResult* result) const {
+    const auto* const source = this->EvalInputValue<PointCloud>(context, source_point_cloud_input_port_);
+    const auto* const target = this->EvalInputValue<PointCloud>(context, target_point_cloud_input_port_);
+    const auto* const initial_pose_or_null = this->EvalInputValue<RigidTransformd>(context, initial_pose_input_port_);
+    DRAKE_THROW_UNLESS(source != nullptr);
+    DRAKE_THROW_UNLESS(target != nullptr);
+    *result = RegisterPointClouds(*source, *target,
+                                  initial_pose_or_null != nullptr ? *initial_pose_or_null : RigidTransformd(),
+                                  params_);
+}
+
+void IterativeClosestPoint::CalcPose(const systems::Context<double>& context, RigidTransformd* X_TS) const {
+    *X_TS = this->get_cache_entry(registration_cache_index_).Eval<IcpResult>(context).X_TS;
+}
+
+void IterativeClosestPoint::CalcRegistrationResult(const systems::Context<double>& context, IcpResult* result) const {
+    *result = this->get_cache_entry(registration_cache_index_).Eval<IcpResult>(context);
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <vector>
+
+#include "common/drake_copyable.h"
+#include "common/parallelism.h"
+#include "math/rigid_transform.h"
+#include "perception/point_cloud.h"
+#include "systems/framework/context.h"
+#include "systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// The error metric minimized by RegisterPointClouds().
+enum class IcpMetric {
+    /// Minimizes the sum of squared distances between corresponding points.
+    kPointToPoint,
+    /// Minimizes the sum of squared distances between each source point and
+    /// the tangent plane at its corresponding target point. This usually
+    /// converges in far fewer iterations than kPointToPoint, but requires the
+    /// target cloud to have normals (see PointCloud::EstimateNormals()).
+    kPointToPlane,
+};
+
+/// The set of parameters for RegisterPointClouds().
+struct IcpParams {
+    /// The error metric to minimize.
+    IcpMetric metric{IcpMetric::kPointToPlane};
+
+    /// The maximum number of iterations (each of which finds correspondences
+    /// and then updates the pose).
+    int max_iterations{30};
+
+    /// Pairs of corresponding points farther apart than this distance (in
+    /// meters) are rejected as outliers.
+    double max_correspondence_distance{0.05};
+
+    /// The iterations stop once an update moves the source by less than this
+    /// distance (in meters) and rotates it by less than `rotation_tolerance`
+    /// (in radians).
+    double translation_tolerance{1e-6};
+    double rotation_tolerance{1e-6};
+
+    /// Enables OpenMP parallelization of the correspondence search and of the
+    /// accumulation of the normal equations.
+    Parallelism parallelize{false};
+};
+
+/// The outcome of RegisterPointClouds().
+struct IcpResult {
+    /// The estimated pose of the source cloud's frame S in the target cloud's
+    /// frame T, i.e., the transform that maps source points onto the target.
+    math::RigidTransformd X_TS;
+
+    /// Whether the iterations met the convergence tolerances (as opposed to
+    /// stopping at `max_iterations` or for lack of correspondences).
+    bool converged{false};
+
+    /// The number of iterations performed.
+    int num_iterations{0};
+
+    /// The number of corresponding pairs (within `max_correspondence_distance`)
+    /// found in the last iteration.
+    int num_correspondences{0};
+
+    /// The root-mean-square of the metric's residuals over the corresponding
+    /// pairs found in the last iteration, or NaN if there were none.
+    double rms_error{0.0};
+};
+
+/// Estimates the rigid transform X_TS that aligns the `source` cloud (whose
+/// points are measured in a frame S) with the `target` cloud (frame T) using
+/// the Iterative Closest Point algorithm: starting from `X_TS_initial`, each
+/// iteration pairs every (finite) transformed source point with its nearest
+/// target point and then updates X_TS to minimize the chosen error metric over
+/// those pairs. For kPointToPoint the update is the closed-form optimum
+/// [Arun 1987]; for kPointToPlane it solves the linearized problem
+/// [Low 2004].
+///
+/// The nearest-neighbor queries use the target's spatial index (see
+/// @ref point_cloud_spatial_queries "PointCloud Spatial Queries"), which is
+/// built on first use and kept by the target; so registering many clouds
+/// against the same (unmodified) target builds its index only once.
+///
+/// ICP converges to a local optimum, so `X_TS_initial` must be reasonably
+/// close to the true pose (relative to `max_correspondence_distance` and the
+/// scale of the scene's features).
+///
+/// - [Arun 1987] K. S. Arun, T. S. Huang, and S. D. Blostein. Least-squares
+///   fitting of two 3-D point sets. IEEE Trans. PAMI, 9(5), pp. 698-700, 1987.
+/// - [Low 2004] K.-L. Low. Linear Least-Squares Optimization for
+///   Point-to-Plane ICP Surface Registration. Technical Report TR04-004,
+///   University of North Carolina at Chapel Hill, 2004.
+///
+/// @throws std::exception if either cloud lacks xyzs, if `params.metric` is
+/// kPointToPlane and `target` lacks normals, or if the params are invalid.
+IcpResult RegisterPointClouds(const PointCloud& source,
+                              const PointCloud& target,
+                              const math::RigidTransformd& X_TS_initial = {},
+                              const IcpParams& params = {});
+
+/// Registers a sequence of overlapping point clouds (e.g., successive scans of
+/// a moving sensor) by aligning each cloud with its predecessor. Returns the
+/// pose of each cloud's frame in the frame of `clouds[0]` (so the first
+/// element is the identity), obtained by composing the pairwise estimates;
+/// each pairwise registration is initialized with the previous pair's result,
+/// which suits a sensor moving smoothly.
+/// @throws std::exception under the conditions described for
+/// RegisterPointClouds(), for each pair.
+std::vector<math::RigidTransformd> RegisterPointCloudSequence(const std::vector<PointCloud>& clouds,
+                                                              const IcpParams& params = {});
+
+/// Estimates the pose of a point cloud relative to another by calling
+/// RegisterPointClouds().
+///
+/// @system
+/// name: IterativeClosestPoint
+/// input_ports:
+/// - source_point_cloud
+/// - target_point_cloud
+/// - initial_pose (optional)
+/// output_ports:
+/// - pose
+/// - registration_result
+/// @endsystem
+///
+/// The `pose` output is the estimated X_TS of the source cloud in the target
+/// cloud's frame (as a RigidTransformd), and `registration_result` is the full
+/// IcpResult; both are computed by a single registration. If the
+/// `initial_pose` input (a RigidTransformd) is not connected, the registration
+/// starts from the identity. To track a moving object at camera rate, feed an
+/// estimate of the current pose (e.g., the previous output) into
+/// `initial_pose`, and supply the model as a target cloud that is not modified
+/// between evaluations so that its spatial index is reused.
+///
+/// @ingroup perception_systems
+class IterativeClosestPoint final : public systems::LeafSystem<double> {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(IterativeClosestPoint);
+
+    /// Constructs the system, which will register clouds using `params`.
+    explicit IterativeClosestPoint(const IcpParams& params = {});
+
+    /// Returns the parameters used for registration.
+    const IcpParams& params() const { return params_; }
+
+    /// Returns the abstract valued input port that expects the source
+    /// PointCloud.
+    const systems::InputPort<double>& source_point_cloud_input_port() const {
+        return this->get_input_port(source_point_cloud_input_port_);
+    }
+
+    /// Returns the abstract valued input port that expects the target
+    /// PointCloud.
+    const systems::InputPort<double>& target_point_cloud_input_port() const {
+        return this->get_input_port(target_point_cloud_input_port_);
+    }
+
+    /// Returns the abstract valued input port that expects the initial guess of
+    /// X_TS as a RigidTransformd. (This input port does not necessarily need to
+    /// be connected; refer to the class overview for details.)
+    const systems::InputPort<double>& initial_pose_input_port() const {
+        return this->get_input_port(initial_pose_input_port_);
+    }
+
+    /// Returns the abstract valued output port that provides X_TS as a
+    /// RigidTransformd.
+    const systems::OutputPort<double>& pose_output_port() const { return this->get_output_port(pose_output_port_); }
+
+    /// Returns the abstract valued output port that provides an IcpResult.
+    const systems::OutputPort<double>& registration_result_output_port() const {
+        return this->get_output_port(registration_result_output_port_);
+    }
+
+private:
+    void CalcRegistration(const systems::Context<double>& context, IcpResult* result) const;
+    void CalcPose(const systems::Context<double>& context, math::RigidTransformd* X_TS) const;
+    void CalcRegistrationResult(const systems::Context<double>& context, IcpResult* result) const;
+
+    const IcpParams params_;
+
+    systems::InputPortIndex source_point_cloud_input_port_{};
+    systems::InputPortIndex target_point_cloud_input_port_{};
+    systems::InputPortIndex initial_pose_input_port_{};
+    systems::OutputPortIndex pose_output_port_{};
+    systems::OutputPortIndex registration_result_output_port_{};
+    systems::CacheIndex registration_cache_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
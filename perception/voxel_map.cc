@@ -0,0 +1,351 @@
+#include "perception/voxel_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "common/drake_assert.h"
+#include "common/drake_throw.h"
+#include "geometry/geometry_instance.h"
+#include "geometry/shape_specification.h"
+
+using drake::Value;
+using drake::math::RigidTransformd;
+using Eigen::Vector3d;
+
+namespace drake {
+namespace perception {
+namespace {
+
+constexpr int kBlockSize = VoxelMap::kBlockSize;
+
+// Rounds a / kBlockSize toward negative infinity.
+int FloorDivBlockSize(int a) {
+    return (a >= 0) ? (a / kBlockSize) : -((-a + kBlockSize - 1) / kBlockSize);
+}
+
+// Returns the index of the voxel with integer coordinates `voxel` within its
+// block.
+int GetIndexInBlock(const Vector3<int>& voxel) {
+    const Vector3<int> local = voxel - kBlockSize * voxel.unaryExpr(&FloorDivBlockSize);
+    return local.x() + kBlockSize * (local.y() + kBlockSize * local.z());
+}
+
+// A spatial hash of integer coordinates [Teschner 2003].
+size_t HashIndex(const Vector3<int>& index) {
+    return static_cast<size_t>((static_cast<uint32_t>(index.x()) * 73856093u) ^
+                               (static_cast<uint32_t>(index.y()) * 19349663u) ^
+                               (static_cast<uint32_t>(index.z()) * 83492791u));
+}
+
+// One measurement's update of one voxel.
+struct VoxelUpdate {
+    Vector3<int> voxel;
+    float distance;
+};
+
+}  // namespace
+
+size_t VoxelMap::IndexHash::operator()(const Vector3<int>& index) const {
+    return HashIndex(index);
+}
+
+VoxelMap::VoxelMap(const VoxelMapParams& params) : params_(params) {
+    DRAKE_THROW_UNLESS(params.voxel_size > 0);
+    DRAKE_THROW_UNLESS(params.truncation_distance >= params.voxel_size);
+    DRAKE_THROW_UNLESS(params.max_weight >= 1);
+    DRAKE_THROW_UNLESS(params.max_range > 0);
+}
+
+Vector3<int> VoxelMap::GetVoxelIndex(const Eigen::Ref<const Vector3d>& p_WP) const {
+    return (p_WP / params_.voxel_size).array().floor().cast<int>();
+}
+
+Vector3d VoxelMap::GetVoxelCenter(const Vector3<int>& index) const {
+    return (index.cast<double>().array() + 0.5) * params_.voxel_size;
+}
+
+const VoxelMap::Voxel* VoxelMap::FindVoxel(const Vector3<int>& index) const {
+    const auto iter = blocks_.find(index.unaryExpr(&FloorDivBlockSize));
+    if (iter == blocks_.end()) {
+        return nullptr;
+    }
+    return &(*iter->second)[GetIndexInBlock(index)];
+}
+
+bool VoxelMap::IsOccupied(const Voxel& voxel) const {
+    return voxel.weight > 0 && voxel.distance <= params_.occupied_threshold * params_.voxel_size;
+}
+
+void VoxelMap::IntegratePointCloud(const PointCloud& cloud,
+                                   const Eigen::Ref<const Vector3d>& p_WS,
+                                   [[maybe_unused]] Parallelism parallelize) {
+    DRAKE_THROW_UNLESS(cloud.has_xyzs());
+    const auto& xyzs = cloud.xyzs();
+    const int num_points = cloud.size();
+    const double voxel_size = params_.voxel_size;
+    const double truncation = params_.truncation_distance;
+
+    // Phase 1: find the voxels along each point's ray (within the truncation
+    // band, or all the way from the sensor if clearing free space) and their
+    // updated signed distances. This only reads the map, so chunks of points
+    // are processed in parallel, each collecting its own updates, which are
+    // then concatenated in chunk order so that the result doesn't depend on the
+    // parallelism.
+    constexpr int kPointsPerChunk = 1024;
+    const int num_chunks = (num_points + kPointsPerChunk - 1) / kPointsPerChunk;
+    std::vector<std::vector<VoxelUpdate>> chunk_updates(num_chunks);
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic) num_threads(parallelize.num_threads())
+#endif
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        std::vector<VoxelUpdate>& updates_in_chunk = chunk_updates[chunk];
+        const int chunk_end = std::min(num_points, (chunk + 1) * kPointsPerChunk);
+        for (int i = chunk * kPointsPerChunk; i < chunk_end; ++i) {
+            const Vector3d p_WP = xyzs.col(i).cast<double>();
+            if (!p_WP.allFinite()) {
+                continue;
+            }
+            const double depth = (p_WP - p_WS).norm();
+            if (!(depth > 0) || depth > params_.max_range) {
+                continue;
+            }
+            const Vector3d u = (p_WP - p_WS) / depth;
+            const double s_begin = params_.clear_free_space ? 0.0 : std::max(depth - truncation, 0.0);
+            const double s_end = depth + truncation;
+
+            // Walk the voxels intersected by the ray's segment [s_begin, s_end]
+            // [Amanatides 1987].
+            const Vector3d start = p_WS + s_begin * u;
+            Vector3<int> voxel = GetVoxelIndex(start);
+            const Vector3<int> last_voxel = GetVoxelIndex(p_WS + s_end * u);
+            Vector3<int> step;
+            Vector3d s_next;   // The distance (from `start`) to the next boundary.
+            Vector3d s_delta;  // The distance between boundaries.
+            for (int k = 0; k < 3; ++k) {
+                step(k) = (u(k) > 0) ? 1 : ((u(k) < 0) ? -1 : 0);
+                if (step(k) == 0) {
+                    s_next(k) = std::numeric_limits<double>::infinity();
+                    s_delta(k) = std::numeric_limits<double>::infinity();
+                } else {
+                    const double boundary = (voxel(k) + (step(k) > 0 ? 1 : 0)) * voxel_size;
+                    s_next(k) = (boundary - start(k)) / u(k);
+                    s_delta(k) = voxel_size / std::abs(u(k));
+                }
+            }
+            const double length = s_end - s_begin;
+            const int max_steps = 3 * static_cast<int>(std::ceil(length / voxel_size)) + 3;
+            for (int n = 0; n < max_steps; ++n) {
+                const double distance = depth - (GetVoxelCenter(voxel) - p_WS).dot(u);
+                if (distance >= -truncation) {
+                    updates_in_chunk.push_back({voxel, static_cast<float>(std::min(distance, truncation))});
+                }
+                if (voxel == last_voxel) {
+                    break;
+                }
+                int axis;
+                s_next.minCoeff(&axis);
+                if (s_next(axis) > length) {
+                    break;
+                }
+                voxel(axis) += step(axis);
+                s_next(axis) += s_delta(axis);
+            }
+        }
+    }
+    std::vector<VoxelUpdate> updates;
+    for (const std::vector<VoxelUpdate>& chunk : chunk_updates) {
+        updates.insert(updates.end(), chunk.begin(), chunk.end());
+    }
+
+    // Phase 2: group the updates by block, allocating new blocks and taking
+    // ownership of blocks shared with copies of this map.
+    std::unordered_map<Vector3<int>, std::vector<int>, IndexHash> updates_by_block;
+    for (int j = 0; j < static_cast<int>(updates.size()); ++j) {
+        updates_by_block[updates[j].voxel.unaryExpr(&FloorDivBlockSize)].push_back(j);
+    }
+    std::vector<std::pair<Block*, const std::vector<int>*>> work;
+    work.reserve(updates_by_block.size());
+    for (const auto& [block_index, block_updates] : updates_by_block) {
+        std::shared_ptr<Block>& block = blocks_[block_index];
+        if (block == nullptr) {
+            block = std::make_shared<Block>();
+        } else if (block.use_count() > 1) {
+            block = std::make_shared<Block>(*block);
+        }
+        work.emplace_back(block.get(), &block_updates);
+    }
+
+    // Phase 3: apply the updates (a running weighted average, with unit weight
+    // per measurement), each block by a single thread.
+    const float max_weight = static_cast<float>(params_.max_weight);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parallelize.num_threads())
+#endif
+    for (int b = 0; b < static_cast<int>(work.size()); ++b) {
+        Block& block = *work[b].first;
+        for (int j : *work[b].second) {
+            Voxel& voxel = block[GetIndexInBlock(updates[j].voxel)];
+            voxel.distance = (voxel.weight * voxel.distance + updates[j].distance) / (voxel.weight + 1);
+            voxel.weight = std::min(voxel.weight + 1, max_weight);
+        }
+    }
+}
+
+std::optional<double> VoxelMap::GetSignedDistance(const Eigen::Ref<const Vector3d>& p_WP) const {
+    const Voxel* voxel = FindVoxel(GetVoxelIndex(p_WP));
+    if (voxel == nullptr || voxel->weight == 0) {
+        return std::nullopt;
+    }
+    return voxel->distance;
+}
+
+bool VoxelMap::IsOccupied(const Eigen::Ref<const Vector3d>& p_WP) const {
+    const Voxel* voxel = FindVoxel(GetVoxelIndex(p_WP));
+    return voxel != nullptr && IsOccupied(*voxel);
+}
+
+std::optional<double> VoxelMap::CastRay(const Eigen::Ref<const Vector3d>& p_WO,
+                                        const Eigen::Ref<const Vector3d>& direction_W,
+                                        double max_distance) const {
+    const double norm = direction_W.norm();
+    DRAKE_DEMAND(norm > 0);
+    const Vector3d u = direction_W / norm;
+    // March in half-voxel steps, looking for a positive-to-negative crossing
+    // between consecutive observed samples.
+    const double step = params_.voxel_size / 2;
+    std::optional<std::pair<double, double>> previous;  // (s, distance)
+    for (double s = 0; s <= max_distance; s += step) {
+        const std::optional<double> distance = GetSignedDistance(p_WO + s * u);
+        if (!distance.has_value()) {
+            previous.reset();
+            continue;
+        }
+        if (previous.has_value() && previous->second > 0 && *distance <= 0) {
+            // Interpolate the zero crossing.
+            const auto [s_previous, distance_previous] = *previous;
+            return s_previous + (s - s_previous) * distance_previous / (distance_previous - *distance);
+        }
+        previous.emplace(s, *distance);
+    }
+    return std::nullopt;
+}
+
+std::vector<Vector3<int>> VoxelMap::GetOccupiedVoxels() const {
+    std::vector<Vector3<int>> result;
+    for (const auto& [block_index, block] : blocks_) {
+        for (int z = 0; z < kBlockSize; ++z) {
+            for (int y = 0; y < kBlockSize; ++y) {
+                for (int x = 0; x < kBlockSize; ++x) {
+                    if (IsOccupied((*block)[x + kBlockSize * (y + kBlockSize * z)])) {
+                        result.push_back(kBlockSize * block_index + Vector3<int>(x, y, z));
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
+VoxelMapBuilder::VoxelMapBuilder(const VoxelMapParams& params, double period, Parallelism parallelize)
+    : parallelize_(parallelize) {
+    DRAKE_THROW_UNLESS(period > 0);
+    const VoxelMap model_map(params);
+
+    point_cloud_input_port_ = this->DeclareAbstractInputPort("point_cloud", Value<PointCloud>{}).get_index();
+    camera_pose_input_port_ = this->DeclareAbstractInputPort("camera_pose", Value<RigidTransformd>{}).get_index();
+    map_state_index_ = this->DeclareAbstractState(Value<VoxelMap>(model_map));
+    this->DeclarePeriodicUnrestrictedUpdateEvent(period, 0.0, &VoxelMapBuilder::Integrate);
+    this->DeclareAbstractOutputPort("voxel_map", model_map, &VoxelMapBuilder::CalcVoxelMap,
+                                    {this->abstract_state_ticket(map_state_index_)});
+}
+
+const VoxelMap& VoxelMapBuilder::GetVoxelMap(const systems::Context<double>& context) const {
+    this->ValidateContext(context);
+    return context.get_abstract_state<VoxelMap>(map_state_index_);
+}
+
+systems::EventStatus VoxelMapBuilder::Integrate(const systems::Context<double>& context,
+                                                systems::State<double>* state) const {
+    const auto* const cloud = this->EvalInputValue<PointCloud>(context, point_cloud_input_port_);
+    const auto* const X_WC = this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
+    DRAKE_THROW_UNLESS(cloud != nullptr);
+    DRAKE_THROW_UNLESS(X_WC != nullptr);
+    // The state is a (shallow) copy of the map in the context, so only the
+    // blocks touched by this cloud are duplicated.
+    state->get_mutable_abstract_state<VoxelMap>(map_state_index_)
+            .IntegratePointCloud(*cloud, X_WC->translation(), parallelize_);
+    return systems::EventStatus::Succeeded();
+}
+
+void VoxelMapBuilder::CalcVoxelMap(const systems::Context<double>& context, VoxelMap* map) const {
+    *map = context.get_abstract_state<VoxelMap>(map_state_index_);
+}
+
+size_t VoxelMapGeometry::IndexHash::operator()(const Vector3<int>& index) const {
+    return HashIndex(index);
+}
+
+VoxelMapGeometry::VoxelMapGeometry(geometry::SceneGraph<double>* scene_graph,
+                                   const std::string& source_name,
+                                   const geometry::ProximityProperties& proximity_properties,
+                                   const std::optional<geometry::IllustrationProperties>& illustration_properties)
+    : scene_graph_(scene_graph),
+      source_name_(source_name),
+      source_id_([scene_graph, &source_name]() {
+          DRAKE_THROW_UNLESS(scene_graph != nullptr);
+          return scene_graph->RegisterSource(source_name);
+      }()),
+      proximity_properties_(proximity_properties),
+      illustration_properties_(illustration_properties) {}
+
+int VoxelMapGeometry::Update(const VoxelMap& map, systems::Context<double>* scene_graph_context) {
+    DRAKE_THROW_UNLESS(scene_graph_context != nullptr);
+    if (voxel_size_.has_value() && *voxel_size_ != map.voxel_size()) {
+        throw std::logic_error(
+                fmt::format("VoxelMapGeometry::Update(): the voxel size changed from {} to {}", *voxel_size_,
+                            map.voxel_size()));
+    }
+    voxel_size_ = map.voxel_size();
+
+    const std::vector<Vector3<int>> occupied_voxels = map.GetOccupiedVoxels();
+    const std::unordered_set<Vector3<int>, IndexHash> occupied(occupied_voxels.begin(), occupied_voxels.end());
+    int num_changes = 0;
+
+    // Remove the boxes of voxels that are no longer occupied.
+    for (auto iter = geometry_ids_.begin(); iter != geometry_ids_.end();) {
+        if (occupied.count(iter->first) == 0) {
+            scene_graph_->RemoveGeometry(scene_graph_context, source_id_, iter->second);
+            iter = geometry_ids_.erase(iter);
+            ++num_changes;
+        } else {
+            ++iter;
+        }
+    }
+
+    // Add boxes for newly occupied voxels.
+    for (const Vector3<int>& voxel : occupied_voxels) {
+        if (geometry_ids_.count(voxel) > 0) {
+            continue;
+        }
+        auto instance = std::make_unique<geometry::GeometryInstance>(
+                RigidTransformd(map.GetVoxelCenter(voxel)), geometry::Box::MakeCube(map.voxel_size()),
+                fmt::format("{}_{}_{}_{}", source_name_, voxel.x(), voxel.y(), voxel.z()));
+        instance->set_proximity_properties(proximity_properties_);
+        if (illustration_properties_.has_value()) {
+            instance->set_illustration_properties(*illustration_properties_);
+        }
+        const geometry::GeometryId geometry_id = scene_graph_->RegisterGeometry(
+                scene_graph_context, source_id_, geometry::SceneGraph<double>::world_frame_id(), std::move(instance));
+        geometry_ids_.emplace(voxel, geometry_id);
+        ++num_changes;
+    }
+    return num_changes;
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/drake_copyable.h"
+#include "common/eigen_types.h"
+#include "common/parallelism.h"
+#include "geometry/geometry_ids.h"
+#include "geometry/geometry_roles.h"
+#include "geometry/scene_graph.h"
+#include "math/rigid_transform.h"
+#include "perception/point_cloud.h"
+#include "systems/framework/context.h"
+#include "systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// The set of parameters for a VoxelMap.
+struct VoxelMapParams {
+    /// The edge length of each (cubic) voxel, in meters.
+    double voxel_size{0.02};
+
+    /// The truncation distance of the signed distance field, in meters: each
+    /// measurement updates only the voxels along its ray that are within this
+    /// distance of the measured point. It should be a few voxels.
+    double truncation_distance{0.08};
+
+    /// Each voxel's accumulated weight (the number of measurements averaged
+    /// into it) is capped at this value, so that the map can still adapt to
+    /// changes in the scene.
+    double max_weight{100.0};
+
+    /// Points farther than this distance from the sensor are ignored.
+    double max_range{std::numeric_limits<double>::infinity()};
+
+    /// When true, each measurement also marks the voxels along its ray between
+    /// the sensor and the truncation band as free, which clears obstacles that
+    /// have moved away (at the cost of visiting every voxel along each ray).
+    bool clear_free_space{false};
+
+    /// A voxel is occupied if it has been observed and its signed distance is
+    /// at most this fraction of `voxel_size` (i.e., the voxel is at or behind
+    /// the measured surface).
+    double occupied_threshold{0.5};
+};
+
+/// A map of the surfaces in a 3-D scene, built incrementally from depth
+/// measurements, in the form of a truncated signed distance field (TSDF)
+/// [Curless 1996] on a sparse voxel grid.
+///
+/// Each voxel stores the (weighted average) signed distance from its center to
+/// the nearest measured surface along the sensor's rays (positive in front of
+/// the surface, negative behind it), truncated to ±`truncation_distance`, and
+/// the accumulated weight of the measurements. Only voxels near measured
+/// surfaces are allocated: the voxels are stored in blocks of 8×8×8 that are
+/// hashed by their integer coordinates [Nießner 2013], so the memory use is
+/// proportional to the observed surface area rather than the volume of the
+/// scene.
+///
+/// Copying a %VoxelMap is cheap: the copies share the blocks of voxels, and a
+/// block is only duplicated when one of the copies modifies it
+/// (copy-on-write). This allows a %VoxelMap to be kept in a System's abstract
+/// state (see VoxelMapBuilder) without copying the whole map at every update.
+///
+/// - [Curless 1996] B. Curless and M. Levoy. A Volumetric Method for Building
+///   Complex Models from Range Images. SIGGRAPH, 1996.
+/// - [Nießner 2013] M. Nießner, M. Zollhöfer, S. Izadi, and M. Stamminger.
+///   Real-time 3D Reconstruction at Scale using Voxel Hashing. ACM Trans.
+///   Graphics, 32(6), 2013.
+class VoxelMap {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(VoxelMap);
+
+    /// The number of voxels along each edge of a block.
+    static constexpr int kBlockSize = 8;
+
+    /// Constructs an empty map.
+    /// @throws std::exception if the params are invalid.
+    explicit VoxelMap(const VoxelMapParams& params = {});
+
+    /// Returns the params passed at construction.
+    const VoxelMapParams& params() const { return params_; }
+
+    /// Returns the edge length of each voxel, in meters.
+    double voxel_size() const { return params_.voxel_size; }
+
+    /// Returns the number of allocated blocks of voxels.
+    int num_blocks() const { return static_cast<int>(blocks_.size()); }
+
+    /// Returns the integer coordinates of the voxel containing `p_WP`.
+    Vector3<int> GetVoxelIndex(const Eigen::Ref<const Eigen::Vector3d>& p_WP) const;
+
+    /// Returns the center of the voxel whose integer coordinates are `index`.
+    Eigen::Vector3d GetVoxelCenter(const Vector3<int>& index) const;
+
+    /// Integrates one frame of depth measurements: `cloud` holds the measured
+    /// points in the world frame W (e.g., the output of DepthImageToPointCloud
+    /// with its camera_pose input connected), all of which were measured from
+    /// a sensor whose origin is at `p_WS`. Non-finite points (e.g., pixels with
+    /// no return) are ignored.
+    ///
+    /// The points' updates are computed in parallel, grouped by block, and then
+    /// applied to the blocks in parallel (each block by a single thread), as
+    /// enabled by @p parallelize.
+    /// @throws std::exception if `cloud` does not have xyzs.
+    void IntegratePointCloud(const PointCloud& cloud,
+                             const Eigen::Ref<const Eigen::Vector3d>& p_WS,
+                             Parallelism parallelize = false);
+
+    /// Returns the signed distance stored in the voxel containing `p_WP`, or
+    /// nullopt if that voxel has not been observed.
+    std::optional<double> GetSignedDistance(const Eigen::Ref<const Eigen::Vector3d>& p_WP) const;
+
+    /// Returns true iff the voxel containing `p_WP` is occupied (see
+    /// VoxelMapParams::occupied_threshold). Unobserved voxels are not occupied.
+    bool IsOccupied(const Eigen::Ref<const Eigen::Vector3d>& p_WP) const;
+
+    /// Casts a ray from `p_WO` in the direction `direction_W` and returns the
+    /// distance along it to the first surface it crosses (a transition from
+    /// positive to negative signed distance), or nullopt if it crosses none
+    /// within `max_distance`.
+    /// @pre direction_W is nonzero.
+    std::optional<double> CastRay(const Eigen::Ref<const Eigen::Vector3d>& p_WO,
+                                  const Eigen::Ref<const Eigen::Vector3d>& direction_W,
+                                  double max_distance) const;
+
+    /// Returns the integer coordinates of all occupied voxels, in no particular
+    /// order. Together with voxel_size() these describe the obstacles in the
+    /// scene as a set of axis-aligned boxes, e.g., for
+    /// planning::CollisionChecker::AddCollisionShapeToBody() or for
+    /// VoxelMapGeometry.
+    std::vector<Vector3<int>> GetOccupiedVoxels() const;
+
+    /// Discards all measurements.
+    void Clear() { blocks_.clear(); }
+
+private:
+    struct Voxel {
+        float distance{0};
+        float weight{0};
+    };
+
+    using Block = std::array<Voxel, kBlockSize * kBlockSize * kBlockSize>;
+
+    struct IndexHash {
+        size_t operator()(const Vector3<int>& index) const;
+    };
+
+    // Returns the voxel with the given integer coordinates, or nullptr if its
+    // block is not allocated.
+    const Voxel* FindVoxel(const Vector3<int>& index) const;
+
+    bool IsOccupied(const Voxel& voxel) const;
+
+    VoxelMapParams params_;
+    // The blocks, keyed by the integer coordinates of the block (i.e., of
+    // their first voxel divided by kBlockSize). Blocks are shared between
+    // copies of this map until they are modified.
+    std::unordered_map<Vector3<int>, std::shared_ptr<Block>, IndexHash> blocks_;
+};
+
+/// Integrates a stream of point clouds into a VoxelMap.
+///
+/// @system
+/// name: VoxelMapBuilder
+/// input_ports:
+/// - point_cloud
+/// - camera_pose
+/// output_ports:
+/// - voxel_map
+/// @endsystem
+///
+/// The `point_cloud` input expects a PointCloud in the world frame and the
+/// `camera_pose` input expects the pose of the sensor in the world frame (a
+/// RigidTransformd X_WC); e.g., connect a DepthImageToPointCloud whose
+/// camera_pose input is connected to the same pose. Every `period` seconds, a
+/// periodic unrestricted update integrates the current cloud into the map,
+/// which is held in the system's abstract state (see VoxelMap for why this
+/// does not copy the map). The `voxel_map` output provides the map.
+///
+/// @ingroup perception_systems
+class VoxelMapBuilder final : public systems::LeafSystem<double> {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VoxelMapBuilder);
+
+    /// Constructs the system.
+    /// @param params The params of the map.
+    /// @param period The period of the integration updates, in seconds.
+    /// @param parallelize Enables parallel integration.
+    VoxelMapBuilder(const VoxelMapParams& params, double period, Parallelism parallelize = false);
+
+    /// Returns the abstract valued input port that expects a PointCloud.
+    const systems::InputPort<double>& point_cloud_input_port() const {
+        return this->get_input_port(point_cloud_input_port_);
+    }
+
+    /// Returns the abstract valued input port that expects X_WC as a
+    /// RigidTransformd.
+    const systems::InputPort<double>& camera_pose_input_port() const {
+        return this->get_input_port(camera_pose_input_port_);
+    }
+
+    /// Returns the abstract valued output port that provides a VoxelMap.
+    const systems::OutputPort<double>& voxel_map_output_port() const { return this->get_output_port(0); }
+
+    /// Returns the map held in `context`.
+    const VoxelMap& GetVoxelMap(const systems::Context<double>& context) const;
+
+private:
+    systems::EventStatus Integrate(const systems::Context<double>& context, systems::State<double>* state) const;
+    void CalcVoxelMap(const systems::Context<double>& context, VoxelMap* map) const;
+
+    const Parallelism parallelize_;
+
+    systems::InputPortIndex point_cloud_input_port_{};
+    systems::InputPortIndex camera_pose_input_port_{};
+    systems::AbstractStateIndex map_state_index_{};
+};
+
+/// Maintains a set of anchored box geometries in a SceneGraph, one per
+/// occupied voxel of a VoxelMap, so that the mapped obstacles participate in
+/// SceneGraph's proximity queries (and, if requested, its visualization).
+///
+/// Update() changes the geometry incrementally: it registers boxes only for
+/// newly occupied voxels and removes only the boxes of voxels that are no
+/// longer occupied, so the cost of keeping the geometry current is
+/// proportional to the change in the map, not to its size.
+class VoxelMapGeometry {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VoxelMapGeometry);
+
+    /// Registers a new geometry source named `source_name` with `scene_graph`,
+    /// which must outlive this object. The boxes will be assigned the given
+    /// proximity properties and, if provided, illustration properties.
+    VoxelMapGeometry(geometry::SceneGraph<double>* scene_graph,
+                     const std::string& source_name,
+                     const geometry::ProximityProperties& proximity_properties = {},
+                     const std::optional<geometry::IllustrationProperties>& illustration_properties = std::nullopt);
+
+    /// Returns the id of the geometry source.
+    geometry::SourceId source_id() const { return source_id_; }
+
+    /// Returns the number of boxes currently registered.
+    int num_geometries() const { return static_cast<int>(geometry_ids_.size()); }
+
+    /// Updates the geometry in `scene_graph_context` (the SceneGraph's context)
+    /// to match the occupied voxels of `map`, and returns the number of boxes
+    /// added or removed.
+    /// @throws std::exception if `map`'s voxel size differs from that of the
+    /// maps previously passed.
+    int Update(const VoxelMap& map, systems::Context<double>* scene_graph_context);
+
+private:
+    struct IndexHash {
+        size_t operator()(const Vector3<int>& index) const;
+    };
+
+    const geometry::SceneGraph<double>* const scene_graph_;
+    const std::string source_name_;
+    const geometry::SourceId source_id_;
+    const geometry::ProximityProperties proximity_properties_;
+    const std::optional<geometry::IllustrationProperties> illustration_properties_;
+    std::optional<double> voxel_size_;
+    std::unordered_map<Vector3<int>, geometry::GeometryId, IndexHash> geometry_ids_;
+};
+
+}  // namespace perception
+}  // namespace drake
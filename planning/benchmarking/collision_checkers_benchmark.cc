@@ -0,0 +1,145 @@
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "common/random.h"
+#include "planning/robot_diagram_builder.h"
+#include "planning/scene_graph_collision_checker.h"
+#include "planning/sphere_grid_collision_checker.h"
+#include "tools/performance/fixture_common.h"
+
+/* These scenarios compare the collision checkers on batches of random IIWA
+configurations in the scene of the sampling-based planners benchmark. */
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::VectorXd;
+
+DEFINE_bool(test, false, "Enable unit test mode.");
+
+// The scene of the IRIS benchmark (geometry/benchmarking), without the gripper.
+constexpr char kModelDirectives[] = R"""(
+directives:
+- add_model:
+    name: iiwa
+    file: package://drake_models/iiwa_description/urdf/iiwa14_primitive_collision.urdf
+- add_weld:
+    parent: world
+    child: iiwa::base
+- add_model:
+    name: binR
+    file: package://drake_models/manipulation_station/bin2.sdf
+- add_weld:
+    parent: world
+    child: binR::bin_base
+    X_PC:
+      translation: [0, -0.6, 0]
+      rotation: !Rpy { deg: [0.0, 0.0, 90.0 ]}
+- add_model:
+    name: binL
+    file: package://drake_models/manipulation_station/bin2.sdf
+- add_weld:
+    parent: world
+    child: binL::bin_base
+    X_PC:
+      translation: [0, 0.6, 0]
+      rotation: !Rpy { deg: [0.0, 0.0, 90.0 ]}
+- add_model:
+    name: shelves
+    file: package://drake_models/manipulation_station/shelves.sdf
+- add_weld:
+    parent: world
+    child: shelves::shelves_body
+    X_PC:
+      translation: [0.85, 0, 0.4]
+      rotation: !Rpy { deg: [0.0, 0.0, 180.0 ]}
+- add_model:
+    name: table
+    file: package://drake_models/manipulation_station/table_wide.sdf
+- add_weld:
+    parent: world
+    child: table::table_body
+    X_PC:
+      translation: [0.4, 0.0, 0.0]
+)""";
+
+// The argument selects the checker: 0 for SceneGraphCollisionChecker, 1 for
+// SphereGridCollisionChecker.
+class IiwaBins : public benchmark::Fixture {
+public:
+    IiwaBins() { tools::performance::AddMinMaxStatistics(this); }
+
+    void SetUp(benchmark::State& state) override {
+        RobotDiagramBuilder<double> builder(0.0);
+        builder.parser().AddModelsFromString(kModelDirectives, ".dmd.yaml");
+        const multibody::ModelInstanceIndex iiwa = builder.plant().GetModelInstanceByName("iiwa");
+        CollisionCheckerParams params;
+        params.model = builder.Build();
+        params.robot_model_instances = {iiwa};
+        params.edge_step_size = 0.05;
+        if (state.range(0) == 0) {
+            checker_ = std::make_unique<SceneGraphCollisionChecker>(std::move(params));
+        } else {
+            SphereGridCollisionCheckerParams sphere_grid_params;
+            sphere_grid_params.grid_lower << -0.5, -1.2, -0.2;
+            sphere_grid_params.grid_upper << 1.2, 1.2, 1.4;
+            checker_ = std::make_unique<SphereGridCollisionChecker>(std::move(params), sphere_grid_params);
+        }
+
+        RandomGenerator generator(0);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const VectorXd lower = checker_->plant().GetPositionLowerLimits();
+        const VectorXd upper = checker_->plant().GetPositionUpperLimits();
+        configs_.resize(FLAGS_test ? 10 : 10000);
+        for (VectorXd& q : configs_) {
+            q = lower + (upper - lower).cwiseProduct(
+                                VectorXd::NullaryExpr(lower.size(), [&]() { return uniform(generator); }));
+        }
+    }
+
+    void TearDown(benchmark::State&) override { checker_.reset(); }
+
+protected:
+    std::unique_ptr<CollisionChecker> checker_;
+    std::vector<VectorXd> configs_;
+};
+
+BENCHMARK_DEFINE_F(IiwaBins, CheckConfigs)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        checker_->CheckConfigsCollisionFree(configs_, Parallelism(static_cast<int>(state.range(1))));
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBins, CheckConfigs)
+        ->ArgNames({"sphere_grid", "threads"})
+        ->ArgsProduct({{0, 1}, {1, 4}})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IiwaBins, RobotClearance)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        for (const VectorXd& q : configs_) {
+            checker_->CalcRobotClearance(q, 0.1);
+        }
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBins, RobotClearance)->ArgName("sphere_grid")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <memory>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "common/random.h"
+#include "planning/robot_diagram_builder.h"
+#include "planning/sampling_based/bit_star_planner.h"
+#include "planning/sampling_based/prm_planner.h"
+#include "planning/sampling_based/rrt_connect_planner.h"
+#include "planning/scene_graph_collision_checker.h"
+#include "tools/performance/fixture_common.h"
+
+/* These scenarios measure the sampling-based planners on the IIWA reaching
+between two bins past a set of shelves, both the one-time cost of building a
+roadmap and the per-query cost of each planner. */
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::VectorXd;
+
+DEFINE_bool(test, false, "Enable unit test mode.");
+
+// The scene of the IRIS benchmark (geometry/benchmarking), without the gripper.
+constexpr char kModelDirectives[] = R"""(
+directives:
+- add_model:
+    name: iiwa
+    file: package://drake_models/iiwa_description/urdf/iiwa14_primitive_collision.urdf
+- add_weld:
+    parent: world
+    child: iiwa::base
+- add_model:
+    name: binR
+    file: package://drake_models/manipulation_station/bin2.sdf
+- add_weld:
+    parent: world
+    child: binR::bin_base
+    X_PC:
+      translation: [0, -0.6, 0]
+      rotation: !Rpy { deg: [0.0, 0.0, 90.0 ]}
+- add_model:
+    name: binL
+    file: package://drake_models/manipulation_station/bin2.sdf
+- add_weld:
+    parent: world
+    child: binL::bin_base
+    X_PC:
+      translation: [0, 0.6, 0]
+      rotation: !Rpy { deg: [0.0, 0.0, 90.0 ]}
+- add_model:
+    name: shelves
+    file: package://drake_models/manipulation_station/shelves.sdf
+- add_weld:
+    parent: world
+    child: shelves::shelves_body
+    X_PC:
+      translation: [0.85, 0, 0.4]
+      rotation: !Rpy { deg: [0.0, 0.0, 180.0 ]}
+- add_model:
+    name: table
+    file: package://drake_models/manipulation_station/table_wide.sdf
+- add_weld:
+    parent: world
+    child: table::table_body
+    X_PC:
+      translation: [0.4, 0.0, 0.0]
+)""";
+
+class IiwaBinToBin : public benchmark::Fixture {
+public:
+    IiwaBinToBin() { tools::performance::AddMinMaxStatistics(this); }
+
+    void SetUp(benchmark::State& state) override {
+        RobotDiagramBuilder<double> builder(0.0);
+        builder.parser().AddModelsFromString(kModelDirectives, ".dmd.yaml");
+        const multibody::ModelInstanceIndex iiwa = builder.plant().GetModelInstanceByName("iiwa");
+        CollisionCheckerParams params;
+        params.model = builder.Build();
+        params.robot_model_instances = {iiwa};
+        params.edge_step_size = 0.05;
+        checker_ = std::make_unique<SceneGraphCollisionChecker>(std::move(params));
+
+        // The arm's posture above each bin.
+        start_.resize(7);
+        start_ << M_PI / 2, 0.3, 0, -1.8, 0, 1.0, 1.57;
+        goal_ = start_;
+        goal_[0] = -M_PI / 2;
+        if (!checker_->CheckConfigCollisionFree(start_) || !checker_->CheckConfigCollisionFree(goal_)) {
+            state.SkipWithError("The start or goal is in collision.");
+            return;
+        }
+
+        prm_params_.num_samples = FLAGS_test ? 50 : 2000;
+        bit_star_params_.max_batches = FLAGS_test ? 1 : 5;
+    }
+
+    void TearDown(benchmark::State&) override { checker_.reset(); }
+
+protected:
+    std::unique_ptr<CollisionChecker> checker_;
+    VectorXd start_;
+    VectorXd goal_;
+    PrmParams prm_params_;
+    RrtConnectParams rrt_connect_params_;
+    BitStarParams bit_star_params_;
+};
+
+BENCHMARK_DEFINE_F(IiwaBinToBin, BuildRoadmap)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    prm_params_.lazy = state.range(0) != 0;
+    for (auto _ : state) {
+        RandomGenerator generator(0);
+        Roadmap roadmap;
+        GrowRoadmap(*checker_, prm_params_, &generator, &roadmap);
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBinToBin, BuildRoadmap)->ArgName("lazy")->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IiwaBinToBin, QueryRoadmap)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    RandomGenerator generator(0);
+    Roadmap roadmap;
+    GrowRoadmap(*checker_, prm_params_, &generator, &roadmap);
+    for (auto _ : state) {
+        QueryRoadmapPath(*checker_, prm_params_, {start_}, {goal_}, &roadmap);
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBinToBin, QueryRoadmap)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IiwaBinToBin, RrtConnect)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    RandomGenerator generator(0);
+    for (auto _ : state) {
+        PlanRrtConnect(*checker_, rrt_connect_params_, start_, goal_, &generator, Parallelism(state.range(0)));
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBinToBin, RrtConnect)->ArgName("threads")->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IiwaBinToBin, BitStar)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+    RandomGenerator generator(0);
+    for (auto _ : state) {
+        PlanBitStar(*checker_, bit_star_params_, start_, goal_, &generator);
+    }
+}
+BENCHMARK_REGISTER_F(IiwaBinToBin, BitStar)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
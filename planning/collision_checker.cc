@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <optional>
+#include <queue>
 #include <set>
 #include <string>
 #include <unordered_set>
@@ -19,6 +21,11 @@
 
 #include "common/drake_throw.h"
 #include "common/fmt_eigen.h"
+#include "common/overloaded.h"
+#include "geometry/proximity/polygon_surface_mesh.h"
+#include "multibody/tree/prismatic_joint.h"
+#include "multibody/tree/revolute_joint.h"
+#include "multibody/tree/weld_joint.h"
 #include "planning/linear_distance_and_interpolation_provider.h"
 
 namespace drake {
@@ -189,6 +196,114 @@ std::vector<int> CalcUncontrolledDofsThatKinematicallyAffectTheRobot(const Multi
     return result;
 }
 
+// Conservative advancement reports an edge to be in collision once the
+// robot's clearance falls below this distance (in meters), rather than
+// approaching the contact in ever smaller steps.
+constexpr double kConservativeAdvancementTolerance = 1e-3;
+
+// Returns an upper bound on the distance from the origin of the shape's frame
+// to any point of the shape.
+double CalcShapeBoundingRadius(const Shape& shape) {
+    const auto calc_hull_radius = [](const auto& mesh) {
+        const geometry::PolygonSurfaceMesh<double>& hull = mesh.GetConvexHull();
+        double radius = 0.0;
+        for (int v = 0; v < hull.num_vertices(); ++v) {
+            radius = std::max(radius, hull.vertex(v).norm());
+        }
+        return radius;
+    };
+    return shape.Visit<double>(overloaded{[](const geometry::Box& box) {
+                                              return 0.5 * box.size().norm();
+                                          },
+                                          [](const geometry::Capsule& capsule) {
+                                              return 0.5 * capsule.length() + capsule.radius();
+                                          },
+                                          [&](const geometry::Convex& convex) {
+                                              return calc_hull_radius(convex);
+                                          },
+                                          [](const geometry::Cylinder& cylinder) {
+                                              return std::hypot(cylinder.radius(), 0.5 * cylinder.length());
+                                          },
+                                          [](const geometry::Ellipsoid& ellipsoid) {
+                                              return std::max({ellipsoid.a(), ellipsoid.b(), ellipsoid.c()});
+                                          },
+                                          [](const geometry::HalfSpace&) {
+                                              return std::numeric_limits<double>::infinity();
+                                          },
+                                          [&](const geometry::Mesh& mesh) {
+                                              return calc_hull_radius(mesh);
+                                          },
+                                          [](const geometry::MeshcatCone& cone) {
+                                              return std::hypot(std::max(cone.a(), cone.b()), cone.height());
+                                          },
+                                          [](const geometry::Sphere& sphere) {
+                                              return sphere.radius();
+                                          }});
+}
+
+// Computes, for each body with collision geometry, the terms (i, cᵢ) of an
+// upper bound Σ cᵢ⋅|Δqᵢ| on the distance any point of its geometry moves when
+// the positions change linearly by Δq. `added_reaches` bounds, per body, the
+// distance from the body's origin to any point of the collision shapes added
+// to it through the checker (zero if there are none). Walking from the body to
+// the world, each
+// revolute joint contributes its (configuration-independent) bound on the
+// distance from its axis to the geometry, and each prismatic joint a unit
+// coefficient; the dofs of any other kind of joint, and the revolute dofs
+// inboard of it, get infinite coefficients.
+std::vector<std::vector<std::pair<int, double>>> CalcBodyMotionBoundTerms(const MultibodyPlant<double>& plant,
+                                                                        const SceneGraphInspector<double>& inspector,
+                                                                        const std::vector<double>& added_reaches) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    // The joint whose child is each body; since #18390 every body other than
+    // the world has one.
+    std::vector<const Joint<double>*> inboard_joints(plant.num_bodies(), nullptr);
+    for (JointIndex joint_index : plant.GetJointIndices()) {
+        const Joint<double>& joint = plant.get_joint(joint_index);
+        inboard_joints[joint.child_body().index()] = &joint;
+    }
+
+    std::vector<std::vector<std::pair<int, double>>> terms(plant.num_bodies());
+    for (BodyIndex body_index(0); body_index < plant.num_bodies(); ++body_index) {
+        const std::vector<GeometryId>& geometries = plant.GetCollisionGeometriesForBody(plant.get_body(body_index));
+        if (geometries.empty() && added_reaches[body_index] == 0.0) {
+            continue;
+        }
+        // A bound on the distance from the origin of the current body (starting
+        // with the body itself) to any point of the body's geometry.
+        double reach = added_reaches[body_index];
+        for (const GeometryId geometry : geometries) {
+            reach = std::max(reach, inspector.GetPoseInFrame(geometry).translation().norm() +
+                                            CalcShapeBoundingRadius(inspector.GetShape(geometry)));
+        }
+        for (BodyIndex current = body_index; current != multibody::world_index();) {
+            const Joint<double>* joint = inboard_joints[current];
+            DRAKE_DEMAND(joint != nullptr);
+            // From the origin of the joint's child frame M.
+            reach += joint->frame_on_child().GetFixedPoseInBodyFrame().translation().norm();
+            const std::string& type = joint->type_name();
+            if (type == multibody::RevoluteJoint<double>::kTypeName) {
+                terms[body_index].emplace_back(joint->position_start(), reach);
+            } else if (type == multibody::PrismaticJoint<double>::kTypeName) {
+                terms[body_index].emplace_back(joint->position_start(), 1.0);
+                reach += std::max(std::abs(joint->position_lower_limits()[0]),
+                                  std::abs(joint->position_upper_limits()[0]));
+            } else if (type == multibody::WeldJoint<double>::kTypeName) {
+                reach += dynamic_cast<const multibody::WeldJoint<double>&>(*joint).X_FM().translation().norm();
+            } else {
+                for (int i = 0; i < joint->num_positions(); ++i) {
+                    terms[body_index].emplace_back(joint->position_start() + i, kInf);
+                }
+                reach = kInf;
+            }
+            // To the origin of the parent body.
+            reach += joint->frame_on_parent().GetFixedPoseInBodyFrame().translation().norm();
+            current = joint->parent_body().index();
+        }
+    }
+    return terms;
+}
+
 }  // namespace
 
 CollisionChecker::~CollisionChecker() = default;
@@ -270,6 +385,7 @@ bool CollisionChecker::AddCollisionShapeToBody(const std::string& group_name,
         const std::string& model_instance_name = plant().GetModelInstanceName(bodyA.model_instance());
         geometry_groups_[group_name].push_back(AddedShape{
                 *maybe_geometry, bodyA.index(), BodyShapeDescription(shape, X_AG, model_instance_name, bodyA.name())});
+        UpdateBodyMotionBoundTerms();
     }
     return maybe_geometry.has_value();
 }
@@ -291,6 +407,7 @@ void CollisionChecker::RemoveAllAddedCollisionShapes(const std::string& group_na
         drake::log()->debug("Removing geometries from group [{}].", group_name);
         RemoveAddedGeometries(iter->second);
         geometry_groups_.erase(iter);
+        UpdateBodyMotionBoundTerms();
     }
 }
 
@@ -300,6 +417,7 @@ void CollisionChecker::RemoveAllAddedCollisionShapes() {
         RemoveAddedGeometries(group_ids);
     }
     geometry_groups_.clear();
+    UpdateBodyMotionBoundTerms();
 }
 
 std::optional<double> CollisionChecker::MaybeGetUniformRobotEnvironmentPadding() const {
@@ -569,6 +687,30 @@ ConfigurationInterpolationFunction CollisionChecker::MakeStandaloneConfiguration
     };
 }
 
+void CollisionChecker::set_edge_checking_mode(EdgeCheckingMode mode) {
+    edge_checking_mode_ = mode;
+    UpdateBodyMotionBoundTerms();
+}
+
+void CollisionChecker::UpdateBodyMotionBoundTerms() {
+    if (edge_checking_mode_ != EdgeCheckingMode::kConservativeAdvancement) {
+        body_motion_bound_terms_.clear();
+        return;
+    }
+    // The shapes added through the checker aren't in the model's inspector.
+    std::vector<double> added_reaches(plant().num_bodies(), 0.0);
+    for (const auto& [group_name, group_shapes] : geometry_groups_) {
+        for (const AddedShape& added : group_shapes) {
+            const BodyShapeDescription& description = added.description;
+            const double reach =
+                    description.pose_in_body().translation().norm() + CalcShapeBoundingRadius(description.shape());
+            added_reaches[added.body_index] = std::max(added_reaches[added.body_index], reach);
+        }
+    }
+    body_motion_bound_terms_ =
+            CalcBodyMotionBoundTerms(plant(), model().scene_graph().model_inspector(), added_reaches);
+}
+
 bool CollisionChecker::CheckEdgeCollisionFree(const Eigen::VectorXd& q1,
                                               const Eigen::VectorXd& q2,
                                               const std::optional<int> context_number) const {
@@ -592,6 +734,19 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(CollisionCheckerContext* mo
         return false;
     }
 
+    switch (edge_checking_mode_) {
+        case EdgeCheckingMode::kSequential:
+            break;
+        case EdgeCheckingMode::kConservativeAdvancement:
+            if (const std::optional<bool> result =
+                        MaybeCheckContextEdgeCollisionFreeByConservativeAdvancement(model_context, q1, q2)) {
+                return *result;
+            }
+            [[fallthrough]];
+        case EdgeCheckingMode::kBisection:
+            return CheckContextEdgeCollisionFreeInBisectionOrder(model_context, q1, q2);
+    }
+
     const double distance = ComputeConfigurationDistance(q1, q2);
     const int num_steps = static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
     for (int step = 0; step < num_steps; ++step) {
@@ -604,6 +759,93 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(CollisionCheckerContext* mo
     return true;
 }
 
+bool CollisionChecker::CheckContextEdgeCollisionFreeInBisectionOrder(CollisionCheckerContext* model_context,
+                                                                     const Eigen::VectorXd& q1,
+                                                                     const Eigen::VectorXd& q2) const {
+    const double distance = ComputeConfigurationDistance(q1, q2);
+    const int num_steps = static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
+    const auto check_step = [&](int step) {
+        const double ratio = static_cast<double>(step) / static_cast<double>(num_steps);
+        return CheckContextConfigCollisionFree(model_context, InterpolateBetweenConfigurations(q1, q2, ratio));
+    };
+    // The last step (q2) has already been checked by the caller.
+    if (!check_step(0)) {
+        return false;
+    }
+    // Check the midpoints of intervals whose ends have been checked, coarsest
+    // first.
+    std::queue<std::pair<int, int>> intervals;
+    intervals.emplace(0, num_steps);
+    while (!intervals.empty()) {
+        const auto [low, high] = intervals.front();
+        intervals.pop();
+        if (high - low < 2) {
+            continue;
+        }
+        const int middle = low + (high - low) / 2;
+        if (!check_step(middle)) {
+            return false;
+        }
+        intervals.emplace(low, middle);
+        intervals.emplace(middle, high);
+    }
+    return true;
+}
+
+std::optional<bool> CollisionChecker::MaybeCheckContextEdgeCollisionFreeByConservativeAdvancement(
+        CollisionCheckerContext* model_context, const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const {
+    // The motion bounds only hold for linear interpolation.
+    if (dynamic_cast<const LinearDistanceAndInterpolationProvider*>(distance_and_interpolation_provider_.get()) ==
+        nullptr) {
+        return std::nullopt;
+    }
+    DRAKE_DEMAND(ssize(body_motion_bound_terms_) == plant().num_bodies());
+
+    // Bounds on the distance each body's geometry moves over the whole edge.
+    const Eigen::VectorXd dq = (q2 - q1).cwiseAbs();
+    Eigen::VectorXd motion = Eigen::VectorXd::Zero(plant().num_bodies());
+    for (int body = 0; body < plant().num_bodies(); ++body) {
+        for (const auto& [i, coefficient] : body_motion_bound_terms_[body]) {
+            if (dq[i] > 0.0) {
+                motion[body] += coefficient * dq[i];
+            }
+        }
+    }
+    if (!motion.allFinite()) {
+        return std::nullopt;
+    }
+    const double max_motion = motion.maxCoeff();
+    if (max_motion == 0.0) {
+        // Nothing moves, and the caller has already checked q2.
+        return true;
+    }
+
+    // At each step, the pairs within the influence distance limit the step to
+    // the fraction of the edge over which they can't close their distance.
+    // Pairs farther apart can't meet before the end of the edge.
+    double ratio = 0.0;
+    while (true) {
+        const Eigen::VectorXd q = InterpolateBetweenConfigurations(q1, q2, ratio);
+        const double influence_distance = 2.0 * max_motion * (1.0 - ratio);
+        const RobotClearance clearance = CalcContextRobotClearance(model_context, q, influence_distance);
+        double step = 1.0 - ratio;
+        for (int k = 0; k < clearance.size(); ++k) {
+            const double distance = clearance.distances()[k];
+            if (distance < kConservativeAdvancementTolerance) {
+                return false;
+            }
+            const double rate = motion[clearance.robot_indices()[k]] + motion[clearance.other_indices()[k]];
+            if (rate > 0.0) {
+                step = std::min(step, distance / rate);
+            }
+        }
+        ratio += step;
+        if (ratio >= 1.0) {
+            return true;
+        }
+    }
+}
+
 bool CollisionChecker::CheckEdgeCollisionFreeParallel(const Eigen::VectorXd& q1,
                                                       const Eigen::VectorXd& q2,
                                                       const Parallelism parallelize) const {
@@ -856,8 +1098,9 @@ CollisionChecker::CollisionChecker(CollisionCheckerParams params, bool supports_
         SetDistanceAndInterpolationProvider(std::make_unique<LinearDistanceAndInterpolationProvider>(plant()));
     }
 
-    // Set edge step size.
+    // Set edge step size and checking mode.
     set_edge_step_size(params.edge_step_size);
+    set_edge_checking_mode(params.edge_checking_mode);
 
     // Generate the filtered collision matrix.
     nominal_filtered_collisions_ = GenerateFilteredCollisionMatrix();
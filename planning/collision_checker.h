@@ -824,7 +824,34 @@ public:
      the cost that physically free edges may no longer be considered free.
 
      The best tuning will likely include configuring both edge step size and
-     applying appropriate padding. */
+     applying appropriate padding.
+
+     @anchor collision_checker_edge_checking_modes
+     <u>Edge checking modes</u>
+
+     The order in which the samples of an edge are checked, or whether the edge
+     is sampled at all, is set by set_edge_checking_mode(). The default,
+     EdgeCheckingMode::kSequential, checks the samples from `q1` to `q2`. With
+     EdgeCheckingMode::kBisection, the same samples are checked in bisection
+     order; an edge that is in collision is then typically rejected after a few
+     checks rather than after half of them on average.
+
+     With EdgeCheckingMode::kConservativeAdvancement, edges are not sampled at
+     edge_step_size. Instead, at each configuration visited along the edge the
+     checker computes the robot's clearance (see CalcRobotClearance()) and
+     advances by the largest interpolation step for which no body pair can close
+     its distance, given an upper bound on how fast each body's collision
+     geometry moves as the edge is traversed. Long edges through free space are
+     covered in a few large steps, and an edge reported collision free has
+     (padded) clearance everywhere, not just at samples. Edges that come within
+     1 mm of collision are conservatively reported to be in collision. The
+     bounds assume that the edge linearly interpolates the positions of
+     revolute and prismatic joints (i.e., the default
+     LinearDistanceAndInterpolationProvider); edges that move any other kind of
+     joint, or that are interpolated by any other provider, are checked as in
+     EdgeCheckingMode::kBisection. The mode affects CheckEdgeCollisionFree(),
+     CheckContextEdgeCollisionFree() and CheckEdgesCollisionFree(); the
+     "Measure" functions and CheckEdgeCollisionFreeParallel() always sample. */
     //@{
 
     /** Sets the distance and interpolation provider to use.
@@ -917,6 +944,16 @@ public:
         edge_step_size_ = edge_step_size;
     }
 
+    /** Gets the current edge checking mode. */
+    EdgeCheckingMode edge_checking_mode() const { return edge_checking_mode_; }
+
+    /** Sets how edges are checked for collision; see @ref
+     collision_checker_edge_checking_modes "edge checking modes". Selecting
+     EdgeCheckingMode::kConservativeAdvancement computes the bounds on the
+     bodies' motion, which reads the shapes of all collision geometries; the
+     bounds are recomputed whenever collision shapes are added or removed. */
+    void set_edge_checking_mode(EdgeCheckingMode mode);
+
     /** Checks a single configuration-to-configuration edge for collision, using
      the current thread's associated context.
      @param q1 Start configuration for edge.
@@ -1256,6 +1293,21 @@ private:
      found. */
     std::string CriticizePaddingMatrix(const Eigen::MatrixXd& padding, const char* func) const;
 
+    /* Checks the edge from `q1` to `q2` at the same samples as the sequential
+     check, in bisection order. */
+    bool CheckContextEdgeCollisionFreeInBisectionOrder(CollisionCheckerContext* model_context,
+                                                       const Eigen::VectorXd& q1,
+                                                       const Eigen::VectorXd& q2) const;
+
+    /* Recomputes body_motion_bound_terms_ for the current edge checking mode
+     and added collision shapes. */
+    void UpdateBodyMotionBoundTerms();
+
+    /* Checks the edge from `q1` to `q2` by conservative advancement, or returns
+     nullopt if the edge's motion can't be bounded. */
+    std::optional<bool> MaybeCheckContextEdgeCollisionFreeByConservativeAdvancement(
+            CollisionCheckerContext* model_context, const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const;
+
     /* Gets the number of threads that may be used in an OpenMP-parallelized
      loop, which is the lesser of (a) the number of implicit contexts or (b) the
      number of threads specified by `parallelize`. If OpenMP is not available,
@@ -1418,6 +1470,17 @@ private:
     /* Step size for edge collision checking. */
     double edge_step_size_ = 0.0;
 
+    /* How edges are checked for collision. */
+    EdgeCheckingMode edge_checking_mode_{EdgeCheckingMode::kSequential};
+
+    /* For conservative advancement, indexed by body: the terms (i, cᵢ) of an
+     upper bound Σ cᵢ⋅|Δqᵢ| on the distance any point of the body's collision
+     geometry (including the shapes added through the checker) moves when the
+     positions change linearly by Δq. A coefficient is infinite where no such
+     bound is known. Empty unless the edge checking mode is
+     kConservativeAdvancement. */
+    std::vector<std::vector<std::pair<int, double>>> body_motion_bound_terms_;
+
     /* Storage for body-body collision padding. */
     Eigen::MatrixXd collision_padding_;
 
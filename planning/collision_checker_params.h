@@ -41,6 +41,25 @@ for values of q, q1, and q2 that are valid for the CollisionChecker's plant. */
 using ConfigurationInterpolationFunction =
         std::function<Eigen::VectorXd(const Eigen::VectorXd&, const Eigen::VectorXd&, double)>;
 
+/** How CollisionChecker checks an edge between two configurations for
+collision. See CollisionChecker::set_edge_checking_mode(). */
+enum class EdgeCheckingMode {
+    /** Checks configurations sampled at edge_step_size intervals, from the
+     start of the edge to its end. */
+    kSequential,
+
+    /** Checks the same configurations as kSequential, but in bisection order
+     (the ends, then the midpoint, then the quarter points, ...), so that a
+     collision anywhere along the edge tends to be found after few checks. */
+    kBisection,
+
+    /** Advances along the edge by steps no longer than the robot's clearance
+     allows, so that an edge reported collision free is free of collision
+     everywhere (not just at samples). Falls back to kBisection for edges it
+     can't certify. */
+    kConservativeAdvancement,
+};
+
 /** A set of common constructor parameters for a CollisionChecker.
 Not all subclasses of CollisionChecker will necessarily support this
 configuration struct, but many do so.
@@ -86,6 +105,9 @@ struct CollisionCheckerParams {
     collision. The value must be positive. */
     double edge_step_size{};
 
+    /** How edges are checked for collision; see EdgeCheckingMode. */
+    EdgeCheckingMode edge_checking_mode{EdgeCheckingMode::kSequential};
+
     // TODO(SeanCurtis-TRI): add doc hyperlinks to edge checking doc.
     /** Additional padding to apply to all robot-environment collision queries. If
     distance between robot and environment is less than padding, the checker
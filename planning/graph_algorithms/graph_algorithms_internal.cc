@@ -33,6 +33,20 @@ void SymmetrizeTripletList(std::vector<Eigen::Triplet<bool>>* expected_entries)
     }
 }
 
+std::vector<std::vector<int>> AdjacencyLists(const Eigen::SparseMatrix<bool>& adjacency_matrix) {
+    const int n = adjacency_matrix.cols();
+    DRAKE_DEMAND(adjacency_matrix.rows() == n);
+    std::vector<std::vector<int>> neighbors(n);
+    for (int j = 0; j < n; ++j) {
+        for (Eigen::SparseMatrix<bool>::InnerIterator it(adjacency_matrix, j); it; ++it) {
+            if (it.value() && it.index() != j) {
+                neighbors[j].push_back(it.index());
+            }
+        }
+    }
+    return neighbors;
+}
+
 }  // namespace internal
 }  // namespace graph_algorithms
 }  // namespace planning
@@ -22,6 +22,11 @@ Eigen::SparseMatrix<bool> ComplementAdjacencyMatrix(
 // This is useful when constructing adjacency matrices.
 void SymmetrizeTripletList(std::vector<Eigen::Triplet<bool>>* expected_entries);
 
+// Given the adjacency matrix of a graph, return the neighbors of each vertex in
+// increasing order. Self-loops (i.e. true entries on the diagonal) and explicitly
+// stored false entries are ignored.
+std::vector<std::vector<int>> AdjacencyLists(const Eigen::SparseMatrix<bool>& adjacency_matrix);
+
 }  // namespace internal
 }  // namespace graph_algorithms
 }  // namespace planning
@@ -0,0 +1,337 @@
+#include "planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "common/drake_throw.h"
+#include "common/ssize.h"
+#include "common/text_logging.h"
+#include "planning/graph_algorithms/graph_algorithms_internal.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+namespace {
+
+using Word = uint64_t;
+constexpr int kWordBits = 64;
+
+// Returns a clique containing `start`, grown by repeatedly adding the candidate
+// of highest degree.
+std::vector<int> GreedyClique(const std::vector<std::vector<int>>& neighbors, int start) {
+    std::vector<int> clique{start};
+    std::vector<int> candidates = neighbors[start];
+    std::vector<int> next_candidates;
+    while (!candidates.empty()) {
+        const int v = *std::max_element(candidates.begin(), candidates.end(), [&neighbors](int a, int b) {
+            return neighbors[a].size() < neighbors[b].size();
+        });
+        clique.push_back(v);
+        next_candidates.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), neighbors[v].begin(), neighbors[v].end(),
+                              std::back_inserter(next_candidates));
+        std::swap(candidates, next_candidates);
+    }
+    return clique;
+}
+
+// Computes the core number of each vertex, and the vertices in the order they
+// are peeled (smallest-last) by the O(edges) algorithm of V. Batagelj and M.
+// Zaversnik, "An O(m) algorithm for cores decomposition of networks", 2003.
+// Core numbers are nondecreasing along the peeling order.
+void ComputeCores(const std::vector<std::vector<int>>& neighbors, std::vector<int>* core, std::vector<int>* order) {
+    const int n = ssize(neighbors);
+    std::vector<int>& degree = *core;
+    degree.resize(n);
+    int max_degree = 0;
+    for (int v = 0; v < n; ++v) {
+        degree[v] = ssize(neighbors[v]);
+        max_degree = std::max(max_degree, degree[v]);
+    }
+    // Bucket sort the vertices by degree; bin[d] is the start of the bucket of
+    // degree d in `vert`, and pos[v] is the position of v in `vert`.
+    std::vector<int> bin(max_degree + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        ++bin[degree[v]];
+    }
+    int start = 0;
+    for (int d = 0; d <= max_degree; ++d) {
+        const int count = bin[d];
+        bin[d] = start;
+        start += count;
+    }
+    std::vector<int>& vert = *order;
+    vert.resize(n);
+    std::vector<int> pos(n);
+    for (int v = 0; v < n; ++v) {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = max_degree; d > 0; --d) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+    for (int i = 0; i < n; ++i) {
+        const int v = vert[i];
+        for (const int u : neighbors[v]) {
+            if (degree[u] > degree[v]) {
+                // Move u to the front of its bucket, and then into the bucket
+                // below.
+                const int du = degree[u];
+                const int pu = pos[u];
+                const int pw = bin[du];
+                const int w = vert[pw];
+                if (u != w) {
+                    pos[u] = pw;
+                    vert[pu] = w;
+                    pos[w] = pu;
+                    vert[pw] = u;
+                }
+                ++bin[du];
+                --degree[u];
+            }
+        }
+    }
+}
+
+// The bit-parallel branch and bound over a graph whose adjacency is stored as
+// bitsets, one row of num_words_ words per vertex.
+class BitsetBranchAndBound {
+public:
+    // Only cliques larger than `lower_bound` are searched for.
+    BitsetBranchAndBound(const std::vector<std::vector<int>>& neighbors,
+                         int lower_bound,
+                         int max_clique_size,
+                         std::optional<int64_t> max_branches)
+        : n_(ssize(neighbors)),
+          num_words_((n_ + kWordBits - 1) / kWordBits),
+          adjacency_(static_cast<size_t>(n_) * num_words_, 0),
+          best_size_(lower_bound),
+          max_branches_(max_branches) {
+        for (int v = 0; v < n_; ++v) {
+            Word* row = &adjacency_[static_cast<size_t>(v) * num_words_];
+            for (const int u : neighbors[v]) {
+                row[u / kWordBits] |= Word{1} << (u % kWordBits);
+            }
+        }
+        // The search is at most as deep as the largest possible clique.
+        const int num_levels = max_clique_size + 1;
+        candidates_.assign(num_levels, std::vector<Word>(num_words_, 0));
+        orders_.resize(num_levels);
+        colors_.resize(num_levels);
+        uncolored_.resize(num_words_);
+        color_class_.resize(num_words_);
+        clique_.reserve(num_levels);
+    }
+
+    // Runs the search, returning the largest clique found, or an empty vector
+    // if none is larger than the lower bound.
+    std::vector<int> Solve() {
+        std::vector<Word>& all = candidates_[0];
+        for (int v = 0; v < n_; ++v) {
+            all[v / kWordBits] |= Word{1} << (v % kWordBits);
+        }
+        Expand(0);
+        if (stopped_) {
+            log()->info(
+                    "MaxCliqueSolverViaBranchAndBound: stopped after {} branches with a clique of size {}, which may "
+                    "not be maximum.",
+                    branches_, best_size_);
+        }
+        return best_;
+    }
+
+private:
+    const Word* row(int v) const { return &adjacency_[static_cast<size_t>(v) * num_words_]; }
+
+    // Greedily colors the candidates at `depth` by color classes of mutually
+    // non-adjacent vertices, writing the vertices whose color is at least
+    // `min_color` (in nondecreasing order of color) and their colors to the
+    // level's order and colors.
+    void ColorSort(int depth, int min_color) {
+        std::vector<int>& order = orders_[depth];
+        std::vector<int>& colors = colors_[depth];
+        order.clear();
+        colors.clear();
+        std::copy(candidates_[depth].begin(), candidates_[depth].end(), uncolored_.begin());
+        int first_word = 0;
+        int color = 0;
+        while (true) {
+            while (first_word < num_words_ && uncolored_[first_word] == 0) {
+                ++first_word;
+            }
+            if (first_word == num_words_) {
+                break;
+            }
+            ++color;
+            std::copy(uncolored_.begin() + first_word, uncolored_.end(), color_class_.begin() + first_word);
+            for (int w = first_word; w < num_words_; ++w) {
+                while (color_class_[w] != 0) {
+                    const int bit = std::countr_zero(color_class_[w]);
+                    const int v = w * kWordBits + bit;
+                    const Word mask = ~(Word{1} << bit);
+                    uncolored_[w] &= mask;
+                    color_class_[w] &= mask;
+                    // Vertices before v in the class have already been visited.
+                    const Word* v_row = row(v);
+                    for (int x = w; x < num_words_; ++x) {
+                        color_class_[x] &= ~v_row[x];
+                    }
+                    if (color >= min_color) {
+                        order.push_back(v);
+                        colors.push_back(color);
+                    }
+                }
+            }
+        }
+    }
+
+    void Expand(int depth) {
+        const int clique_size = ssize(clique_);
+        ColorSort(depth, std::max(1, best_size_ - clique_size + 1));
+        const std::vector<int>& order = orders_[depth];
+        const std::vector<int>& colors = colors_[depth];
+        std::vector<Word>& candidates = candidates_[depth];
+        for (int i = ssize(order) - 1; i >= 0; --i) {
+            // The candidates left can't extend the clique past the best one.
+            if (clique_size + colors[i] <= best_size_) {
+                return;
+            }
+            if (max_branches_.has_value() && branches_ >= *max_branches_) {
+                stopped_ = true;
+                return;
+            }
+            ++branches_;
+            const int v = order[i];
+            clique_.push_back(v);
+            std::vector<Word>& next = candidates_[depth + 1];
+            const Word* v_row = row(v);
+            bool any = false;
+            for (int w = 0; w < num_words_; ++w) {
+                next[w] = candidates[w] & v_row[w];
+                any = any || next[w] != 0;
+            }
+            if (any) {
+                Expand(depth + 1);
+            } else if (ssize(clique_) > best_size_) {
+                best_ = clique_;
+                best_size_ = ssize(best_);
+            }
+            clique_.pop_back();
+            if (stopped_) {
+                return;
+            }
+            candidates[v / kWordBits] &= ~(Word{1} << (v % kWordBits));
+        }
+    }
+
+    const int n_;
+    const int num_words_;
+    std::vector<Word> adjacency_;
+    std::vector<int> best_;
+    int best_size_{};
+    const std::optional<int64_t> max_branches_;
+
+    // The candidate vertices at each depth of the search, and the coloring
+    // order and colors of those candidates.
+    std::vector<std::vector<Word>> candidates_;
+    std::vector<std::vector<int>> orders_;
+    std::vector<std::vector<int>> colors_;
+    // Scratch space for ColorSort().
+    std::vector<Word> uncolored_;
+    std::vector<Word> color_class_;
+
+    std::vector<int> clique_;
+    int64_t branches_{0};
+    bool stopped_{false};
+};
+
+}  // namespace
+
+MaxCliqueSolverViaBranchAndBound::MaxCliqueSolverViaBranchAndBound(std::optional<int64_t> max_branches) {
+    SetMaxBranches(max_branches);
+}
+
+void MaxCliqueSolverViaBranchAndBound::SetMaxBranches(std::optional<int64_t> max_branches) {
+    DRAKE_THROW_UNLESS(!max_branches.has_value() || *max_branches > 0);
+    max_branches_ = max_branches;
+}
+
+VectorX<bool> MaxCliqueSolverViaBranchAndBound::DoSolveMaxClique(
+        const Eigen::SparseMatrix<bool>& adjacency_matrix) const {
+    const int n = adjacency_matrix.cols();
+    VectorX<bool> is_clique_member = VectorX<bool>::Constant(n, false);
+    if (n == 0) {
+        return is_clique_member;
+    }
+    const std::vector<std::vector<int>> neighbors = internal::AdjacencyLists(adjacency_matrix);
+
+    // Find an initial clique greedily from the vertices of highest degree.
+    constexpr int kNumGreedyStarts = 16;
+    std::vector<int> by_degree(n);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    const int num_greedy_starts = std::min(n, kNumGreedyStarts);
+    std::partial_sort(by_degree.begin(), by_degree.begin() + num_greedy_starts, by_degree.end(),
+                      [&neighbors](int a, int b) {
+                          return neighbors[a].size() > neighbors[b].size();
+                      });
+    std::vector<int> best;
+    for (int i = 0; i < num_greedy_starts; ++i) {
+        std::vector<int> clique = GreedyClique(neighbors, by_degree[i]);
+        if (clique.size() > best.size()) {
+            best = std::move(clique);
+        }
+    }
+
+    // A clique of size k lies within the (k-1)-core, so only the vertices whose
+    // core number is at least the greedy clique's size can be in a larger one,
+    // and no clique is larger than the degeneracy plus one.
+    std::vector<int> core;
+    std::vector<int> peel_order;
+    ComputeCores(neighbors, &core, &peel_order);
+    const int degeneracy = *std::max_element(core.begin(), core.end());
+    if (ssize(best) < degeneracy + 1) {
+        // Renumber the remaining vertices with the last peeled (most deeply
+        // nested) first, so that they are colored first.
+        std::vector<int> original_index;
+        std::vector<int> new_index(n, -1);
+        for (auto it = peel_order.rbegin(); it != peel_order.rend() && core[*it] >= ssize(best); ++it) {
+            new_index[*it] = ssize(original_index);
+            original_index.push_back(*it);
+        }
+        std::vector<std::vector<int>> sub_neighbors(original_index.size());
+        for (int i = 0; i < ssize(original_index); ++i) {
+            for (const int u : neighbors[original_index[i]]) {
+                if (new_index[u] >= 0) {
+                    sub_neighbors[i].push_back(new_index[u]);
+                }
+            }
+        }
+        log()->debug(
+                "MaxCliqueSolverViaBranchAndBound: searching {} of {} vertices for a clique larger than {} (at most "
+                "{}).",
+                ssize(original_index), n, ssize(best), degeneracy + 1);
+        BitsetBranchAndBound search(sub_neighbors, ssize(best), degeneracy + 1, max_branches_);
+        const std::vector<int> sub_clique = search.Solve();
+        if (!sub_clique.empty()) {
+            best.resize(sub_clique.size());
+            std::transform(sub_clique.begin(), sub_clique.end(), best.begin(), [&original_index](int i) {
+                return original_index[i];
+            });
+        }
+    }
+
+    for (const int v : best) {
+        is_clique_member(v) = true;
+    }
+    return is_clique_member;
+}
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include <Eigen/Sparse>
+
+#include "planning/graph_algorithms/max_clique_solver_base.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+/**
+ * Solves the maximum clique problem to global optimality by a combinatorial
+ * branch and bound, in the style of the BBMC algorithm of
+ *
+ * P. San Segundo, D. Rodríguez-Losada, A. Jiménez, "An exact bit-parallel
+ * algorithm for the maximum clique problem", Computers & Operations Research
+ * 38(2), 2011.
+ *
+ * The graph's vertices are first pruned to those that could belong to a
+ * clique larger than one found greedily (by repeatedly removing the vertices
+ * of too low degree), and reordered by degeneracy. The neighborhoods of the
+ * remaining vertices are then stored as bitsets, so that the candidate sets of
+ * the search are intersected, and greedily colored to bound the size of the
+ * cliques they can contain, 64 vertices at a time. Subproblems whose coloring
+ * bound can't beat the best clique found so far are pruned.
+ *
+ * Unlike MaxCliqueSolverViaMip, this requires no external solver, and it is
+ * typically much faster on the sparse-to-moderately-dense graphs of
+ * VisibilityGraph(). Its worst case is still exponential; the search can be
+ * limited to a number of branches, in which case the best clique found so far
+ * is returned (and is not necessarily maximum). The bitsets take n²/8 bytes
+ * for the n vertices that survive pruning.
+ */
+class MaxCliqueSolverViaBranchAndBound final : public MaxCliqueSolverBase {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MaxCliqueSolverViaBranchAndBound);
+    MaxCliqueSolverViaBranchAndBound() = default;
+
+    /**
+     * @param max_branches If set, the search stops after branching on this
+     * many vertices and returns the best clique found so far.
+     * @throws std::exception if `max_branches` is not positive.
+     */
+    explicit MaxCliqueSolverViaBranchAndBound(std::optional<int64_t> max_branches);
+
+    void SetMaxBranches(std::optional<int64_t> max_branches);
+
+    [[nodiscard]] std::optional<int64_t> GetMaxBranches() const { return max_branches_; }
+
+private:
+    VectorX<bool> DoSolveMaxClique(const Eigen::SparseMatrix<bool>& adjacency_matrix) const final;
+
+    /* The limit on the number of branches of the search, if any. */
+    std::optional<int64_t> max_branches_{std::nullopt};
+};
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
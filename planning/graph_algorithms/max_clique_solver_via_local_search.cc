@@ -0,0 +1,208 @@
+#include "planning/graph_algorithms/max_clique_solver_via_local_search.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <common_robotics_utilities/parallelism.hpp>
+
+#include "common/drake_throw.h"
+#include "common/random.h"
+#include "common/ssize.h"
+#include "planning/graph_algorithms/graph_algorithms_internal.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+
+namespace {
+
+// The number of steps for which a vertex swapped out of the clique can't be
+// swapped back in.
+constexpr int kTabuTenure = 7;
+
+// One start of the local search.
+class LocalSearch {
+public:
+    explicit LocalSearch(const std::vector<std::vector<int>>& neighbors)
+        : neighbors_(neighbors),
+          in_clique_(neighbors.size(), 0),
+          num_adjacent_members_(neighbors.size(), 0),
+          tabu_until_(neighbors.size(), -1),
+          seen_(neighbors.size(), -1) {}
+
+    // Grows a clique from `start`, returning the largest clique found.
+    std::vector<int> Run(int start, int max_steps, RandomGenerator* generator) {
+        Add(start);
+        std::vector<int> best = clique_;
+        std::vector<int> add_candidates;
+        std::vector<int> swap_candidates;
+        for (int step = 0; step < max_steps; ++step) {
+            FindCandidates(step, &add_candidates, &swap_candidates);
+            if (!add_candidates.empty()) {
+                Add(add_candidates[Uniform(ssize(add_candidates), generator)]);
+                if (clique_.size() > best.size()) {
+                    best = clique_;
+                }
+            } else if (!swap_candidates.empty()) {
+                const int v = swap_candidates[Uniform(ssize(swap_candidates), generator)];
+                // Swap out the one member that isn't adjacent to v.
+                const std::vector<int>& v_neighbors = neighbors_[v];
+                for (const int member : clique_) {
+                    if (!std::binary_search(v_neighbors.begin(), v_neighbors.end(), member)) {
+                        Remove(member);
+                        tabu_until_[member] = step + kTabuTenure;
+                        break;
+                    }
+                }
+                Add(v);
+            } else {
+                // Restart around a random vertex, keeping the members adjacent to
+                // it.
+                const int v = Uniform(ssize(neighbors_), generator);
+                if (in_clique_[v]) {
+                    continue;
+                }
+                const std::vector<int> members = clique_;
+                const std::vector<int>& v_neighbors = neighbors_[v];
+                for (const int member : members) {
+                    if (!std::binary_search(v_neighbors.begin(), v_neighbors.end(), member)) {
+                        Remove(member);
+                    }
+                }
+                Add(v);
+            }
+        }
+        return best;
+    }
+
+private:
+    static int Uniform(int n, RandomGenerator* generator) {
+        return std::uniform_int_distribution<int>(0, n - 1)(*generator);
+    }
+
+    void Add(int v) {
+        in_clique_[v] = 1;
+        clique_.push_back(v);
+        for (const int u : neighbors_[v]) {
+            ++num_adjacent_members_[u];
+        }
+    }
+
+    void Remove(int v) {
+        in_clique_[v] = 0;
+        clique_.erase(std::find(clique_.begin(), clique_.end(), v));
+        for (const int u : neighbors_[v]) {
+            --num_adjacent_members_[u];
+        }
+    }
+
+    // Finds the vertices adjacent to every member of the clique, and those
+    // (not tabu) adjacent to all but one member. Every such vertex is adjacent
+    // to at least one of the two members of lowest degree, so only their
+    // neighbors are scanned.
+    void FindCandidates(int step, std::vector<int>* add_candidates, std::vector<int>* swap_candidates) {
+        add_candidates->clear();
+        swap_candidates->clear();
+        const int clique_size = ssize(clique_);
+        std::vector<int> scanned(clique_.begin(), clique_.end());
+        const int num_scanned = std::min(clique_size, 2);
+        std::partial_sort(scanned.begin(), scanned.begin() + num_scanned, scanned.end(), [this](int a, int b) {
+            return neighbors_[a].size() < neighbors_[b].size();
+        });
+        for (int i = 0; i < num_scanned; ++i) {
+            for (const int u : neighbors_[scanned[i]]) {
+                if (in_clique_[u] || seen_[u] == step) {
+                    continue;
+                }
+                seen_[u] = step;
+                if (num_adjacent_members_[u] == clique_size) {
+                    add_candidates->push_back(u);
+                } else if (clique_size > 1 && num_adjacent_members_[u] == clique_size - 1 && tabu_until_[u] < step) {
+                    swap_candidates->push_back(u);
+                }
+            }
+        }
+    }
+
+    const std::vector<std::vector<int>>& neighbors_;
+    std::vector<int> clique_;
+    std::vector<uint8_t> in_clique_;
+    // The number of clique members adjacent to each vertex.
+    std::vector<int> num_adjacent_members_;
+    // The step until which each vertex can't be swapped in.
+    std::vector<int> tabu_until_;
+    // The step on which each vertex was last scanned by FindCandidates().
+    std::vector<int> seen_;
+};
+
+}  // namespace
+
+MaxCliqueSolverViaLocalSearch::MaxCliqueSolverViaLocalSearch(int num_starts,
+                                                             int max_steps_per_start,
+                                                             Parallelism parallelism,
+                                                             int random_seed)
+    : parallelism_(parallelism), random_seed_(random_seed) {
+    SetNumStarts(num_starts);
+    SetMaxStepsPerStart(max_steps_per_start);
+}
+
+void MaxCliqueSolverViaLocalSearch::SetNumStarts(int num_starts) {
+    DRAKE_THROW_UNLESS(num_starts > 0);
+    num_starts_ = num_starts;
+}
+
+void MaxCliqueSolverViaLocalSearch::SetMaxStepsPerStart(int max_steps_per_start) {
+    DRAKE_THROW_UNLESS(max_steps_per_start > 0);
+    max_steps_per_start_ = max_steps_per_start;
+}
+
+VectorX<bool> MaxCliqueSolverViaLocalSearch::DoSolveMaxClique(const Eigen::SparseMatrix<bool>& adjacency_matrix) const {
+    const int n = adjacency_matrix.cols();
+    VectorX<bool> is_clique_member = VectorX<bool>::Constant(n, false);
+    if (n == 0) {
+        return is_clique_member;
+    }
+    const std::vector<std::vector<int>> neighbors = internal::AdjacencyLists(adjacency_matrix);
+
+    // The first half of the starts are from the vertices of highest degree.
+    const int num_degree_starts = std::min(n, (num_starts_ + 1) / 2);
+    std::vector<int> by_degree(n);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    std::partial_sort(by_degree.begin(), by_degree.begin() + num_degree_starts, by_degree.end(),
+                      [&neighbors](int a, int b) {
+                          return neighbors[a].size() > neighbors[b].size();
+                      });
+
+    std::vector<std::vector<int>> cliques(num_starts_);
+    const auto start_work = [&](const int, const int64_t s) {
+        RandomGenerator generator(static_cast<RandomGenerator::result_type>(random_seed_) + s);
+        const int start = s < num_degree_starts ? by_degree[s]
+                                                : std::uniform_int_distribution<int>(0, n - 1)(generator);
+        LocalSearch search(neighbors);
+        cliques[s] = search.Run(start, max_steps_per_start_, &generator);
+    };
+    StaticParallelForIndexLoop(DegreeOfParallelism(parallelism_.num_threads()), 0, num_starts_, start_work,
+                               ParallelForBackend::BEST_AVAILABLE);
+
+    // Ties go to the earliest start, so that the result doesn't depend on the
+    // parallelism.
+    const std::vector<int>& best =
+            *std::max_element(cliques.begin(), cliques.end(), [](const std::vector<int>& a, const std::vector<int>& b) {
+                return a.size() < b.size();
+            });
+    for (const int v : best) {
+        is_clique_member(v) = true;
+    }
+    return is_clique_member;
+}
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
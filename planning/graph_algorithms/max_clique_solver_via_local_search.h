@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include "common/parallelism.h"
+#include "planning/graph_algorithms/max_clique_solver_base.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+/**
+ * Approximately solves the maximum clique problem by a multi-start local
+ * search, in the style of the dynamic local search of
+ *
+ * W. Pullan, H. H. Hoos, "Dynamic Local Search for the Maximum Clique
+ * Problem", Journal of Artificial Intelligence Research 25, 2006.
+ *
+ * Each start grows a clique from a different vertex (the vertices of highest
+ * degree first, then random ones), alternating between adding a vertex
+ * adjacent to the whole clique and, when there is none, swapping a clique
+ * member for a vertex adjacent to all of the other members. A vertex swapped
+ * out can't be swapped back in for a few steps, and when no move is possible
+ * the clique is restarted around a random vertex, keeping the members adjacent
+ * to it. The starts run in parallel, each with its own random generator seeded
+ * from `random_seed` and the start's index, so the result doesn't depend on
+ * the parallelism.
+ *
+ * Like MaxCliqueSolverViaGreedy, this is a heuristic: the clique returned is
+ * the largest found, and is not necessarily maximum. It usually finds much
+ * larger cliques than the greedy heuristic on the graphs of VisibilityGraph(),
+ * for a cost of about `num_starts * max_steps_per_start` moves, each linear in
+ * the degree of the clique's members.
+ */
+class MaxCliqueSolverViaLocalSearch final : public MaxCliqueSolverBase {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MaxCliqueSolverViaLocalSearch);
+    MaxCliqueSolverViaLocalSearch() = default;
+
+    /**
+     * @throws std::exception if `num_starts` or `max_steps_per_start` is not
+     * positive.
+     */
+    MaxCliqueSolverViaLocalSearch(int num_starts,
+                                  int max_steps_per_start,
+                                  Parallelism parallelism = Parallelism::Max(),
+                                  int random_seed = 1234);
+
+    /** @throws std::exception if `num_starts` is not positive. */
+    void SetNumStarts(int num_starts);
+
+    [[nodiscard]] int GetNumStarts() const { return num_starts_; }
+
+    /** @throws std::exception if `max_steps_per_start` is not positive. */
+    void SetMaxStepsPerStart(int max_steps_per_start);
+
+    [[nodiscard]] int GetMaxStepsPerStart() const { return max_steps_per_start_; }
+
+    void SetParallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+    [[nodiscard]] Parallelism GetParallelism() const { return parallelism_; }
+
+    void SetRandomSeed(int random_seed) { random_seed_ = random_seed; }
+
+    [[nodiscard]] int GetRandomSeed() const { return random_seed_; }
+
+private:
+    VectorX<bool> DoSolveMaxClique(const Eigen::SparseMatrix<bool>& adjacency_matrix) const final;
+
+    /* The number of cliques grown from different starting vertices. */
+    int num_starts_{32};
+
+    /* The number of add and swap moves made from each start. */
+    int max_steps_per_start_{1000};
+
+    /* The number of starts run concurrently. */
+    Parallelism parallelism_{Parallelism::Max()};
+
+    /* The seed of the random choices of the search. */
+    int random_seed_{1234};
+};
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <filesystem>
 #include <future>
 #include <limits>
 #include <mutex>
@@ -14,6 +16,7 @@
 #include <common_robotics_utilities/parallelism.hpp>
 
 #include "common/ssize.h"
+#include "common/yaml/yaml_io.h"
 #include "geometry/optimization/iris.h"
 #include "planning/collision_checker.h"
 #include "planning/scene_graph_collision_checker.h"
@@ -231,7 +234,7 @@ std::queue<HPolyhedron> IrisWorker(const CollisionChecker& checker,
     return ret;
 }
 
-int ComputeMaxNumberOfCliquesInGreedyCliqueCover(const int num_vertices, const int minimum_clique_size) {
+int64_t ComputeMaxNumberOfCliquesInGreedyCliqueCover(const int64_t num_vertices, const int64_t minimum_clique_size) {
     // From "Restricted greedy clique decompositions and greedy clique
     // decompositions of K 4-free graphs" by Sean McGuinness, we have that the
     // most cliques that we could obtain from the greedy truncated clique
@@ -239,10 +242,163 @@ int ComputeMaxNumberOfCliquesInGreedyCliqueCover(const int num_vertices, const i
     // minimum_clique_size). This number is
     // 0.5* (1−1/r) * (num_vertices² − s²)  +  (s choose 2)
     // Where  num_vertices= q*minimum_clique_size+s
-    const int q = std::floor(num_vertices / minimum_clique_size);
-    const int s = num_vertices - q * minimum_clique_size;
-    return static_cast<int>((1 - 1.0 / minimum_clique_size) * (num_vertices * num_vertices - s * s) / 2 +
-                            (s * (s + 1)) / 2);
+    const int64_t q = num_vertices / minimum_clique_size;
+    const int64_t s = num_vertices - q * minimum_clique_size;
+    return static_cast<int64_t>((1 - 1.0 / minimum_clique_size) * (num_vertices * num_vertices - s * s) / 2 +
+                                (s * (s + 1)) / 2);
+}
+
+// The state of IrisInConfigurationSpaceFromCliqueCover that is saved to
+// IrisFromCliqueCoverOptions::checkpoint_file.
+struct CliqueCoverCheckpoint {
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(sets));
+        a->Visit(DRAKE_NVP(num_iterations));
+        a->Visit(DRAKE_NVP(num_points_per_visibility_round));
+        a->Visit(DRAKE_NVP(num_round_points_done));
+        a->Visit(DRAKE_NVP(num_round_new_sets));
+        a->Visit(DRAKE_NVP(coverage));
+        a->Visit(DRAKE_NVP(last_polytope_sample));
+    }
+
+    std::vector<HPolyhedron> sets;
+    int num_iterations{0};
+    int num_points_per_visibility_round{0};
+    // The number of points of the current visibility round whose shards have
+    // been processed, and the number of sets they added.
+    int num_round_points_done{0};
+    int num_round_new_sets{0};
+    // The coverage estimate at the start of the current iteration.
+    double coverage{0.0};
+    Eigen::VectorXd last_polytope_sample;
+};
+
+// Saves `checkpoint` to `filename` by writing a temporary file next to it and
+// renaming it over `filename`, so that an interrupted save leaves the previous
+// checkpoint intact.
+void SaveCheckpoint(const std::filesystem::path& filename, const CliqueCoverCheckpoint& checkpoint) {
+    std::filesystem::path temp_filename = filename;
+    temp_filename += ".tmp";
+    yaml::SaveYamlFile(temp_filename.string(), checkpoint);
+    std::filesystem::rename(temp_filename, filename);
+    log()->debug("IrisFromCliqueCover saved a checkpoint with {} sets to {}.", ssize(checkpoint.sets),
+                 filename.string());
+}
+
+// Samples `num_points` configurations from `domain` that are collision-free
+// and outside of all of the `sets`, continuing the hit-and-run chain from
+// `last_polytope_sample`. Candidates are drawn in batches (so that they only
+// depend on the generator) and checked in parallel.
+Eigen::MatrixXd SampleUncoveredPoints(const HPolyhedron& domain,
+                                      const std::vector<HPolyhedron>& sets,
+                                      const CollisionChecker& checker,
+                                      const int num_points,
+                                      const Parallelism& parallelism,
+                                      RandomGenerator* generator,
+                                      Eigen::VectorXd* last_polytope_sample) {
+    // Bounds the memory used by the candidates of one batch.
+    constexpr int kMaxBatchSize = 4096;
+    Eigen::MatrixXd points(domain.ambient_dimension(), num_points);
+    int num_sampled = 0;
+    std::vector<Eigen::VectorXd> candidates;
+    std::vector<uint8_t> candidates_uncovered;
+    while (num_sampled < num_points) {
+        const int batch_size = std::min(2 * (num_points - num_sampled), kMaxBatchSize);
+        candidates.resize(batch_size);
+        for (int i = 0; i < batch_size; ++i) {
+            *last_polytope_sample = domain.UniformSample(generator, *last_polytope_sample);
+            candidates[i] = *last_polytope_sample;
+        }
+        const std::vector<uint8_t> candidates_free = checker.CheckConfigsCollisionFree(candidates, parallelism);
+        candidates_uncovered.assign(batch_size, 0x00);
+        const auto uncovered_work = [&](const int, const int64_t i) {
+            if (candidates_free[i] > 0) {
+                candidates_uncovered[i] = static_cast<uint8_t>(
+                        std::none_of(sets.begin(), sets.end(), [&candidates, i](const HPolyhedron& set) -> bool {
+                            return set.PointInSet(candidates[i]);
+                        }));
+            }
+        };
+        StaticParallelForIndexLoop(DegreeOfParallelism(parallelism.num_threads()), 0, batch_size, uncovered_work,
+                                   ParallelForBackend::BEST_AVAILABLE);
+        for (int i = 0; i < batch_size && num_sampled < num_points; ++i) {
+            if (candidates_uncovered[i] > 0) {
+                points.col(num_sampled++) = candidates[i];
+            }
+        }
+    }
+    return points;
+}
+
+// Computes a greedy truncated clique cover of `visibility_graph` (whose
+// vertices are the columns of `points`) and builds an IRIS region from each
+// clique, appending the regions to `sets`. Returns the number of regions
+// added.
+int BuildSetsFromCliqueCover(const CollisionChecker& checker,
+                             const Eigen::MatrixXd& points,
+                             const IrisFromCliqueCoverOptions& options,
+                             const int minimum_clique_size,
+                             const MaxCliqueSolverBase& max_clique_solver,
+                             SparseMatrix<bool>* visibility_graph,
+                             std::vector<HPolyhedron>* sets) {
+    // Reserve more space for the newly built sets. Typically, we won't get
+    // this worst case number of new cliques, so we only reserve half of the
+    // worst case (and never more than the number of points, since the worst
+    // case grows quadratically).
+    sets->reserve(sets->size() +
+                  std::min<int64_t>(ComputeMaxNumberOfCliquesInGreedyCliqueCover(visibility_graph->cols(),
+                                                                                 minimum_clique_size) /
+                                            2,
+                                    visibility_graph->cols()));
+
+    // Now solve the max clique cover and build new sets.
+    int num_new_sets{0};
+    // The computed cliques from the max clique solver. These will get pulled
+    // off the queue by the set builder workers to build the sets.
+    AsyncQueue<VectorX<bool>> computed_cliques;
+    if (options.parallelism.num_threads() == 1) {
+        ComputeGreedyTruncatedCliqueCover(minimum_clique_size, max_clique_solver, visibility_graph, &computed_cliques);
+        std::queue<HPolyhedron> new_set_queue =
+                IrisWorker(checker, points, 0, options, &computed_cliques, false /* No need to disable meshcat */);
+        while (!new_set_queue.empty()) {
+            sets->push_back(std::move(new_set_queue.front()));
+            new_set_queue.pop();
+            ++num_new_sets;
+        }
+    } else {
+        // Compute truncated clique cover.
+        std::future<void> clique_future{std::async(std::launch::async, ComputeGreedyTruncatedCliqueCover,
+                                                   minimum_clique_size, std::ref(max_clique_solver), visibility_graph,
+                                                   &computed_cliques)};
+
+        // We will use one thread to build cliques and the remaining threads to
+        // build IRIS regions. If this number is 0, then this function will end up
+        // single threaded.
+        const int num_builder_threads = options.parallelism.num_threads() - 1;
+        std::vector<std::future<std::queue<HPolyhedron>>> build_sets_future;
+        build_sets_future.reserve(num_builder_threads);
+        // Build convex sets.
+        for (int i = 0; i < num_builder_threads; ++i) {
+            build_sets_future.emplace_back(
+                    std::async(std::launch::async, IrisWorker, std::ref(checker), points, i, std::ref(options),
+                               &computed_cliques,
+                               // NOLINTNEXTLINE
+                               true /* Disable meshcat since IRIS runs outside the main thread */));
+        }
+        // The clique cover and the convex sets are computed asynchronously. Wait
+        // for all the threads to join and then add the new sets to built sets.
+        clique_future.get();
+        for (auto& new_set_queue_future : build_sets_future) {
+            std::queue<HPolyhedron> new_set_queue{new_set_queue_future.get()};
+            while (!new_set_queue.empty()) {
+                sets->push_back(std::move(new_set_queue.front()));
+                new_set_queue.pop();
+                ++num_new_sets;
+            }
+        }
+    }
+    return num_new_sets;
 }
 
 // Approximately compute the fraction of `domain` covered by `sets` by sampling
@@ -328,6 +484,10 @@ void IrisInConfigurationSpaceFromCliqueCover(
 
     // Override options which are set too aggressively.
     const int minimum_clique_size = std::max(options.minimum_clique_size, checker.plant().num_positions() + 1);
+    // A shard of at most minimum_clique_size points yields no cliques, so the
+    // rounds would never make progress.
+    DRAKE_THROW_UNLESS(!options.max_points_per_shard.has_value() ||
+                       *options.max_points_per_shard > minimum_clique_size);
 
     int num_points_per_visibility_round = std::max(options.num_points_per_visibility_round, 2 * minimum_clique_size);
 
@@ -338,8 +498,6 @@ void IrisInConfigurationSpaceFromCliqueCover(
 
     int num_iterations = 0;
 
-    std::vector<HPolyhedron> visibility_graph_sets;
-
     std::unique_ptr<planning::graph_algorithms::MaxCliqueSolverBase> default_max_clique_solver;
     // Only construct the default solver if max_clique_solver is null.
     if (max_clique_solver_ptr == nullptr) {
@@ -354,98 +512,98 @@ void IrisInConfigurationSpaceFromCliqueCover(
                                             options.point_in_set_tol, options.parallelism, generator,
                                             &last_polytope_sample);
     };
-    while (approximate_coverage() < options.coverage_termination_threshold &&
-           num_iterations < options.iteration_limit) {
-        log()->info("IrisFromCliqueCover Iteration {}/{}", num_iterations + 1, options.iteration_limit);
-        Eigen::MatrixXd points(domain.ambient_dimension(), num_points_per_visibility_round);
-        for (int i = 0; i < points.cols(); ++i) {
-            do {
-                last_polytope_sample = domain.UniformSample(generator, last_polytope_sample);
-            } while (
-                    // While the last polytope sample is in collision.
-                    !checker.CheckConfigCollisionFree(last_polytope_sample) ||
-                    // While the last polytope sample is in any of the sets.
-                    std::any_of(sets->begin(), sets->end(), [&last_polytope_sample](const HPolyhedron& set) -> bool {
-                        return set.PointInSet(last_polytope_sample);
-                    }));
-            points.col(i) = last_polytope_sample;
-        }
 
-        // Show the samples used in build cliques. Debugging visualization.
-        if (options.iris_options.meshcat && domain.ambient_dimension() <= 3) {
-            Eigen::Vector3d point_to_draw = Eigen::Vector3d::Zero();
-            for (int pt_to_draw = 0; pt_to_draw < points.cols(); ++pt_to_draw) {
-                std::string path = fmt::format("iteration{:02}/sample_{:03}", num_iterations, pt_to_draw);
-                options.iris_options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(1, 0.1, 0.1, 1.0));
-                point_to_draw.head(domain.ambient_dimension()) = points.col(pt_to_draw);
-                options.iris_options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
+    // The progress through the current visibility round.
+    int num_round_points_done = 0;
+    int num_round_new_sets = 0;
+    double coverage{};
+    const std::optional<std::filesystem::path> checkpoint_file =
+            options.checkpoint_file.has_value() ? std::optional<std::filesystem::path>(*options.checkpoint_file)
+                                                : std::nullopt;
+    if (checkpoint_file.has_value() && std::filesystem::exists(*checkpoint_file)) {
+        CliqueCoverCheckpoint checkpoint = yaml::LoadYamlFile<CliqueCoverCheckpoint>(checkpoint_file->string());
+        for (const HPolyhedron& set : checkpoint.sets) {
+            if (set.ambient_dimension() != domain.ambient_dimension()) {
+                throw std::runtime_error(
+                        fmt::format("IrisInConfigurationSpaceFromCliqueCover(): the checkpoint {} has a set of "
+                                    "dimension {}; the plant has {} positions.",
+                                    checkpoint_file->string(), set.ambient_dimension(), domain.ambient_dimension()));
             }
         }
+        *sets = std::move(checkpoint.sets);
+        num_iterations = checkpoint.num_iterations;
+        num_points_per_visibility_round = std::max(checkpoint.num_points_per_visibility_round, 2 * minimum_clique_size);
+        num_round_points_done = checkpoint.num_round_points_done;
+        num_round_new_sets = checkpoint.num_round_new_sets;
+        coverage = checkpoint.coverage;
+        if (checkpoint.last_polytope_sample.size() == domain.ambient_dimension() &&
+            domain.PointInSet(checkpoint.last_polytope_sample)) {
+            last_polytope_sample = checkpoint.last_polytope_sample;
+        }
+        log()->info("IrisFromCliqueCover resuming from {} at iteration {} with {} sets.", checkpoint_file->string(),
+                    num_iterations + 1, ssize(*sets));
+    } else {
+        coverage = approximate_coverage();
+    }
+    const auto save_checkpoint = [&]() {
+        if (!checkpoint_file.has_value()) {
+            return;
+        }
+        CliqueCoverCheckpoint checkpoint;
+        checkpoint.sets = *sets;
+        checkpoint.num_iterations = num_iterations;
+        checkpoint.num_points_per_visibility_round = num_points_per_visibility_round;
+        checkpoint.num_round_points_done = num_round_points_done;
+        checkpoint.num_round_new_sets = num_round_new_sets;
+        checkpoint.coverage = coverage;
+        checkpoint.last_polytope_sample = last_polytope_sample;
+        SaveCheckpoint(*checkpoint_file, checkpoint);
+    };
 
-        Eigen::SparseMatrix<bool> visibility_graph =
-                VisibilityGraph(checker, points, max_collision_checker_parallelism);
-        // Reserve more space for the newly built sets. Typically, we won't get
-        // this worst case number of new cliques, so we only reserve half of the
-        // worst case.
-        sets->reserve(sets->size() +
-                      ComputeMaxNumberOfCliquesInGreedyCliqueCover(visibility_graph.cols(), minimum_clique_size) / 2);
-
-        // Now solve the max clique cover and build new sets.
-        int num_new_sets{0};
-        // The computed cliques from the max clique solver. These will get pulled
-        // off the queue by the set builder workers to build the sets.
-        AsyncQueue<VectorX<bool>> computed_cliques;
-        if (options.parallelism.num_threads() == 1) {
-            ComputeGreedyTruncatedCliqueCover(minimum_clique_size, *max_clique_solver, &visibility_graph,
-                                              &computed_cliques);
-            std::queue<HPolyhedron> new_set_queue =
-                    IrisWorker(checker, points, 0, options, &computed_cliques, false /* No need to disable meshcat */);
-            while (!new_set_queue.empty()) {
-                sets->push_back(std::move(new_set_queue.front()));
-                new_set_queue.pop();
-                ++num_new_sets;
-            }
-        } else {
-            // Compute truncated clique cover.
-            std::future<void> clique_future{std::async(std::launch::async, ComputeGreedyTruncatedCliqueCover,
-                                                       minimum_clique_size, std::ref(*max_clique_solver),
-                                                       &visibility_graph, &computed_cliques)};
-
-            // We will use one thread to build cliques and the remaining threads to
-            // build IRIS regions. If this number is 0, then this function will end up
-            // single threaded.
-            const int num_builder_threads = options.parallelism.num_threads() - 1;
-            std::vector<std::future<std::queue<HPolyhedron>>> build_sets_future;
-            build_sets_future.reserve(num_builder_threads);
-            // Build convex sets.
-            for (int i = 0; i < num_builder_threads; ++i) {
-                build_sets_future.emplace_back(
-                        std::async(std::launch::async, IrisWorker, std::ref(checker), points, i, std::ref(options),
-                                   &computed_cliques,
-                                   // NOLINTNEXTLINE
-                                   true /* Disable meshcat since IRIS runs outside the main thread */));
-            }
-            // The clique cover and the convex sets are computed asynchronously. Wait
-            // for all the threads to join and then add the new sets to built sets.
-            clique_future.get();
-            for (auto& new_set_queue_future : build_sets_future) {
-                std::queue<HPolyhedron> new_set_queue{new_set_queue_future.get()};
-                while (!new_set_queue.empty()) {
-                    sets->push_back(std::move(new_set_queue.front()));
-                    new_set_queue.pop();
-                    ++num_new_sets;
+    while (coverage < options.coverage_termination_threshold && num_iterations < options.iteration_limit) {
+        log()->info("IrisFromCliqueCover Iteration {}/{}", num_iterations + 1, options.iteration_limit);
+        const int max_points_per_shard = options.max_points_per_shard.value_or(num_points_per_visibility_round);
+        while (num_round_points_done < num_points_per_visibility_round) {
+            const int num_points =
+                    std::min(max_points_per_shard, num_points_per_visibility_round - num_round_points_done);
+            const Eigen::MatrixXd points =
+                    SampleUncoveredPoints(domain, *sets, checker, num_points, max_collision_checker_parallelism,
+                                          generator, &last_polytope_sample);
+
+            // Show the samples used in build cliques. Debugging visualization.
+            if (options.iris_options.meshcat && domain.ambient_dimension() <= 3) {
+                Eigen::Vector3d point_to_draw = Eigen::Vector3d::Zero();
+                for (int pt_to_draw = 0; pt_to_draw < points.cols(); ++pt_to_draw) {
+                    std::string path = fmt::format("iteration{:02}/sample_{:03}", num_iterations,
+                                                   num_round_points_done + pt_to_draw);
+                    options.iris_options.meshcat->SetObject(path, Sphere(0.01), geometry::Rgba(1, 0.1, 0.1, 1.0));
+                    point_to_draw.head(domain.ambient_dimension()) = points.col(pt_to_draw);
+                    options.iris_options.meshcat->SetTransform(path, RigidTransform<double>(point_to_draw));
                 }
             }
+
+            Eigen::SparseMatrix<bool> visibility_graph =
+                    VisibilityGraph(checker, points, max_collision_checker_parallelism);
+            num_round_new_sets += BuildSetsFromCliqueCover(checker, points, options, minimum_clique_size,
+                                                           *max_clique_solver, &visibility_graph, sets);
+            num_round_points_done += num_points;
+            if (num_round_points_done < num_points_per_visibility_round) {
+                save_checkpoint();
+            }
         }
         log()->info(
                 "{} new sets added in IrisFromCliqueCover at iteration {}. Total sets "
                 "= {}",
-                num_new_sets, num_iterations, ssize(*sets));
+                num_round_new_sets, num_iterations, ssize(*sets));
 
-        if (num_new_sets == 0) {
+        if (num_round_new_sets == 0) {
             num_points_per_visibility_round *= 2;
         }
         ++num_iterations;
+        num_round_points_done = 0;
+        num_round_new_sets = 0;
+        coverage = approximate_coverage();
+        save_checkpoint();
     }
 }
 }  // namespace planning
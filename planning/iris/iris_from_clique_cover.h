@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "common/parallelism.h"
@@ -85,6 +86,33 @@ struct IrisFromCliqueCoverOptions {
      */
     double point_in_set_tol{1e-6};
 
+    /**
+     * If set, each visibility round is processed in shards of at most this many
+     * points: the points of a shard are sampled outside of the regions built
+     * from the previous shards, and its visibility graph, clique cover and
+     * regions are computed before the next shard is sampled. The visibility
+     * graph is sparse, but building it takes a number of edge checks that is
+     * quadratic in its number of points, so sharding bounds the time and memory
+     * spent per graph for rounds with very many points (at the cost of cliques
+     * that span shards). If unset, each round is a single shard. If set, it
+     * must exceed the effective minimum clique size, i.e.
+     * max(minimum_clique_size, num_positions() + 1).
+     */
+    std::optional<int> max_points_per_shard{};
+
+    /**
+     * If set, the state of the cover (the sets, the iteration and shard
+     * reached, and the last coverage estimate) is saved to this YAML file after
+     * each shard and each coverage estimate. If the file already exists when
+     * IrisInConfigurationSpaceFromCliqueCover is called, the run resumes from
+     * it: the `sets` argument is replaced with the saved sets, and the saved
+     * coverage estimate is used instead of a new one. The state of the random
+     * generator isn't saved, so a resumed run samples different points than an
+     * uninterrupted run would have. The file is replaced atomically, so it
+     * survives the process being killed while saving.
+     */
+    std::optional<std::string> checkpoint_file{};
+
     // TODO(AlexandreAmice): Implement a constructor/option that automatically
     // sets up the ILP solver and selects MaxCliqueViaMip
 };
@@ -113,7 +141,9 @@ struct IrisFromCliqueCoverOptions {
  * If nullptr is passed as the `max_clique_solver`, then max clique will be
  * solved using an instance of MaxCliqueSolverViaGreedy, which is a fast
  * heuristic. If higher quality cliques are desired, consider changing the
- * solver to an instance of MaxCliqueSolverViaMip. Currently, the padding in the
+ * solver to an instance of MaxCliqueSolverViaLocalSearch (a better heuristic),
+ * MaxCliqueSolverViaBranchAndBound (exact, without an external solver) or
+ * MaxCliqueSolverViaMip. Currently, the padding in the
  * collision checker is not forwarded to the algorithm, and therefore the final
  * regions do not necessarily respect this padding. Effectively, this means that
  * the regions are generated as if the padding is set to 0. This behavior may be
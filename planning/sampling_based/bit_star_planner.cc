@@ -0,0 +1,270 @@
+#include "planning/sampling_based/bit_star_planner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "common/text_logging.h"
+#include "planning/sampling_based/configuration_space_nearest_neighbors.h"
+#include "planning/sampling_based/internal_planner_utilities.h"
+
+namespace drake {
+namespace planning {
+
+using Eigen::VectorXd;
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// The indices of the start and goal states.
+constexpr int kStart = 0;
+constexpr int kGoal = 1;
+
+class BitStar {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BitStar);
+
+    BitStar(const CollisionChecker& checker,
+            const BitStarParams& params,
+            const VectorXd& start,
+            const VectorXd& goal,
+            RandomGenerator* generator,
+            Parallelism parallelize)
+        : checker_(checker),
+          params_(params),
+          start_(start),
+          goal_(goal),
+          generator_(generator),
+          parallelize_(parallelize),
+          index_(checker) {}
+
+    PathPlanningResult Solve() {
+        AddState(start_);
+        AddState(goal_);
+        states_[kStart].in_tree = true;
+        states_[kStart].cost = 0;
+
+        for (batch_ = 0; batch_ < params_.max_batches; ++batch_) {
+            if (Sample() == 0 && batch_ > 0) break;
+            k_ = NumNeighbors();
+            Search();
+        }
+
+        if (!(cost_best() < kInf)) return {};
+        std::vector<VectorXd> path;
+        for (int v = kGoal; v >= 0; v = states_[v].parent) {
+            path.push_back(index_.configuration(v));
+        }
+        std::reverse(path.begin(), path.end());
+        return internal::MakePathPlanningResult(checker_, std::move(path));
+    }
+
+private:
+    // A sample, which is a vertex of the tree once it is connected to it.
+    struct State {
+        // Lower bounds on the cost from the start and to the goal.
+        double cost_from_start_estimate{};
+        double cost_to_goal_estimate{};
+        bool in_tree{false};
+        // The cost from the start through the tree (infinite for samples).
+        double cost{kInf};
+        int parent{-1};
+        std::vector<int> children;
+        // The last batch in which the vertex was expanded.
+        int expanded_batch{-1};
+    };
+
+    // A candidate edge, ordered by the lower bound on the cost of a path
+    // through it.
+    struct Edge {
+        bool operator>(const Edge& other) const { return key > other.key; }
+
+        double key{};
+        int from{};
+        int to{};
+        double distance{};
+    };
+
+    double cost_best() const { return states_[kGoal].cost; }
+
+    int AddState(const VectorXd& q) {
+        State state;
+        state.cost_from_start_estimate = checker_.ComputeConfigurationDistance(start_, q);
+        state.cost_to_goal_estimate = checker_.ComputeConfigurationDistance(q, goal_);
+        states_.push_back(std::move(state));
+        return index_.Add(q);
+    }
+
+    // Adds up to params_.batch_size collision-free samples which could improve
+    // the current path; returns the number added.
+    int Sample() {
+        const int64_t max_attempts =
+                static_cast<int64_t>(params_.max_sampling_attempts_per_sample) * params_.batch_size;
+        int64_t attempts = 0;
+        int num_added = 0;
+        while (num_added < params_.batch_size && attempts < max_attempts) {
+            // Draw informed candidates serially, then check them in parallel.
+            std::vector<VectorXd> candidates;
+            while (ssize(candidates) < 2 * (params_.batch_size - num_added) && attempts < max_attempts) {
+                ++attempts;
+                VectorXd q = internal::SampleUniformConfiguration(checker_, generator_);
+                if (checker_.ComputeConfigurationDistance(start_, q) + checker_.ComputeConfigurationDistance(q, goal_) <
+                    cost_best()) {
+                    candidates.push_back(std::move(q));
+                }
+            }
+            const std::vector<uint8_t> candidates_free = checker_.CheckConfigsCollisionFree(candidates, parallelize_);
+            for (int i = 0; i < ssize(candidates) && num_added < params_.batch_size; ++i) {
+                if (candidates_free[i] > 0) {
+                    AddState(candidates[i]);
+                    ++num_added;
+                }
+            }
+        }
+        return num_added;
+    }
+
+    int NumNeighbors() const {
+        const double dimension = checker_.plant().num_positions();
+        const double n = index_.size();
+        return static_cast<int>(std::ceil(params_.rewire_factor * M_E * (1 + 1 / dimension) * std::log(n)));
+    }
+
+    double VertexKey(int v) const { return states_[v].cost + states_[v].cost_to_goal_estimate; }
+
+    void PushVertex(int v) {
+        if (VertexKey(v) < cost_best()) vertex_queue_.emplace(VertexKey(v), v);
+    }
+
+    // Processes the queues until no candidate remains that could improve the
+    // path.
+    void Search() {
+        vertex_queue_ = {};
+        edge_queue_ = {};
+        for (int v = 0; v < ssize(states_); ++v) {
+            if (states_[v].in_tree) PushVertex(v);
+        }
+        while (true) {
+            const double vertex_key = vertex_queue_.empty() ? kInf : vertex_queue_.top().first;
+            const double edge_key = edge_queue_.empty() ? kInf : edge_queue_.top().key;
+            if (std::min(vertex_key, edge_key) >= cost_best()) break;
+            if (vertex_key <= edge_key) {
+                const int v = vertex_queue_.top().second;
+                vertex_queue_.pop();
+                ExpandVertex(v);
+            } else {
+                const Edge edge = edge_queue_.top();
+                edge_queue_.pop();
+                ProcessEdge(edge);
+            }
+        }
+    }
+
+    // Queues the edges from `v` to its nearest neighbors which could improve
+    // the path: to samples, and (to rewire the tree) to vertices.
+    void ExpandVertex(int v) {
+        State& state = states_[v];
+        if (state.expanded_batch == batch_) return;
+        state.expanded_batch = batch_;
+        const VectorXd& q_v = index_.configuration(v);
+        for (const int x : index_.FindKNearest(q_v, k_ + 1)) {
+            if (x == v || colliding_edges_.contains({std::min(v, x), std::max(v, x)})) continue;
+            const State& other = states_[x];
+            if (other.in_tree && (other.parent == v || state.parent == x)) continue;
+            const double distance = checker_.ComputeConfigurationDistance(q_v, index_.configuration(x));
+            const double key = state.cost + distance + other.cost_to_goal_estimate;
+            if (key < cost_best() && state.cost + distance < other.cost) {
+                edge_queue_.push({.key = key, .from = v, .to = x, .distance = distance});
+            }
+        }
+    }
+
+    void ProcessEdge(const Edge& edge) {
+        const double cost = states_[edge.from].cost + edge.distance;
+        // The tree may have improved since the edge was queued.
+        if (!(cost < states_[edge.to].cost)) return;
+        if (cost + states_[edge.to].cost_to_goal_estimate >= cost_best()) return;
+        const std::pair<int, int> key{std::min(edge.from, edge.to), std::max(edge.from, edge.to)};
+        if (colliding_edges_.contains(key)) return;
+        if (!checker_.CheckEdgeCollisionFree(index_.configuration(edge.from), index_.configuration(edge.to))) {
+            colliding_edges_.insert(key);
+            return;
+        }
+
+        State& to = states_[edge.to];
+        if (to.in_tree) {
+            std::vector<int>& siblings = states_[to.parent].children;
+            siblings.erase(std::find(siblings.begin(), siblings.end(), edge.to));
+        }
+        to.in_tree = true;
+        to.parent = edge.from;
+        states_[edge.from].children.push_back(edge.to);
+        UpdateCost(edge.to, cost);
+        if (to.expanded_batch != batch_) PushVertex(edge.to);
+    }
+
+    // Sets the cost of vertex `v` and of its descendants.
+    void UpdateCost(int v, double cost) {
+        const double change = cost - states_[v].cost;
+        states_[v].cost = cost;
+        std::vector<int> descendants(states_[v].children);
+        while (!descendants.empty()) {
+            const int d = descendants.back();
+            descendants.pop_back();
+            states_[d].cost += change;
+            descendants.insert(descendants.end(), states_[d].children.begin(), states_[d].children.end());
+        }
+    }
+
+    const CollisionChecker& checker_;
+    const BitStarParams& params_;
+    const VectorXd& start_;
+    const VectorXd& goal_;
+    RandomGenerator* const generator_;
+    const Parallelism parallelize_;
+
+    // The states, indexed as in `index_`.
+    std::vector<State> states_;
+    ConfigurationSpaceNearestNeighbors index_;
+    // Edges which have been checked and found to be in collision, as
+    // (smaller index, larger index).
+    std::set<std::pair<int, int>> colliding_edges_;
+
+    int batch_{};
+    int k_{};
+    using VertexEntry = std::pair<double, int>;
+    std::priority_queue<VertexEntry, std::vector<VertexEntry>, std::greater<VertexEntry>> vertex_queue_;
+    std::priority_queue<Edge, std::vector<Edge>, std::greater<Edge>> edge_queue_;
+};
+
+}  // namespace
+
+PathPlanningResult PlanBitStar(const CollisionChecker& checker,
+                               const BitStarParams& params,
+                               const VectorXd& start,
+                               const VectorXd& goal,
+                               RandomGenerator* generator,
+                               const Parallelism parallelize) {
+    DRAKE_THROW_UNLESS(generator != nullptr);
+    DRAKE_THROW_UNLESS(params.batch_size >= 1);
+    DRAKE_THROW_UNLESS(params.max_batches >= 0);
+    DRAKE_THROW_UNLESS(params.rewire_factor > 0);
+    DRAKE_THROW_UNLESS(params.max_sampling_attempts_per_sample >= 1);
+    internal::ThrowIfPositionLimitsAreUnbounded(checker, __func__);
+    if (!checker.CheckConfigCollisionFree(start) || !checker.CheckConfigCollisionFree(goal)) {
+        log()->warn("PlanBitStar(): the start or goal is in collision.");
+        return {};
+    }
+    BitStar planner(checker, params, start, goal, generator, parallelize);
+    return planner.Solve();
+}
+
+}  // namespace planning
+}  // namespace drake
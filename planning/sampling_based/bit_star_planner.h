@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Eigen/Core>
+
+#include "common/name_value.h"
+#include "common/parallelism.h"
+#include "common/random.h"
+#include "planning/collision_checker.h"
+#include "planning/sampling_based/path_planning_result.h"
+
+namespace drake {
+namespace planning {
+
+/** Parameters for PlanBitStar(). */
+struct BitStarParams {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(batch_size));
+        a->Visit(DRAKE_NVP(max_batches));
+        a->Visit(DRAKE_NVP(rewire_factor));
+        a->Visit(DRAKE_NVP(max_sampling_attempts_per_sample));
+    }
+
+    /** The number of collision-free samples added in each batch. */
+    int batch_size{100};
+
+    /** The number of batches the planner runs before it returns the best path
+     found. */
+    int max_batches{10};
+
+    /** Scales the number of nearest neighbors each vertex is connected to,
+     k = rewire_factor⋅e⋅(1 + 1/d)⋅log(n), for n samples of a d-dimensional
+     configuration space. Must be positive. */
+    double rewire_factor{1.1};
+
+    /** A batch stops sampling (and the planner stops adding batches) after
+     this many times `batch_size` attempts to sample a configuration that could
+     improve the path. */
+    int max_sampling_attempts_per_sample{100};
+};
+
+/** Plans a path between the configurations `start` and `goal` of `checker`'s
+plant with Batch Informed Trees (BIT*; Gammell, Srinivasa, and Barfoot, 2015),
+an asymptotically optimal planner which searches batches of samples in order of
+their potential solution cost.
+
+Path cost is configuration distance, and the heuristics are the configuration
+distances to the start and to the goal. Edges are checked lazily: only when
+they are the best candidates for improving the tree. Once a path has been
+found, new samples are drawn only from the informed set (the configurations
+whose distance from the start plus distance to the goal is less than the path's
+length), by rejection sampling. Samples that can't improve the path are ignored
+rather than pruned.
+
+The samples of each batch are checked in parallel, as `parallelize` allows.
+
+@returns the best path found, which is empty if none was found.
+@throws std::exception if the plant's position limits are not all finite. */
+PathPlanningResult PlanBitStar(const CollisionChecker& checker,
+                               const BitStarParams& params,
+                               const Eigen::VectorXd& start,
+                               const Eigen::VectorXd& goal,
+                               RandomGenerator* generator,
+                               Parallelism parallelize = Parallelism::Max());
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,173 @@
+#include "planning/sampling_based/configuration_space_nearest_neighbors.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <nanoflann.hpp>
+
+#include "planning/linear_distance_and_interpolation_provider.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+// The smallest number of configurations for which a k-d tree is built.
+constexpr int kMinUnindexed = 64;
+
+// Orders (index, distance) pairs by increasing distance, breaking ties by
+// index so that results don't depend on the order of comparison.
+bool CloserThan(const std::pair<int, double>& a, const std::pair<int, double>& b) {
+    return a.second < b.second || (a.second == b.second && a.first < b.first);
+}
+
+}  // namespace
+
+// A k-d tree over the first `size` weighted configurations. The weighted
+// configurations may be appended to (and reallocated) without invalidating the
+// tree; it only reads them during construction and queries.
+class ConfigurationSpaceNearestNeighbors::KdTree {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(KdTree);
+
+    KdTree(const std::vector<double>* weighted, int dimension, int size)
+        : dataset_(weighted, dimension, size),
+          tree_(dimension, dataset_, nanoflann::KDTreeSingleIndexAdaptorParams(kLeafMaxSize)) {}
+
+    int size() const { return dataset_.size; }
+
+    // Writes the indices and squared distances of the (up to) `k` points
+    // nearest to `query`; returns the number found.
+    int FindNearest(const double* query, int k, uint32_t* indices, double* squared_distances) const {
+        return tree_.knnSearch(query, k, indices, squared_distances);
+    }
+
+    void FindWithinRadius(const double* query,
+                          double squared_radius,
+                          std::vector<nanoflann::ResultItem<uint32_t, double>>* matches) const {
+        tree_.radiusSearch(query, squared_radius, *matches);
+    }
+
+private:
+    struct Dataset {
+        Dataset(const std::vector<double>* weighted_in, int dimension_in, int size_in)
+            : weighted(weighted_in), dimension(dimension_in), size(size_in) {}
+
+        // The interface required by nanoflann.
+        size_t kdtree_get_point_count() const { return size; }
+        double kdtree_get_pt(uint32_t k, size_t dim) const { return (*weighted)[k * dimension + dim]; }
+        template <class BoundingBox>
+        bool kdtree_get_bbox(BoundingBox&) const {
+            return false;
+        }
+
+        const std::vector<double>* const weighted;
+        const int dimension;
+        const int size;
+    };
+
+    using Tree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, Dataset>, Dataset, -1>;
+
+    // The maximum number of points per leaf of the tree; nanoflann's default.
+    static constexpr int kLeafMaxSize = 10;
+
+    // N.B. The tree refers to the dataset, so it must be declared after it.
+    const Dataset dataset_;
+    const Tree tree_;
+};
+
+ConfigurationSpaceNearestNeighbors::ConfigurationSpaceNearestNeighbors(const CollisionChecker& checker)
+    : checker_(checker) {
+    const auto* linear =
+            dynamic_cast<const LinearDistanceAndInterpolationProvider*>(&checker.distance_and_interpolation_provider());
+    if (linear != nullptr && linear->quaternion_dof_start_indices().empty()) {
+        weights_ = linear->distance_weights();
+    }
+}
+
+ConfigurationSpaceNearestNeighbors::~ConfigurationSpaceNearestNeighbors() = default;
+
+int ConfigurationSpaceNearestNeighbors::Add(const Eigen::VectorXd& q) {
+    DRAKE_THROW_UNLESS(q.size() == checker_.plant().num_positions());
+    const int index = size();
+    configurations_.push_back(q);
+    if (uses_kd_tree()) {
+        const Eigen::VectorXd weighted_q = weights_.cwiseProduct(q);
+        weighted_.insert(weighted_.end(), weighted_q.data(), weighted_q.data() + weighted_q.size());
+        const int indexed = kd_tree_ == nullptr ? 0 : kd_tree_->size();
+        const int unindexed = size() - indexed;
+        if (unindexed > std::max<double>(kMinUnindexed, std::sqrt(indexed))) {
+            RebuildKdTree();
+        }
+    }
+    return index;
+}
+
+void ConfigurationSpaceNearestNeighbors::RebuildKdTree() {
+    kd_tree_.reset();
+    kd_tree_ = std::make_unique<KdTree>(&weighted_, static_cast<int>(weights_.size()), size());
+}
+
+std::vector<std::pair<int, double>> ConfigurationSpaceNearestNeighbors::CompareUnindexed(
+        const Eigen::VectorXd& q) const {
+    const int first = kd_tree_ == nullptr ? 0 : kd_tree_->size();
+    std::vector<std::pair<int, double>> result;
+    result.reserve(size() - first);
+    for (int i = first; i < size(); ++i) {
+        result.emplace_back(i, checker_.ComputeConfigurationDistance(q, configurations_[i]));
+    }
+    return result;
+}
+
+int ConfigurationSpaceNearestNeighbors::FindNearest(const Eigen::VectorXd& q) const {
+    const std::vector<int> nearest = FindKNearest(q, 1);
+    return nearest.empty() ? -1 : nearest[0];
+}
+
+std::vector<int> ConfigurationSpaceNearestNeighbors::FindKNearest(const Eigen::VectorXd& q, int k) const {
+    DRAKE_THROW_UNLESS(k >= 0);
+    std::vector<std::pair<int, double>> candidates = CompareUnindexed(q);
+    if (kd_tree_ != nullptr && k > 0) {
+        const Eigen::VectorXd weighted_q = weights_.cwiseProduct(q);
+        std::vector<uint32_t> indices(k);
+        std::vector<double> squared_distances(k);
+        const int num_found = kd_tree_->FindNearest(weighted_q.data(), k, indices.data(), squared_distances.data());
+        for (int j = 0; j < num_found; ++j) {
+            candidates.emplace_back(static_cast<int>(indices[j]), std::sqrt(squared_distances[j]));
+        }
+    }
+    const int num_results = std::min<int>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + num_results, candidates.end(), CloserThan);
+    std::vector<int> result(num_results);
+    for (int j = 0; j < num_results; ++j) {
+        result[j] = candidates[j].first;
+    }
+    return result;
+}
+
+std::vector<int> ConfigurationSpaceNearestNeighbors::FindWithinRadius(const Eigen::VectorXd& q, double radius) const {
+    DRAKE_THROW_UNLESS(radius >= 0);
+    std::vector<std::pair<int, double>> candidates = CompareUnindexed(q);
+    std::erase_if(candidates, [radius](const std::pair<int, double>& c) {
+        return c.second > radius;
+    });
+    if (kd_tree_ != nullptr) {
+        const Eigen::VectorXd weighted_q = weights_.cwiseProduct(q);
+        std::vector<nanoflann::ResultItem<uint32_t, double>> matches;
+        // nanoflann's radius is exclusive; the difference doesn't matter for
+        // sampled configurations.
+        kd_tree_->FindWithinRadius(weighted_q.data(), radius * radius, &matches);
+        for (const auto& match : matches) {
+            candidates.emplace_back(static_cast<int>(match.first), std::sqrt(match.second));
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), CloserThan);
+    std::vector<int> result;
+    result.reserve(candidates.size());
+    for (const auto& candidate : candidates) {
+        result.push_back(candidate.first);
+    }
+    return result;
+}
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/drake_copyable.h"
+#include "planning/collision_checker.h"
+
+namespace drake {
+namespace planning {
+
+/** A nearest-neighbor index over configurations of a CollisionChecker's
+plant, which measures distance the way the checker does (see
+CollisionChecker::ComputeConfigurationDistance()).
+
+When the checker uses a LinearDistanceAndInterpolationProvider and the plant
+has no quaternion-valued positions, configuration distance is a weighted
+Euclidean distance, and the index is a k-d tree over the weighted
+configurations. Configurations added after the tree was last built are compared
+one by one, and the tree is rebuilt once their number exceeds (roughly) the
+square root of the number in the tree. For any other distance, every query
+compares against every configuration.
+
+Configurations may be added at any time. Queries may be made concurrently from
+multiple threads, as long as no configuration is being added.
+
+The index refers to the `checker` it was constructed with, which must outlive
+it. */
+class ConfigurationSpaceNearestNeighbors {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ConfigurationSpaceNearestNeighbors);
+
+    /** Constructs an empty index for configurations of `checker`'s plant. */
+    explicit ConfigurationSpaceNearestNeighbors(const CollisionChecker& checker);
+
+    ~ConfigurationSpaceNearestNeighbors();
+
+    /** Returns the number of configurations in the index. */
+    int size() const { return static_cast<int>(configurations_.size()); }
+
+    /** Returns the configuration with the given `index`. */
+    const Eigen::VectorXd& configuration(int index) const { return configurations_.at(index); }
+
+    /** Reports whether queries use a k-d tree (rather than comparing against
+     every configuration). */
+    bool uses_kd_tree() const { return weights_.size() > 0; }
+
+    /** Adds the configuration `q` to the index.
+     @returns the index of `q`, which is size() prior to the call.
+     @pre q.size() equals the number of positions in the plant. */
+    int Add(const Eigen::VectorXd& q);
+
+    /** Returns the index of the configuration nearest to `q`, or -1 if the
+     index is empty. */
+    int FindNearest(const Eigen::VectorXd& q) const;
+
+    /** Returns the indices of the (up to) `k` configurations nearest to `q`,
+     in order of increasing distance. */
+    std::vector<int> FindKNearest(const Eigen::VectorXd& q, int k) const;
+
+    /** Returns the indices of the configurations whose distance to `q` is at
+     most `radius`, in order of increasing distance. */
+    std::vector<int> FindWithinRadius(const Eigen::VectorXd& q, double radius) const;
+
+private:
+    class KdTree;
+
+    // Rebuilds the k-d tree over all of the configurations.
+    void RebuildKdTree();
+
+    // Reports the (index, distance) of every configuration which wasn't in
+    // the k-d tree when it was last built, or of every configuration if there
+    // is no tree.
+    std::vector<std::pair<int, double>> CompareUnindexed(const Eigen::VectorXd& q) const;
+
+    const CollisionChecker& checker_;
+    std::vector<Eigen::VectorXd> configurations_;
+
+    // The distance weights of the checker's LinearDistanceAndInterpolationProvider,
+    // or empty if the index doesn't use a k-d tree.
+    Eigen::VectorXd weights_;
+    // The weighted configurations (w ⊙ q), concatenated, whose Euclidean
+    // distances are the configuration distances.
+    std::vector<double> weighted_;
+    // The tree over the first `kd_tree_->size()` configurations, or null.
+    std::unique_ptr<KdTree> kd_tree_;
+};
+
+}  // namespace planning
+}  // namespace drake
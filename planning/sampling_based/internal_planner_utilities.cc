@@ -0,0 +1,56 @@
+#include "planning/sampling_based/internal_planner_utilities.h"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+void ThrowIfPositionLimitsAreUnbounded(const CollisionChecker& checker, const char* func) {
+    const Eigen::VectorXd& lower = checker.plant().GetPositionLowerLimits();
+    const Eigen::VectorXd& upper = checker.plant().GetPositionUpperLimits();
+    if (!lower.allFinite() || !upper.allFinite()) {
+        throw std::logic_error(
+                fmt::format("{}(): configurations are sampled uniformly within the plant's position limits, so they "
+                            "must all be finite.",
+                            func));
+    }
+}
+
+Eigen::VectorXd SampleUniformConfiguration(const CollisionChecker& checker, RandomGenerator* generator) {
+    DRAKE_DEMAND(generator != nullptr);
+    const Eigen::VectorXd& lower = checker.plant().GetPositionLowerLimits();
+    const Eigen::VectorXd& upper = checker.plant().GetPositionUpperLimits();
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    Eigen::VectorXd q(lower.size());
+    for (int i = 0; i < q.size(); ++i) {
+        q[i] = lower[i] + uniform(*generator) * (upper[i] - lower[i]);
+    }
+    return q;
+}
+
+int GetNumberOfPlanningThreads(const CollisionChecker& checker, Parallelism parallelize) {
+    return checker.SupportsParallelChecking() ? std::min(parallelize.num_threads(), checker.num_allocated_contexts())
+                                              : 1;
+}
+
+PathPlanningResult MakePathPlanningResult(const CollisionChecker& checker, std::vector<Eigen::VectorXd> path) {
+    PathPlanningResult result;
+    if (!path.empty()) {
+        result.path_length = 0;
+        for (int i = 1; i < static_cast<int>(path.size()); ++i) {
+            result.path_length += checker.ComputeConfigurationDistance(path[i - 1], path[i]);
+        }
+        result.path = std::move(path);
+    }
+    return result;
+}
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/parallelism.h"
+#include "common/random.h"
+#include "planning/collision_checker.h"
+#include "planning/sampling_based/path_planning_result.h"
+
+namespace drake {
+namespace planning {
+namespace internal {
+
+/* Throws if any of the positions of `checker`'s plant has an infinite lower or
+ upper limit, so that configurations can't be sampled uniformly. `func` names
+ the calling function in the message. */
+void ThrowIfPositionLimitsAreUnbounded(const CollisionChecker& checker, const char* func);
+
+/* Samples a configuration uniformly within the position limits of `checker`'s
+ plant.
+ @pre The limits are bounded (see ThrowIfPositionLimitsAreUnbounded()). */
+Eigen::VectorXd SampleUniformConfiguration(const CollisionChecker& checker, RandomGenerator* generator);
+
+/* Returns the number of threads to use for edge checks with the per-thread
+ contexts of `checker`; VisibilityGraph() makes the same choice. */
+int GetNumberOfPlanningThreads(const CollisionChecker& checker, Parallelism parallelize);
+
+/* Makes the result for the given `path` (which may be empty), computing its
+ length with the checker's configuration distance. */
+PathPlanningResult MakePathPlanningResult(const CollisionChecker& checker, std::vector<Eigen::VectorXd> path);
+
+}  // namespace internal
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace drake {
+namespace planning {
+
+/** The result of a path planning query. */
+struct PathPlanningResult {
+    /** Reports whether a path was found. */
+    bool has_solution() const { return !path.empty(); }
+
+    /** The configurations of the path, from start to goal, with each
+     consecutive pair joined by a collision-free edge. Empty if no path was
+     found. */
+    std::vector<Eigen::VectorXd> path;
+
+    /** The sum of the configuration distances between consecutive
+     configurations of the path, or infinity if no path was found. */
+    double path_length{std::numeric_limits<double>::infinity()};
+};
+
+}  // namespace planning
+}  // namespace drake
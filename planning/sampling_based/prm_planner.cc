@@ -0,0 +1,287 @@
+#include "planning/sampling_based/prm_planner.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include <common_robotics_utilities/parallelism.hpp>
+#include <fmt/format.h>
+
+#include "common/text_logging.h"
+#include "planning/sampling_based/configuration_space_nearest_neighbors.h"
+#include "planning/sampling_based/internal_planner_utilities.h"
+
+namespace drake {
+namespace planning {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::VectorXd;
+
+namespace {
+
+// Checks the edges between the given pairs of configurations using the
+// checker's per-thread contexts. Reports 1 for each collision-free edge and 0
+// for each edge in collision.
+std::vector<uint8_t> CheckEdges(const CollisionChecker& checker,
+                                const std::vector<std::pair<const VectorXd*, const VectorXd*>>& edges,
+                                Parallelism parallelize) {
+    std::vector<uint8_t> edges_free(edges.size(), 0x00);
+    const auto edge_check_work = [&](const int thread_num, const int64_t e) {
+        edges_free[e] =
+                static_cast<uint8_t>(checker.CheckEdgeCollisionFree(*edges[e].first, *edges[e].second, thread_num));
+    };
+    DynamicParallelForIndexLoop(DegreeOfParallelism(internal::GetNumberOfPlanningThreads(checker, parallelize)), 0,
+                                ssize(edges), edge_check_work, ParallelForBackend::BEST_AVAILABLE);
+    return edges_free;
+}
+
+}  // namespace
+
+void GrowRoadmap(const CollisionChecker& checker,
+                 const PrmParams& params,
+                 RandomGenerator* generator,
+                 Roadmap* roadmap,
+                 const Parallelism parallelize) {
+    DRAKE_THROW_UNLESS(generator != nullptr);
+    DRAKE_THROW_UNLESS(roadmap != nullptr);
+    DRAKE_THROW_UNLESS(params.num_samples >= 0);
+    DRAKE_THROW_UNLESS(params.num_neighbors >= 0);
+    DRAKE_THROW_UNLESS(params.max_sampling_attempts_per_sample >= 1);
+    internal::ThrowIfPositionLimitsAreUnbounded(checker, __func__);
+    const int num_positions = checker.plant().num_positions();
+    if (roadmap->num_nodes() > 0 && roadmap->node(0).size() != num_positions) {
+        throw std::logic_error(fmt::format("GrowRoadmap(): the roadmap's nodes have {} positions; the plant has {}.",
+                                           roadmap->node(0).size(), num_positions));
+    }
+
+    // Sample collision-free configurations. The samples are drawn serially (so
+    // that they only depend on the generator) and checked in batches.
+    std::vector<VectorXd> samples;
+    samples.reserve(params.num_samples);
+    const int64_t max_attempts = static_cast<int64_t>(params.max_sampling_attempts_per_sample) * params.num_samples;
+    int64_t attempts = 0;
+    while (ssize(samples) < params.num_samples && attempts < max_attempts) {
+        const int64_t batch_size =
+                std::min<int64_t>(max_attempts - attempts, 2 * (params.num_samples - ssize(samples)));
+        std::vector<VectorXd> candidates;
+        candidates.reserve(batch_size);
+        for (int64_t i = 0; i < batch_size; ++i) {
+            candidates.push_back(internal::SampleUniformConfiguration(checker, generator));
+        }
+        const std::vector<uint8_t> candidates_free = checker.CheckConfigsCollisionFree(candidates, parallelize);
+        for (int64_t i = 0; i < batch_size && ssize(samples) < params.num_samples; ++i) {
+            if (candidates_free[i] > 0) {
+                samples.push_back(std::move(candidates[i]));
+            }
+        }
+        attempts += batch_size;
+    }
+    if (ssize(samples) < params.num_samples) {
+        log()->warn("GrowRoadmap(): found only {} collision-free configurations in {} attempts; {} were requested.",
+                    ssize(samples), attempts, params.num_samples);
+    }
+
+    ConfigurationSpaceNearestNeighbors index(checker);
+    for (int i = 0; i < roadmap->num_nodes(); ++i) {
+        index.Add(roadmap->node(i));
+    }
+    const int first_new = roadmap->num_nodes();
+    for (const VectorXd& q : samples) {
+        roadmap->AddNode(q);
+        index.Add(q);
+    }
+    const int num_new = ssize(samples);
+
+    // Find each new node's neighbors in parallel; the index supports
+    // concurrent queries.
+    const int num_threads = internal::GetNumberOfPlanningThreads(checker, parallelize);
+    std::vector<std::vector<int>> neighbors(num_new);
+    const auto neighbor_work = [&](const int, const int64_t k) {
+        // The nearest node is the node itself.
+        neighbors[k] = index.FindKNearest(roadmap->node(first_new + k), params.num_neighbors + 1);
+    };
+    StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_new, neighbor_work,
+                               ParallelForBackend::BEST_AVAILABLE);
+
+    // Edges are undirected; two new nodes may be each other's neighbors.
+    std::vector<std::pair<int, int>> candidate_edges;
+    for (int k = 0; k < num_new; ++k) {
+        const int i = first_new + k;
+        for (const int j : neighbors[k]) {
+            if (j != i) candidate_edges.emplace_back(std::min(i, j), std::max(i, j));
+        }
+    }
+    std::sort(candidate_edges.begin(), candidate_edges.end());
+    candidate_edges.erase(std::unique(candidate_edges.begin(), candidate_edges.end()), candidate_edges.end());
+
+    std::vector<uint8_t> edges_free;
+    if (!params.lazy) {
+        std::vector<std::pair<const VectorXd*, const VectorXd*>> edges;
+        edges.reserve(candidate_edges.size());
+        for (const auto& [i, j] : candidate_edges) {
+            edges.emplace_back(&roadmap->node(i), &roadmap->node(j));
+        }
+        edges_free = CheckEdges(checker, edges, parallelize);
+    }
+    for (int e = 0; e < ssize(candidate_edges); ++e) {
+        if (!params.lazy && edges_free[e] == 0) continue;
+        const auto [i, j] = candidate_edges[e];
+        RoadmapEdge edge;
+        edge.i = i;
+        edge.j = j;
+        edge.distance = checker.ComputeConfigurationDistance(roadmap->node(i), roadmap->node(j));
+        if (!params.lazy) edge.collision_free = true;
+        roadmap->AddEdge(edge);
+    }
+}
+
+PathPlanningResult QueryRoadmapPath(const CollisionChecker& checker,
+                                    const PrmParams& params,
+                                    const std::vector<VectorXd>& starts,
+                                    const std::vector<VectorXd>& goals,
+                                    Roadmap* roadmap,
+                                    const Parallelism parallelize) {
+    DRAKE_THROW_UNLESS(roadmap != nullptr);
+    DRAKE_THROW_UNLESS(params.num_neighbors >= 0);
+    if (starts.empty() || goals.empty()) return {};
+
+    // The search graph's vertices are the roadmap's nodes, followed by the
+    // starts, followed by the goals.
+    const int num_nodes = roadmap->num_nodes();
+    const int num_starts = ssize(starts);
+    const int num_goals = ssize(goals);
+    const int first_goal = num_nodes + num_starts;
+    const int num_vertices = first_goal + num_goals;
+    const auto configuration = [&](int v) -> const VectorXd& {
+        if (v < num_nodes) return roadmap->node(v);
+        if (v < first_goal) return starts[v - num_nodes];
+        return goals[v - first_goal];
+    };
+
+    // Connect the starts and goals to the roadmap, and the starts to the goals.
+    ConfigurationSpaceNearestNeighbors index(checker);
+    for (int i = 0; i < num_nodes; ++i) {
+        index.Add(roadmap->node(i));
+    }
+    std::vector<std::pair<int, int>> candidate_connections;
+    for (int v = num_nodes; v < num_vertices; ++v) {
+        for (const int i : index.FindKNearest(configuration(v), params.num_neighbors)) {
+            // Connections run from starts and to goals.
+            if (v < first_goal) {
+                candidate_connections.emplace_back(v, i);
+            } else {
+                candidate_connections.emplace_back(i, v);
+            }
+        }
+    }
+    for (int s = num_nodes; s < first_goal; ++s) {
+        for (int g = first_goal; g < num_vertices; ++g) {
+            candidate_connections.emplace_back(s, g);
+        }
+    }
+    std::vector<std::pair<const VectorXd*, const VectorXd*>> connection_edges;
+    for (const auto& [a, b] : candidate_connections) {
+        connection_edges.emplace_back(&configuration(a), &configuration(b));
+    }
+    const std::vector<uint8_t> connections_free = CheckEdges(checker, connection_edges, parallelize);
+    // The connections out of each vertex, as (vertex, distance).
+    std::vector<std::vector<std::pair<int, double>>> connections(num_vertices);
+    for (int c = 0; c < ssize(candidate_connections); ++c) {
+        if (connections_free[c] == 0) continue;
+        const auto [a, b] = candidate_connections[c];
+        connections[a].emplace_back(b, checker.ComputeConfigurationDistance(configuration(a), configuration(b)));
+    }
+
+    // The distance from each vertex to the nearest goal, computed on demand.
+    std::vector<double> heuristic(num_vertices, -1.0);
+    const auto h = [&](int v) {
+        if (heuristic[v] < 0) {
+            double nearest = std::numeric_limits<double>::infinity();
+            for (const VectorXd& goal : goals) {
+                nearest = std::min(nearest, checker.ComputeConfigurationDistance(configuration(v), goal));
+            }
+            heuristic[v] = nearest;
+        }
+        return heuristic[v];
+    };
+
+    while (true) {
+        std::vector<double> cost(num_vertices, std::numeric_limits<double>::infinity());
+        // The vertex each vertex was reached from, and the roadmap edge it was
+        // reached by (or -1 for a connection).
+        std::vector<int> parent(num_vertices, -1);
+        std::vector<int> parent_edge(num_vertices, -1);
+        std::vector<bool> closed(num_vertices, false);
+        using Entry = std::pair<double, int>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        for (int s = num_nodes; s < first_goal; ++s) {
+            cost[s] = 0;
+            open.emplace(h(s), s);
+        }
+        int reached_goal = -1;
+        while (!open.empty()) {
+            const int v = open.top().second;
+            open.pop();
+            if (closed[v]) continue;
+            closed[v] = true;
+            if (v >= first_goal) {
+                reached_goal = v;
+                break;
+            }
+            const auto relax = [&](int w, double distance, int edge) {
+                if (cost[v] + distance < cost[w]) {
+                    cost[w] = cost[v] + distance;
+                    parent[w] = v;
+                    parent_edge[w] = edge;
+                    open.emplace(cost[w] + h(w), w);
+                }
+            };
+            if (v < num_nodes) {
+                for (const int e : roadmap->incident_edges(v)) {
+                    const RoadmapEdge& edge = roadmap->edge(e);
+                    if (edge.collision_free.has_value() && !*edge.collision_free) continue;
+                    relax(roadmap->opposite(e, v), edge.distance, e);
+                }
+            }
+            for (const auto& [w, distance] : connections[v]) {
+                relax(w, distance, -1);
+            }
+        }
+        if (reached_goal < 0) return {};
+
+        std::vector<int> vertices;
+        std::vector<int> unchecked_edges;
+        for (int v = reached_goal; v >= 0; v = parent[v]) {
+            vertices.push_back(v);
+            const int e = parent_edge[v];
+            if (e >= 0 && !roadmap->edge(e).collision_free.has_value()) {
+                unchecked_edges.push_back(e);
+            }
+        }
+        if (unchecked_edges.empty()) {
+            std::vector<VectorXd> path;
+            for (auto v = vertices.rbegin(); v != vertices.rend(); ++v) {
+                path.push_back(configuration(*v));
+            }
+            return internal::MakePathPlanningResult(checker, std::move(path));
+        }
+
+        std::vector<std::pair<const VectorXd*, const VectorXd*>> edges;
+        for (const int e : unchecked_edges) {
+            edges.emplace_back(&roadmap->node(roadmap->edge(e).i), &roadmap->node(roadmap->edge(e).j));
+        }
+        const std::vector<uint8_t> edges_free = CheckEdges(checker, edges, parallelize);
+        for (int k = 0; k < ssize(unchecked_edges); ++k) {
+            roadmap->SetEdgeCollisionFree(unchecked_edges[k], edges_free[k] > 0);
+        }
+    }
+}
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/name_value.h"
+#include "common/parallelism.h"
+#include "common/random.h"
+#include "planning/collision_checker.h"
+#include "planning/sampling_based/path_planning_result.h"
+#include "planning/sampling_based/roadmap.h"
+
+namespace drake {
+namespace planning {
+
+/** Parameters for building and querying a probabilistic roadmap (PRM). */
+struct PrmParams {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(num_samples));
+        a->Visit(DRAKE_NVP(num_neighbors));
+        a->Visit(DRAKE_NVP(lazy));
+        a->Visit(DRAKE_NVP(max_sampling_attempts_per_sample));
+    }
+
+    /** The number of (collision-free) nodes GrowRoadmap() adds. */
+    int num_samples{1000};
+
+    /** The number of nearest nodes each new node (and each start and goal of a
+     query) is connected to. */
+    int num_neighbors{10};
+
+    /** If true, GrowRoadmap() adds edges without checking them, and
+     QueryRoadmapPath() checks only the edges of the paths it considers,
+     recording the results in the roadmap. This is usually much faster for
+     roadmaps that serve few queries. */
+    bool lazy{false};
+
+    /** GrowRoadmap() stops (with a warning) if it has sampled this many times
+     `num_samples` configurations without finding `num_samples` collision-free
+     ones. */
+    int max_sampling_attempts_per_sample{100};
+};
+
+/** Grows `roadmap` by params.num_samples collision-free configurations of
+`checker`'s plant, sampled uniformly within its position limits, and connects
+each new node to its params.num_neighbors nearest nodes (old or new).
+
+The samples are checked in parallel, and (unless params.lazy is true) so are
+the new edges, using the checker's per-thread contexts; only collision-free
+edges are added. Growing an empty roadmap builds one, and growing an existing
+one (e.g., one loaded with Roadmap::Load()) refines it.
+
+@param parallelize How much should the collision checks be parallelized?
+@throws std::exception if the plant's position limits are not all finite, or
+if the roadmap's nodes have a different number of positions than the plant. */
+void GrowRoadmap(const CollisionChecker& checker,
+                 const PrmParams& params,
+                 RandomGenerator* generator,
+                 Roadmap* roadmap,
+                 Parallelism parallelize = Parallelism::Max());
+
+/** Finds the shortest path through `roadmap` from any of the `starts` to any
+of the `goals`. Each start and goal is connected to its params.num_neighbors
+nearest nodes (and the starts to the goals) by collision-free edges; these
+connections are not added to the roadmap.
+
+The search is A*, with the configuration distance to the nearest goal as its
+heuristic. Edges known to be in collision are skipped. If the path found
+contains unchecked edges (see PrmParams::lazy), they are checked (in parallel),
+their results are recorded in `roadmap`, and the search is repeated until a
+path of collision-free edges is found or none remains.
+
+@param parallelize How much should the collision checks be parallelized?
+@returns the path, which is empty if the starts and goals aren't connected. */
+PathPlanningResult QueryRoadmapPath(const CollisionChecker& checker,
+                                    const PrmParams& params,
+                                    const std::vector<Eigen::VectorXd>& starts,
+                                    const std::vector<Eigen::VectorXd>& goals,
+                                    Roadmap* roadmap,
+                                    Parallelism parallelize = Parallelism::Max());
+
+}  // namespace planning
+}  // namespace drake
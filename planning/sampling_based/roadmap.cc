@@ -0,0 +1,79 @@
+#include "planning/sampling_based/roadmap.h"
+
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include "common/drake_assert.h"
+#include "common/yaml/yaml_io.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+// The contents of a roadmap file.
+struct RoadmapData {
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(nodes));
+        a->Visit(DRAKE_NVP(edges));
+    }
+
+    std::vector<Eigen::VectorXd> nodes;
+    std::vector<RoadmapEdge> edges;
+};
+
+}  // namespace
+
+int Roadmap::opposite(int edge_index, int node_index) const {
+    const RoadmapEdge& e = edges_.at(edge_index);
+    DRAKE_DEMAND(e.i == node_index || e.j == node_index);
+    return e.i == node_index ? e.j : e.i;
+}
+
+int Roadmap::AddNode(const Eigen::VectorXd& q) {
+    if (!nodes_.empty() && q.size() != nodes_[0].size()) {
+        throw std::logic_error(fmt::format("Roadmap::AddNode(): the configuration has {} positions; the roadmap's "
+                                           "nodes have {}.",
+                                           q.size(), nodes_[0].size()));
+    }
+    nodes_.push_back(q);
+    incident_edges_.emplace_back();
+    return num_nodes() - 1;
+}
+
+int Roadmap::AddEdge(const RoadmapEdge& edge) {
+    if (edge.i < 0 || edge.i >= num_nodes() || edge.j < 0 || edge.j >= num_nodes() || edge.i == edge.j) {
+        throw std::logic_error(fmt::format("Roadmap::AddEdge(): invalid edge ({}, {}) for a roadmap with {} nodes.",
+                                           edge.i, edge.j, num_nodes()));
+    }
+    const int index = num_edges();
+    edges_.push_back(edge);
+    incident_edges_[edge.i].push_back(index);
+    incident_edges_[edge.j].push_back(index);
+    return index;
+}
+
+void Roadmap::SetEdgeCollisionFree(int index, bool collision_free) {
+    edges_.at(index).collision_free = collision_free;
+}
+
+void Roadmap::Save(const std::filesystem::path& filename) const {
+    yaml::SaveYamlFile(filename.string(), RoadmapData{.nodes = nodes_, .edges = edges_});
+}
+
+Roadmap Roadmap::Load(const std::filesystem::path& filename) {
+    const auto data = yaml::LoadYamlFile<RoadmapData>(filename.string());
+    Roadmap result;
+    for (const Eigen::VectorXd& q : data.nodes) {
+        result.AddNode(q);
+    }
+    for (const RoadmapEdge& edge : data.edges) {
+        result.AddEdge(edge);
+    }
+    return result;
+}
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/drake_copyable.h"
+#include "common/name_value.h"
+
+namespace drake {
+namespace planning {
+
+/** An undirected edge of a Roadmap. */
+struct RoadmapEdge {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(i));
+        a->Visit(DRAKE_NVP(j));
+        a->Visit(DRAKE_NVP(distance));
+        a->Visit(DRAKE_NVP(collision_free));
+    }
+
+    /** The indices of the nodes the edge connects. */
+    int i{};
+    int j{};
+
+    /** The configuration distance between the nodes. */
+    double distance{};
+
+    /** Whether the edge has been checked and found to be collision free (true)
+     or in collision (false). Edges of a lazily built roadmap are unchecked
+     (std::nullopt) until a query needs them. */
+    std::optional<bool> collision_free;
+};
+
+/** A graph of configurations (nodes) connected by edges, for answering
+multiple path queries in the same environment. Roadmaps are built and queried
+with the functions in prm_planner.h.
+
+A roadmap can be saved to a file and loaded again, so that the work of
+building it (and of checking its edges) can be reused across processes. It
+records only configurations, not the environment they were checked in; loading
+a roadmap for an environment that has changed is the caller's responsibility.
+*/
+class Roadmap {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Roadmap);
+
+    /** Constructs an empty roadmap. */
+    Roadmap() = default;
+
+    /** Returns the number of nodes. */
+    int num_nodes() const { return static_cast<int>(nodes_.size()); }
+
+    /** Returns the number of edges. */
+    int num_edges() const { return static_cast<int>(edges_.size()); }
+
+    /** Returns the configuration of the node with the given `index`. */
+    const Eigen::VectorXd& node(int index) const { return nodes_.at(index); }
+
+    /** Returns the edge with the given `index`. */
+    const RoadmapEdge& edge(int index) const { return edges_.at(index); }
+
+    /** Returns the indices of the edges incident to the node with the given
+     `index`. */
+    const std::vector<int>& incident_edges(int index) const { return incident_edges_.at(index); }
+
+    /** Returns the index of the node at the other end of the edge with index
+     `edge_index` from the node with index `node_index`.
+     @pre The edge is incident to the node. */
+    int opposite(int edge_index, int node_index) const;
+
+    /** Adds a node with configuration `q`.
+     @returns the index of the new node, which is num_nodes() prior to the call.
+     @throws std::exception if `q` doesn't have the same size as the nodes
+     already in the roadmap. */
+    int AddNode(const Eigen::VectorXd& q);
+
+    /** Adds the edge `edge`.
+     @returns the index of the new edge, which is num_edges() prior to the call.
+     @throws std::exception if either of its node indices isn't the index of a
+     node, or if they are equal. */
+    int AddEdge(const RoadmapEdge& edge);
+
+    /** Records the result of checking the edge with the given `index`. */
+    void SetEdgeCollisionFree(int index, bool collision_free);
+
+    /** Saves the roadmap to the YAML file at `filename`. */
+    void Save(const std::filesystem::path& filename) const;
+
+    /** Loads a roadmap saved by Save() from the file at `filename`.
+     @throws std::exception if the file can't be parsed or doesn't describe a
+     valid roadmap. */
+    static Roadmap Load(const std::filesystem::path& filename);
+
+private:
+    std::vector<Eigen::VectorXd> nodes_;
+    std::vector<RoadmapEdge> edges_;
+    // For each node, the indices of its incident edges.
+    std::vector<std::vector<int>> incident_edges_;
+};
+
+}  // namespace planning
+}  // namespace drake
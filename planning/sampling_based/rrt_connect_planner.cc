@@ -0,0 +1,165 @@
+#include "planning/sampling_based/rrt_connect_planner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include <common_robotics_utilities/parallelism.hpp>
+
+#include "common/text_logging.h"
+#include "planning/sampling_based/configuration_space_nearest_neighbors.h"
+#include "planning/sampling_based/internal_planner_utilities.h"
+
+namespace drake {
+namespace planning {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::VectorXd;
+
+namespace {
+
+// A tree of configurations grown from a root (the start or the goal).
+class Tree {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Tree);
+
+    Tree(const CollisionChecker& checker, const VectorXd& root) : index_(checker) { Add(root, -1); }
+
+    int Add(const VectorXd& q, int parent) {
+        parents_.push_back(parent);
+        return index_.Add(q);
+    }
+
+    const VectorXd& configuration(int node) const { return index_.configuration(node); }
+
+    int FindNearest(const VectorXd& q) const { return index_.FindNearest(q); }
+
+    // Returns the configurations from the given node back to the root.
+    std::vector<VectorXd> PathToRoot(int node) const {
+        std::vector<VectorXd> path;
+        for (; node >= 0; node = parents_[node]) {
+            path.push_back(configuration(node));
+        }
+        return path;
+    }
+
+private:
+    ConfigurationSpaceNearestNeighbors index_;
+    std::vector<int> parents_;
+};
+
+enum class ExtendResult { kTrapped, kAdvanced, kReached };
+
+// Grows `tree` from its node nearest to `target` toward `target`, by at most
+// params.extend_distance. On success, sets `new_node` to the node that was
+// added (or to the node already at `target`).
+ExtendResult Extend(const CollisionChecker& checker,
+                    const RrtConnectParams& params,
+                    const VectorXd& target,
+                    int context_number,
+                    Tree* tree,
+                    int* new_node) {
+    const int nearest = tree->FindNearest(target);
+    const VectorXd& q_near = tree->configuration(nearest);
+    const double distance = checker.ComputeConfigurationDistance(q_near, target);
+    if (distance == 0) {
+        *new_node = nearest;
+        return ExtendResult::kReached;
+    }
+    const bool reaches = distance <= params.extend_distance;
+    const VectorXd q_new = reaches ? target
+                                   : checker.InterpolateBetweenConfigurations(q_near, target,
+                                                                              params.extend_distance / distance);
+    if (!checker.CheckEdgeCollisionFree(q_near, q_new, context_number)) {
+        return ExtendResult::kTrapped;
+    }
+    *new_node = tree->Add(q_new, nearest);
+    return reaches ? ExtendResult::kReached : ExtendResult::kAdvanced;
+}
+
+// Runs one attempt; returns an empty path if it fails or is stopped.
+std::vector<VectorXd> RunAttempt(const CollisionChecker& checker,
+                                 const RrtConnectParams& params,
+                                 const VectorXd& start,
+                                 const VectorXd& goal,
+                                 RandomGenerator* generator,
+                                 int context_number,
+                                 const std::atomic<bool>& stop) {
+    Tree start_tree(checker, start);
+    Tree goal_tree(checker, goal);
+    Tree* tree_a = &start_tree;
+    Tree* tree_b = &goal_tree;
+    for (int iteration = 0; iteration < params.max_iterations && !stop; ++iteration) {
+        const VectorXd q_sample = internal::SampleUniformConfiguration(checker, generator);
+        int node_a{};
+        if (Extend(checker, params, q_sample, context_number, tree_a, &node_a) != ExtendResult::kTrapped) {
+            // Greedily connect the other tree to the new node.
+            const VectorXd& q_a = tree_a->configuration(node_a);
+            int node_b{};
+            ExtendResult result;
+            do {
+                result = Extend(checker, params, q_a, context_number, tree_b, &node_b);
+            } while (result == ExtendResult::kAdvanced);
+            if (result == ExtendResult::kReached) {
+                const bool a_is_start = tree_a == &start_tree;
+                std::vector<VectorXd> path = (a_is_start ? tree_a : tree_b)->PathToRoot(a_is_start ? node_a : node_b);
+                std::reverse(path.begin(), path.end());
+                // The trees meet at the same configuration; don't repeat it.
+                std::vector<VectorXd> to_goal =
+                        (a_is_start ? tree_b : tree_a)->PathToRoot(a_is_start ? node_b : node_a);
+                path.insert(path.end(), std::make_move_iterator(to_goal.begin() + 1),
+                            std::make_move_iterator(to_goal.end()));
+                return path;
+            }
+        }
+        std::swap(tree_a, tree_b);
+    }
+    return {};
+}
+
+}  // namespace
+
+PathPlanningResult PlanRrtConnect(const CollisionChecker& checker,
+                                  const RrtConnectParams& params,
+                                  const VectorXd& start,
+                                  const VectorXd& goal,
+                                  RandomGenerator* generator,
+                                  const Parallelism parallelize) {
+    DRAKE_THROW_UNLESS(generator != nullptr);
+    DRAKE_THROW_UNLESS(params.extend_distance > 0);
+    DRAKE_THROW_UNLESS(params.max_iterations >= 0);
+    internal::ThrowIfPositionLimitsAreUnbounded(checker, __func__);
+    if (!checker.CheckConfigCollisionFree(start) || !checker.CheckConfigCollisionFree(goal)) {
+        log()->warn("PlanRrtConnect(): the start or goal is in collision.");
+        return {};
+    }
+
+    const int num_threads = internal::GetNumberOfPlanningThreads(checker, parallelize);
+    // A single attempt uses the caller's generator directly.
+    std::vector<RandomGenerator> generators;
+    for (int i = 0; num_threads > 1 && i < num_threads; ++i) {
+        generators.emplace_back((*generator)());
+    }
+    std::vector<std::vector<VectorXd>> paths(num_threads);
+    std::atomic<bool> solved{false};
+    const auto attempt_work = [&](const int thread_num, const int64_t attempt) {
+        RandomGenerator* attempt_generator = num_threads > 1 ? &generators[attempt] : generator;
+        paths[attempt] = RunAttempt(checker, params, start, goal, attempt_generator, thread_num, solved);
+        if (!paths[attempt].empty()) solved = true;
+    };
+    StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, num_threads, attempt_work,
+                               ParallelForBackend::BEST_AVAILABLE);
+
+    PathPlanningResult best;
+    for (std::vector<VectorXd>& path : paths) {
+        PathPlanningResult result = internal::MakePathPlanningResult(checker, std::move(path));
+        if (result.path_length < best.path_length) best = std::move(result);
+    }
+    return best;
+}
+
+}  // namespace planning
+}  // namespace drake
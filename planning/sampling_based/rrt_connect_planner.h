@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Eigen/Core>
+
+#include "common/name_value.h"
+#include "common/parallelism.h"
+#include "common/random.h"
+#include "planning/collision_checker.h"
+#include "planning/sampling_based/path_planning_result.h"
+
+namespace drake {
+namespace planning {
+
+/** Parameters for PlanRrtConnect(). */
+struct RrtConnectParams {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(extend_distance));
+        a->Visit(DRAKE_NVP(max_iterations));
+    }
+
+    /** The largest configuration distance a tree is extended by in one step.
+     Must be positive. */
+    double extend_distance{0.25};
+
+    /** The number of samples each attempt draws before it gives up. */
+    int max_iterations{10000};
+};
+
+/** Plans a path between the configurations `start` and `goal` of `checker`'s
+plant with RRT-Connect (Kuffner and LaValle, 2000): trees are grown from both
+ends toward uniformly sampled configurations, each tree greedily trying to
+connect to the other's newest node, until they meet.
+
+When `parallelize` specifies more than one thread, that many independent
+attempts run concurrently (each with a generator seeded from `generator` and
+its own per-thread context of the checker). They all stop once any of them
+has found a path, and the shortest path found is returned. Each attempt's
+nearest-neighbor queries use a ConfigurationSpaceNearestNeighbors.
+
+The path is not shortened; its configurations are spaced by at most
+params.extend_distance.
+
+@returns the path, which is empty if none was found within
+params.max_iterations (by any attempt).
+@throws std::exception if the plant's position limits are not all finite. */
+PathPlanningResult PlanRrtConnect(const CollisionChecker& checker,
+                                  const RrtConnectParams& params,
+                                  const Eigen::VectorXd& start,
+                                  const Eigen::VectorXd& goal,
+                                  RandomGenerator* generator,
+                                  Parallelism parallelize = Parallelism::None());
+
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,890 @@
+#include "planning/sphere_grid_collision_checker.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <common_robotics_utilities/parallelism.hpp>
+#include <fmt/format.h>
+
+#include "common/overloaded.h"
+#include "geometry/proximity/polygon_surface_mesh.h"
+#include "geometry/scene_graph.h"
+#include "multibody/plant/multibody_plant.h"
+#include "multibody/tree/prismatic_joint.h"
+#include "multibody/tree/revolute_joint.h"
+#include "multibody/tree/weld_joint.h"
+#include "planning/robot_diagram.h"
+
+namespace drake {
+namespace planning {
+
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+using Eigen::Matrix3d;
+using Eigen::Matrix3Xd;
+using Eigen::Matrix4Xd;
+using Eigen::RowVectorXd;
+using Eigen::Vector3d;
+using Eigen::Vector4d;
+using Eigen::VectorXd;
+using geometry::GeometryId;
+using geometry::PolygonSurfaceMesh;
+using geometry::QueryObject;
+using geometry::SceneGraphInspector;
+using geometry::Shape;
+using geometry::SignedDistanceToPoint;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using multibody::BodyIndex;
+using multibody::Frame;
+using multibody::Joint;
+using multibody::JointIndex;
+using multibody::RigidBody;
+
+namespace {
+
+// The per-thread poses computed by SphereGridCollisionChecker.
+class SphereGridCollisionCheckerContext final : public CollisionCheckerContext {
+public:
+    SphereGridCollisionCheckerContext(const RobotDiagram<double>* model, int num_bodies)
+        : CollisionCheckerContext(model), X_WB(num_bodies), p_WS(num_bodies), p_WBs(num_bodies, Vector3d::Zero()) {}
+
+    // The poses of the bodies that the checker poses (others are stale).
+    std::vector<RigidTransformd> X_WB;
+    // The centers of each body's spheres and of its bounding sphere.
+    std::vector<Matrix3Xd> p_WS;
+    std::vector<Vector3d> p_WBs;
+
+private:
+    SphereGridCollisionCheckerContext(const SphereGridCollisionCheckerContext&) = default;
+
+    std::unique_ptr<CollisionCheckerContext> DoClone() const final {
+        return std::unique_ptr<SphereGridCollisionCheckerContext>(new SphereGridCollisionCheckerContext(*this));
+    }
+};
+
+const SphereGridCollisionCheckerContext& ToSphereGridContext(const CollisionCheckerContext& model_context) {
+    DRAKE_ASSERT(dynamic_cast<const SphereGridCollisionCheckerContext*>(&model_context) != nullptr);
+    return static_cast<const SphereGridCollisionCheckerContext&>(model_context);
+}
+
+SphereGridCollisionCheckerContext& ToSphereGridContext(CollisionCheckerContext* model_context) {
+    DRAKE_ASSERT(dynamic_cast<SphereGridCollisionCheckerContext*>(model_context) != nullptr);
+    return *static_cast<SphereGridCollisionCheckerContext*>(model_context);
+}
+
+// Appends points of a grid over the triangle abc such that every point of the
+// triangle is within `gap` of one of them.
+void SampleTriangle(const Vector3d& a, const Vector3d& b, const Vector3d& c, double gap,
+                    std::vector<Vector3d>* points) {
+    const double longest_edge = std::max({(b - a).norm(), (c - b).norm(), (a - c).norm()});
+    const int n = std::max(1, static_cast<int>(std::ceil(longest_edge / gap)));
+    for (int i = 0; i <= n; ++i) {
+        for (int j = 0; i + j <= n; ++j) {
+            points->push_back(a + (static_cast<double>(i) / n) * (b - a) + (static_cast<double>(j) / n) * (c - a));
+        }
+    }
+}
+
+// Covers the surface made of the given triangles with spheres: the surface is
+// sampled, and each cell (of a grid with the given spacing) containing samples
+// gets a sphere through them, enlarged to cover the gaps between samples.
+Matrix4Xd CoverTriangles(const std::vector<Matrix3d>& triangles, double spacing) {
+    const double gap = 0.5 * spacing;
+    std::vector<Vector3d> points;
+    for (const Matrix3d& triangle : triangles) {
+        SampleTriangle(triangle.col(0), triangle.col(1), triangle.col(2), gap, &points);
+    }
+    // For each occupied cell, the sum of its points and their number, and then
+    // the squared distance from their centroid to the farthest one.
+    std::map<std::array<int, 3>, std::pair<Vector4d, double>> cells;
+    const auto cell_of = [spacing](const Vector3d& p) {
+        return std::array<int, 3>{static_cast<int>(std::floor(p.x() / spacing)),
+                                  static_cast<int>(std::floor(p.y() / spacing)),
+                                  static_cast<int>(std::floor(p.z() / spacing))};
+    };
+    for (const Vector3d& p : points) {
+        cells.try_emplace(cell_of(p), Vector4d::Zero(), 0.0).first->second.first += Vector4d(p.x(), p.y(), p.z(), 1.0);
+    }
+    for (const Vector3d& p : points) {
+        auto& [sum, max_squared_distance] = cells.at(cell_of(p));
+        max_squared_distance = std::max(max_squared_distance, (p - sum.head<3>() / sum(3)).squaredNorm());
+    }
+    Matrix4Xd spheres(4, cells.size());
+    int s = 0;
+    for (const auto& [cell, data] : cells) {
+        const auto& [sum, max_squared_distance] = data;
+        spheres.col(s++) << sum.head<3>() / sum(3), std::sqrt(max_squared_distance) + gap;
+    }
+    return spheres;
+}
+
+// Covers the (radius, length) capsule or cylinder along the z axis with a
+// chain of spheres centered on the axis.
+Matrix4Xd CoverAxis(double radius, double length, double spacing) {
+    const int n = static_cast<int>(std::ceil(length / spacing));
+    const double step = n > 0 ? length / n : 0.0;
+    Matrix4Xd spheres(4, n + 1);
+    for (int i = 0; i <= n; ++i) {
+        spheres.col(i) << 0, 0, -0.5 * length + i * step, std::hypot(radius, 0.5 * step);
+    }
+    return spheres;
+}
+
+// Returns the triangles of the (fan-triangulated) faces of a mesh.
+std::vector<Matrix3d> GetTriangles(const PolygonSurfaceMesh<double>& mesh) {
+    std::vector<Matrix3d> triangles;
+    for (int f = 0; f < mesh.num_faces(); ++f) {
+        const auto face = mesh.element(f);
+        for (int i = 1; i + 1 < face.num_vertices(); ++i) {
+            Matrix3d& triangle = triangles.emplace_back();
+            triangle << mesh.vertex(face.vertex(0)), mesh.vertex(face.vertex(i)), mesh.vertex(face.vertex(i + 1));
+        }
+    }
+    return triangles;
+}
+
+// Returns the triangles of a polyhedron circumscribing the ellipsoid with the
+// given radii: a latitude-longitude triangulation of the unit sphere, scaled
+// out so its faces lie outside the sphere and then scaled to the radii.
+std::vector<Matrix3d> GetCircumscribedEllipsoidTriangles(const Vector3d& radii, double spacing) {
+    const int num_latitudes = std::max(4, static_cast<int>(std::ceil(M_PI * radii.maxCoeff() / spacing)));
+    const int num_longitudes = 2 * num_latitudes;
+    const double step = M_PI / num_latitudes;
+    const double scale = 1.0 / std::cos(step);
+    const auto vertex = [&](int i, int j) {
+        const double theta = i * step;
+        const double phi = j * step;
+        return Vector3d(scale * radii.x() * std::sin(theta) * std::cos(phi),
+                        scale * radii.y() * std::sin(theta) * std::sin(phi), scale * radii.z() * std::cos(theta));
+    };
+    std::vector<Matrix3d> triangles;
+    for (int i = 0; i < num_latitudes; ++i) {
+        for (int j = 0; j < num_longitudes; ++j) {
+            Matrix3d& upper = triangles.emplace_back();
+            upper << vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1);
+            Matrix3d& lower = triangles.emplace_back();
+            lower << vertex(i, j), vertex(i + 1, j + 1), vertex(i, j + 1);
+        }
+    }
+    return triangles;
+}
+
+// Returns the triangles of a box with the given half-extents.
+std::vector<Matrix3d> GetBoxTriangles(const Vector3d& half_size) {
+    const auto corner = [&](int i) {
+        return Vector3d((i & 1 ? 1 : -1) * half_size.x(), (i & 2 ? 1 : -1) * half_size.y(),
+                        (i & 4 ? 1 : -1) * half_size.z());
+    };
+    // The corners of each face, in order around it.
+    constexpr std::array<std::array<int, 4>, 6> kFaces{{
+            {0, 1, 3, 2}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 3, 7, 5}}};
+    std::vector<Matrix3d> triangles;
+    for (const auto& face : kFaces) {
+        Matrix3d& first = triangles.emplace_back();
+        first << corner(face[0]), corner(face[1]), corner(face[2]);
+        Matrix3d& second = triangles.emplace_back();
+        second << corner(face[0]), corner(face[2]), corner(face[3]);
+    }
+    return triangles;
+}
+
+// Returns the triangles of a prism with `num_sides` sides circumscribing the
+// cylinder.
+std::vector<Matrix3d> GetCircumscribedCylinderTriangles(double radius, double length, int num_sides) {
+    const double circumradius = radius / std::cos(M_PI / num_sides);
+    const auto vertex = [&](int i, double z) {
+        const double angle = 2 * M_PI * i / num_sides;
+        return Vector3d(circumradius * std::cos(angle), circumradius * std::sin(angle), z);
+    };
+    const double top = 0.5 * length;
+    std::vector<Matrix3d> triangles;
+    for (int i = 0; i < num_sides; ++i) {
+        Matrix3d& side_first = triangles.emplace_back();
+        side_first << vertex(i, -top), vertex(i + 1, -top), vertex(i + 1, top);
+        Matrix3d& side_second = triangles.emplace_back();
+        side_second << vertex(i, -top), vertex(i + 1, top), vertex(i, top);
+        Matrix3d& bottom = triangles.emplace_back();
+        bottom << Vector3d(0, 0, -top), vertex(i, -top), vertex(i + 1, -top);
+        Matrix3d& cap = triangles.emplace_back();
+        cap << Vector3d(0, 0, top), vertex(i, top), vertex(i + 1, top);
+    }
+    return triangles;
+}
+
+// Returns spheres covering `shape` (in its frame G), one per column as its
+// center followed by its radius.
+Matrix4Xd CalcCoveringSpheres(const Shape& shape, double spacing) {
+    const auto unsupported = [&shape](const auto&) -> Matrix4Xd {
+        throw std::logic_error(fmt::format("SphereGridCollisionChecker: can't cover a {} with spheres; it can't be "
+                                           "robot collision geometry.",
+                                           shape.type_name()));
+    };
+    return shape.Visit<Matrix4Xd>(overloaded{
+            [&](const geometry::Box& box) {
+                return CoverTriangles(GetBoxTriangles(0.5 * box.size()), spacing);
+            },
+            [&](const geometry::Capsule& capsule) {
+                return CoverAxis(capsule.radius(), capsule.length(), spacing);
+            },
+            [&](const geometry::Convex& convex) {
+                return CoverTriangles(GetTriangles(convex.GetConvexHull()), spacing);
+            },
+            [&](const geometry::Cylinder& cylinder) {
+                // Thin cylinders are covered well enough by a chain.
+                if (cylinder.radius() <= spacing) {
+                    return CoverAxis(cylinder.radius(), cylinder.length(), spacing);
+                }
+                const int num_sides =
+                        std::max(8, static_cast<int>(std::ceil(2 * M_PI * cylinder.radius() / spacing)));
+                return CoverTriangles(
+                        GetCircumscribedCylinderTriangles(cylinder.radius(), cylinder.length(), num_sides), spacing);
+            },
+            [&](const geometry::Ellipsoid& ellipsoid) {
+                return CoverTriangles(
+                        GetCircumscribedEllipsoidTriangles(Vector3d(ellipsoid.a(), ellipsoid.b(), ellipsoid.c()),
+                                                           spacing),
+                        spacing);
+            },
+            [&](const geometry::HalfSpace& half_space) {
+                return unsupported(half_space);
+            },
+            [&](const geometry::Mesh& mesh) {
+                return CoverTriangles(GetTriangles(mesh.GetConvexHull()), spacing);
+            },
+            [&](const geometry::MeshcatCone& cone) {
+                return unsupported(cone);
+            },
+            [](const geometry::Sphere& sphere) {
+                return Matrix4Xd(Vector4d(0, 0, 0, sphere.radius()));
+            }});
+}
+
+// Returns spheres covering `shape`, posed in frame B at X_BG.
+Matrix4Xd CalcCoveringSpheres(const Shape& shape, const RigidTransformd& X_BG, double spacing) {
+    Matrix4Xd spheres = CalcCoveringSpheres(shape, spacing);
+    spheres.topRows<3>() = (X_BG.rotation().matrix() * spheres.topRows<3>()).colwise() + X_BG.translation();
+    return spheres;
+}
+
+// A convex environment geometry, as the planes of its faces (in the world
+// frame): n̂ᵢ⋅p = dᵢ.
+struct ConvexObstacle {
+    int environment_index{};
+    Matrix3Xd normals;
+    VectorXd offsets;
+};
+
+}  // namespace
+
+// A signed distance grid over the bodies of the environment selected by a
+// mask.
+class SphereGridCollisionChecker::DistanceGrid {
+public:
+    DistanceGrid(const SphereGridCollisionCheckerParams& params, std::vector<uint8_t> mask)
+        : mask_(std::move(mask)), lower_(params.grid_lower), resolution_(params.grid_resolution) {
+        size_ = ((params.grid_upper - params.grid_lower) / resolution_).array().ceil().cast<int>() + 1;
+        distances_.assign(num_nodes(), static_cast<float>(params.grid_max_distance));
+        nearest_bodies_.assign(num_nodes(), multibody::world_index());
+    }
+
+    const std::vector<uint8_t>& mask() const { return mask_; }
+
+    int num_nodes() const { return size_.prod(); }
+
+    Vector3d node_position(int node) const {
+        const Eigen::Vector3i index(node % size_.x(), (node / size_.x()) % size_.y(), node / (size_.x() * size_.y()));
+        return lower_ + resolution_ * index.cast<double>();
+    }
+
+    // Lowers the node's distance to `distance` (to `body`), if it is smaller.
+    void Update(int node, double distance, BodyIndex body) {
+        if (distance < distances_[node]) {
+            distances_[node] = static_cast<float>(distance);
+            nearest_bodies_[node] = body;
+        }
+    }
+
+    // Returns a lower bound on the signed distance from p_WQ to the grid's
+    // bodies; the distance function is 1-Lipschitz, so the nearest node's
+    // distance less the distance to that node bounds it.
+    double CalcDistanceLowerBound(const Vector3d& p_WQ) const {
+        const Eigen::Vector3i index = NearestIndex(p_WQ);
+        return distances_[Flatten(index)] - (p_WQ - lower_ - resolution_ * index.cast<double>()).norm();
+    }
+
+    // Returns the environment body nearest to the node nearest to p_WQ.
+    BodyIndex GetNearestBody(const Vector3d& p_WQ) const { return nearest_bodies_[Flatten(NearestIndex(p_WQ))]; }
+
+    // Returns the (normalized) central-difference gradient of the distance at
+    // the node nearest to p_WQ.
+    Vector3d CalcGradient(const Vector3d& p_WQ) const {
+        const Eigen::Vector3i index = NearestIndex(p_WQ);
+        Vector3d gradient;
+        for (int axis = 0; axis < 3; ++axis) {
+            Eigen::Vector3i below = index;
+            Eigen::Vector3i above = index;
+            below[axis] = std::max(0, index[axis] - 1);
+            above[axis] = std::min(size_[axis] - 1, index[axis] + 1);
+            gradient[axis] = above[axis] > below[axis] ? (distances_[Flatten(above)] - distances_[Flatten(below)]) /
+                                                                 (resolution_ * (above[axis] - below[axis]))
+                                                       : 0.0;
+        }
+        return gradient.stableNormalized();
+    }
+
+private:
+    Eigen::Vector3i NearestIndex(const Vector3d& p_WQ) const {
+        return ((p_WQ - lower_) / resolution_)
+                .array()
+                .round()
+                .cast<int>()
+                .max(0)
+                .min(size_.array() - 1)
+                .matrix();
+    }
+
+    int Flatten(const Eigen::Vector3i& index) const {
+        return index.x() + size_.x() * (index.y() + size_.y() * index.z());
+    }
+
+    // Which of the checker's environment bodies the grid includes.
+    std::vector<uint8_t> mask_;
+    Vector3d lower_;
+    double resolution_{};
+    // The number of nodes along each axis.
+    Eigen::Vector3i size_;
+    std::vector<float> distances_;
+    std::vector<BodyIndex> nearest_bodies_;
+};
+
+SphereGridCollisionChecker::SphereGridCollisionChecker(CollisionCheckerParams params,
+                                                       const SphereGridCollisionCheckerParams& sphere_grid_params)
+    : CollisionChecker(std::move(params), true /* supports parallel */), sphere_grid_params_(sphere_grid_params) {
+    DRAKE_THROW_UNLESS(sphere_grid_params_.sphere_spacing > 0);
+    DRAKE_THROW_UNLESS(sphere_grid_params_.grid_resolution > 0);
+    DRAKE_THROW_UNLESS(sphere_grid_params_.grid_max_distance > 0);
+    DRAKE_THROW_UNLESS((sphere_grid_params_.grid_lower.array() < sphere_grid_params_.grid_upper.array()).all());
+
+    const SceneGraphInspector<double>& inspector = model().scene_graph().model_inspector();
+    geometry_spheres_.resize(plant().num_bodies());
+    for (BodyIndex body_index(0); body_index < plant().num_bodies(); ++body_index) {
+        const RigidBody<double>& body = plant().get_body(body_index);
+        const std::vector<GeometryId>& geometries = plant().GetCollisionGeometriesForBody(body);
+        if (geometries.empty()) {
+            continue;
+        }
+        if (!IsPartOfRobot(body)) {
+            environment_bodies_.push_back(body_index);
+            continue;
+        }
+        for (const GeometryId geometry : geometries) {
+            geometry_spheres_[body_index].push_back(
+                    {geometry, CalcCoveringSpheres(inspector.GetShape(geometry), inspector.GetPoseInFrame(geometry),
+                                                   sphere_grid_params_.sphere_spacing)});
+        }
+    }
+    UpdateBodySpheres();
+    CalcLinks();
+    int num_spheres = 0;
+    for (BodyIndex body_index : sphere_bodies_) {
+        num_spheres += body_spheres_[body_index].cols();
+    }
+    log()->debug("SphereGridCollisionChecker covered {} robot bodies with {} spheres", sphere_bodies_.size(),
+                 num_spheres);
+
+    AllocateContexts();
+    UpdateEnvironmentGrids();
+}
+
+SphereGridCollisionChecker::SphereGridCollisionChecker(const SphereGridCollisionChecker&) = default;
+
+const Eigen::Matrix4Xd& SphereGridCollisionChecker::GetBodySpheres(BodyIndex body_index) const {
+    return body_spheres_.at(body_index);
+}
+
+std::unique_ptr<CollisionChecker> SphereGridCollisionChecker::DoClone() const {
+    // N.B. We cannot use make_unique due to private-only access.
+    return std::unique_ptr<SphereGridCollisionChecker>(new SphereGridCollisionChecker(*this));
+}
+
+std::unique_ptr<CollisionCheckerContext> SphereGridCollisionChecker::CreatePrototypeContext() const {
+    return std::make_unique<SphereGridCollisionCheckerContext>(&model(), plant().num_bodies());
+}
+
+void SphereGridCollisionChecker::CalcLinks() {
+    std::vector<const Joint<double>*> inboard_joints(plant().num_bodies(), nullptr);
+    for (JointIndex joint_index : plant().GetJointIndices()) {
+        const Joint<double>& joint = plant().get_joint(joint_index);
+        inboard_joints[joint.child_body().index()] = &joint;
+    }
+
+    // The robot bodies and their ancestors, with their depths in the tree.
+    std::vector<int> depths(plant().num_bodies(), -1);
+    const auto calc_depth = [&](BodyIndex body_index) {
+        int depth = 0;
+        for (BodyIndex b = body_index; b != multibody::world_index(); b = inboard_joints[b]->parent_body().index()) {
+            // Since #18390 every body other than the world has a joint.
+            DRAKE_DEMAND(inboard_joints[b] != nullptr);
+            ++depth;
+        }
+        return depth;
+    };
+    for (BodyIndex body_index(0); body_index < plant().num_bodies(); ++body_index) {
+        if (!IsPartOfRobot(body_index)) {
+            continue;
+        }
+        for (BodyIndex b = body_index; b != multibody::world_index() && depths[b] < 0;
+             b = inboard_joints[b]->parent_body().index()) {
+            depths[b] = calc_depth(b);
+        }
+    }
+    std::vector<BodyIndex> bodies;
+    for (BodyIndex body_index(0); body_index < plant().num_bodies(); ++body_index) {
+        if (depths[body_index] > 0) {
+            bodies.push_back(body_index);
+        }
+    }
+    std::stable_sort(bodies.begin(), bodies.end(), [&depths](BodyIndex a, BodyIndex b) {
+        return depths[a] < depths[b];
+    });
+
+    links_.clear();
+    for (BodyIndex body_index : bodies) {
+        const Joint<double>& joint = *inboard_joints[body_index];
+        Link link;
+        link.body = body_index;
+        link.parent = joint.parent_body().index();
+        link.X_PF = joint.frame_on_parent().GetFixedPoseInBodyFrame();
+        link.X_MC = joint.frame_on_child().GetFixedPoseInBodyFrame().inverse();
+        const std::string& type = joint.type_name();
+        if (type == multibody::RevoluteJoint<double>::kTypeName) {
+            link.type = Link::Type::kRevolute;
+            link.position = joint.position_start();
+            link.axis_F = dynamic_cast<const multibody::RevoluteJoint<double>&>(joint).revolute_axis();
+        } else if (type == multibody::PrismaticJoint<double>::kTypeName) {
+            link.type = Link::Type::kPrismatic;
+            link.position = joint.position_start();
+            link.axis_F = dynamic_cast<const multibody::PrismaticJoint<double>&>(joint).translation_axis();
+        } else if (type == multibody::WeldJoint<double>::kTypeName) {
+            link.X_PF = link.X_PF * dynamic_cast<const multibody::WeldJoint<double>&>(joint).X_FM() * link.X_MC;
+            link.X_MC = RigidTransformd::Identity();
+        } else {
+            throw std::logic_error(
+                    fmt::format("SphereGridCollisionChecker: the {} joint {} is inboard of robot body {}; only "
+                                "revolute, prismatic and weld joints are supported there.",
+                                type, joint.name(), plant().get_body(body_index).scoped_name()));
+        }
+        links_.push_back(std::move(link));
+    }
+}
+
+void SphereGridCollisionChecker::UpdateBodySpheres() {
+    body_spheres_.assign(plant().num_bodies(), Matrix4Xd(4, 0));
+    body_bounding_spheres_.assign(plant().num_bodies(), Vector4d::Zero());
+    sphere_bodies_.clear();
+    for (BodyIndex body_index(0); body_index < plant().num_bodies(); ++body_index) {
+        int num_spheres = 0;
+        for (const GeometrySpheres& geometry : geometry_spheres_[body_index]) {
+            num_spheres += geometry.spheres.cols();
+        }
+        if (num_spheres == 0) {
+            continue;
+        }
+        Matrix4Xd& spheres = body_spheres_[body_index];
+        spheres.resize(4, num_spheres);
+        int first = 0;
+        for (const GeometrySpheres& geometry : geometry_spheres_[body_index]) {
+            spheres.middleCols(first, geometry.spheres.cols()) = geometry.spheres;
+            first += geometry.spheres.cols();
+        }
+        const Vector3d center = 0.5 * (spheres.topRows<3>().rowwise().minCoeff() +
+                                       spheres.topRows<3>().rowwise().maxCoeff());
+        const double radius =
+                ((spheres.topRows<3>().colwise() - center).colwise().norm() + spheres.row(3)).maxCoeff();
+        body_bounding_spheres_[body_index] << center, radius;
+        sphere_bodies_.push_back(body_index);
+    }
+    UpdateSelfCollisionPairs();
+}
+
+void SphereGridCollisionChecker::UpdateSelfCollisionPairs() {
+    self_collision_pairs_.clear();
+    for (int i = 0; i < ssize(sphere_bodies_); ++i) {
+        for (int j = i + 1; j < ssize(sphere_bodies_); ++j) {
+            if (!IsCollisionFilteredBetween(sphere_bodies_[i], sphere_bodies_[j])) {
+                self_collision_pairs_.emplace_back(sphere_bodies_[i], sphere_bodies_[j]);
+            }
+        }
+    }
+}
+
+void SphereGridCollisionChecker::UpdateEnvironmentGrids() {
+    // The distinct sets of environment bodies the robot bodies are checked
+    // against.
+    std::vector<std::vector<uint8_t>> masks;
+    body_grids_.assign(plant().num_bodies(), -1);
+    for (BodyIndex body_index : sphere_bodies_) {
+        std::vector<uint8_t> mask(environment_bodies_.size(), 0);
+        for (int e = 0; e < ssize(environment_bodies_); ++e) {
+            mask[e] = !IsCollisionFilteredBetween(body_index, environment_bodies_[e]);
+        }
+        if (std::find(mask.begin(), mask.end(), 1) == mask.end()) {
+            continue;
+        }
+        auto iter = std::find(masks.begin(), masks.end(), mask);
+        if (iter == masks.end()) {
+            iter = masks.insert(masks.end(), std::move(mask));
+        }
+        body_grids_[body_index] = iter - masks.begin();
+    }
+
+    // Keep the grids that are still needed, and build the others.
+    std::vector<std::shared_ptr<const DistanceGrid>> grids(masks.size());
+    std::vector<std::pair<int, std::unique_ptr<DistanceGrid>>> new_grids;
+    for (int g = 0; g < ssize(masks); ++g) {
+        for (const auto& grid : grids_) {
+            if (grid->mask() == masks[g]) {
+                grids[g] = grid;
+            }
+        }
+        if (grids[g] == nullptr) {
+            new_grids.emplace_back(g, std::make_unique<DistanceGrid>(sphere_grid_params_, masks[g]));
+        }
+    }
+    if (!new_grids.empty()) {
+        log()->debug("SphereGridCollisionChecker building {} distance grid(s) of {} nodes", new_grids.size(),
+                     new_grids[0].second->num_nodes());
+        // The grids hold the environment at its default positions.
+        const VectorXd default_q = plant().GetPositions(*plant().CreateDefaultContext());
+        const int num_threads = num_allocated_contexts();
+        for (int t = 0; t < num_threads; ++t) {
+            UpdatePositions(default_q, t);
+        }
+
+        // SceneGraph's point queries skip convex and mesh shapes; those are
+        // measured against the planes of their (hull's) faces, which is exact
+        // inside and conservative outside.
+        const QueryObject<double>& query_object = model_context(0).GetQueryObject();
+        const SceneGraphInspector<double>& inspector = query_object.inspector();
+        std::unordered_map<GeometryId, int> environment_indices;
+        std::vector<ConvexObstacle> convex_obstacles;
+        for (int e = 0; e < ssize(environment_bodies_); ++e) {
+            for (const GeometryId geometry :
+                 plant().GetCollisionGeometriesForBody(plant().get_body(environment_bodies_[e]))) {
+                environment_indices[geometry] = e;
+                const PolygonSurfaceMesh<double>* hull =
+                        inspector.GetShape(geometry).Visit<const PolygonSurfaceMesh<double>*>(
+                                overloaded{[](const geometry::Convex& convex) {
+                                               return &convex.GetConvexHull();
+                                           },
+                                           [](const geometry::Mesh& mesh) {
+                                               return &mesh.GetConvexHull();
+                                           },
+                                           [](const auto&) {
+                                               return nullptr;
+                                           }});
+                if (hull == nullptr) {
+                    continue;
+                }
+                const RigidTransformd& X_WG = query_object.GetPoseInWorld(geometry);
+                ConvexObstacle& obstacle = convex_obstacles.emplace_back();
+                obstacle.environment_index = e;
+                obstacle.normals.resize(3, hull->num_faces());
+                obstacle.offsets.resize(hull->num_faces());
+                for (int f = 0; f < hull->num_faces(); ++f) {
+                    obstacle.normals.col(f) = X_WG.rotation() * hull->face_normal(f);
+                    obstacle.offsets[f] = obstacle.normals.col(f).dot(X_WG * hull->vertex(hull->element(f).vertex(0)));
+                }
+            }
+        }
+
+        const double max_distance = sphere_grid_params_.grid_max_distance;
+        const auto node_work = [&](const int thread_num, const int64_t node) {
+            const Vector3d p_WQ = new_grids[0].second->node_position(node);
+            const auto update = [&](int e, double distance) {
+                for (auto& [g, grid] : new_grids) {
+                    if (grid->mask()[e]) {
+                        grid->Update(node, distance, environment_bodies_[e]);
+                    }
+                }
+            };
+            const std::vector<SignedDistanceToPoint<double>> results =
+                    model_context(thread_num).GetQueryObject().ComputeSignedDistanceToPoint(p_WQ, max_distance);
+            for (const SignedDistanceToPoint<double>& result : results) {
+                const auto iter = environment_indices.find(result.id_G);
+                if (iter != environment_indices.end()) {
+                    update(iter->second, result.distance);
+                }
+            }
+            for (const ConvexObstacle& obstacle : convex_obstacles) {
+                update(obstacle.environment_index,
+                       ((obstacle.normals.transpose() * p_WQ) - obstacle.offsets).maxCoeff());
+            }
+        };
+        StaticParallelForIndexLoop(DegreeOfParallelism(num_threads), 0, new_grids[0].second->num_nodes(), node_work,
+                                   ParallelForBackend::BEST_AVAILABLE);
+        for (auto& [g, grid] : new_grids) {
+            grids[g] = std::move(grid);
+        }
+    }
+    grids_ = std::move(grids);
+}
+
+double SphereGridCollisionChecker::GetEnvironmentPadding(BodyIndex body_index) const {
+    const std::vector<uint8_t>& mask = grids_[body_grids_[body_index]]->mask();
+    double padding = -std::numeric_limits<double>::infinity();
+    for (int e = 0; e < ssize(environment_bodies_); ++e) {
+        if (mask[e]) {
+            padding = std::max(padding, GetPaddingBetween(body_index, environment_bodies_[e]));
+        }
+    }
+    return padding;
+}
+
+void SphereGridCollisionChecker::DoUpdateContextPositions(CollisionCheckerContext* model_context) const {
+    SphereGridCollisionCheckerContext& context = ToSphereGridContext(model_context);
+    const VectorXd q = plant().GetPositions(model_context->plant_context());
+    for (const Link& link : links_) {
+        RigidTransformd X_PC;
+        switch (link.type) {
+            case Link::Type::kFixed:
+                X_PC = link.X_PF;
+                break;
+            case Link::Type::kRevolute:
+                X_PC = link.X_PF * RigidTransformd(RotationMatrixd(Eigen::AngleAxisd(q[link.position], link.axis_F)),
+                                                   Vector3d::Zero()) *
+                       link.X_MC;
+                break;
+            case Link::Type::kPrismatic:
+                X_PC = link.X_PF * RigidTransformd(q[link.position] * link.axis_F) * link.X_MC;
+                break;
+        }
+        context.X_WB[link.body] = context.X_WB[link.parent] * X_PC;
+    }
+    // Transform each body's sphere centers at once.
+    for (BodyIndex body_index : sphere_bodies_) {
+        const RigidTransformd& X_WB = context.X_WB[body_index];
+        context.p_WS[body_index].noalias() = X_WB.rotation().matrix() * body_spheres_[body_index].topRows<3>();
+        context.p_WS[body_index].colwise() += X_WB.translation();
+        context.p_WBs[body_index] = X_WB * body_bounding_spheres_[body_index].head<3>();
+    }
+}
+
+bool SphereGridCollisionChecker::DoCheckContextConfigCollisionFree(const CollisionCheckerContext& model_context) const {
+    const SphereGridCollisionCheckerContext& context = ToSphereGridContext(model_context);
+
+    for (BodyIndex body_index : sphere_bodies_) {
+        if (body_grids_[body_index] < 0) {
+            continue;
+        }
+        const DistanceGrid& grid = *grids_[body_grids_[body_index]];
+        const double padding = GetEnvironmentPadding(body_index);
+        const Matrix3Xd& p_WS = context.p_WS[body_index];
+        const Matrix4Xd& spheres = body_spheres_[body_index];
+        for (int s = 0; s < spheres.cols(); ++s) {
+            if (grid.CalcDistanceLowerBound(p_WS.col(s)) <= spheres(3, s) + padding) {
+                log()->trace("Environment collision of body [{}]", plant().get_body(body_index).scoped_name());
+                return false;
+            }
+        }
+    }
+
+    for (const auto& [body_a, body_b] : self_collision_pairs_) {
+        const double padding = GetPaddingBetween(body_a, body_b);
+        if ((context.p_WBs[body_a] - context.p_WBs[body_b]).norm() >
+            body_bounding_spheres_[body_a](3) + body_bounding_spheres_[body_b](3) + padding) {
+            continue;
+        }
+        const Matrix3Xd& p_WSb = context.p_WS[body_b];
+        const auto radii_b = body_spheres_[body_b].row(3).array();
+        for (int s = 0; s < body_spheres_[body_a].cols(); ++s) {
+            const double reach = body_spheres_[body_a](3, s) + padding;
+            if (((p_WSb.colwise() - context.p_WS[body_a].col(s)).colwise().norm().array() - radii_b <= reach).any()) {
+                log()->trace("Self collision between bodies [{}] and [{}]", plant().get_body(body_a).scoped_name(),
+                             plant().get_body(body_b).scoped_name());
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::optional<GeometryId> SphereGridCollisionChecker::DoAddCollisionShapeToBody(const std::string& group_name,
+                                                                                const RigidBody<double>& bodyA,
+                                                                                const Shape& shape,
+                                                                                const RigidTransformd& X_AG) {
+    if (!IsPartOfRobot(bodyA)) {
+        log()->warn("SphereGridCollisionChecker ignores the shape (group: [{}]) added to environment body {}",
+                    group_name, bodyA.scoped_name());
+        return std::nullopt;
+    }
+    const GeometryId geometry_id = GeometryId::get_new_id();
+    geometry_spheres_[bodyA.index()].push_back(
+            {geometry_id, CalcCoveringSpheres(shape, X_AG, sphere_grid_params_.sphere_spacing)});
+    UpdateBodySpheres();
+    UpdateEnvironmentGrids();
+    return geometry_id;
+}
+
+void SphereGridCollisionChecker::RemoveAddedGeometries(const std::vector<CollisionChecker::AddedShape>& shapes) {
+    for (const auto& checker_shape : shapes) {
+        log()->debug("  Removing geometry {}.", checker_shape.geometry_id);
+        std::vector<GeometrySpheres>& body_geometries = geometry_spheres_.at(checker_shape.body_index);
+        std::erase_if(body_geometries, [&checker_shape](const GeometrySpheres& geometry) {
+            return geometry.geometry_id == checker_shape.geometry_id;
+        });
+    }
+    UpdateBodySpheres();
+    UpdateEnvironmentGrids();
+}
+
+void SphereGridCollisionChecker::UpdateCollisionFilters() {
+    UpdateSelfCollisionPairs();
+    UpdateEnvironmentGrids();
+}
+
+RobotClearance SphereGridCollisionChecker::DoCalcContextRobotClearance(const CollisionCheckerContext& model_context,
+                                                                       const double influence_distance) const {
+    const SphereGridCollisionCheckerContext& context = ToSphereGridContext(model_context);
+    const Frame<double>& frame_W = plant().world_frame();
+    const systems::Context<double>& plant_context = model_context.plant_context();
+
+    Matrix3X<double> dp_BA_dq(3, plant().num_positions());
+    Matrix3X<double> partial_temp(3, plant().num_positions());
+    RowVectorXd ddist_dq(plant().num_positions());
+    RobotClearance result(plant().num_positions());
+    result.Reserve(DoMaxContextNumDistances(model_context));
+
+    // The nearest sphere of each robot body to the environment.
+    for (BodyIndex body_index : sphere_bodies_) {
+        if (body_grids_[body_index] < 0) {
+            continue;
+        }
+        const DistanceGrid& grid = *grids_[body_grids_[body_index]];
+        const Matrix3Xd& p_WS = context.p_WS[body_index];
+        const Matrix4Xd& spheres = body_spheres_[body_index];
+        double distance = std::numeric_limits<double>::infinity();
+        int nearest = 0;
+        for (int s = 0; s < spheres.cols(); ++s) {
+            const double sphere_distance = grid.CalcDistanceLowerBound(p_WS.col(s)) - spheres(3, s);
+            if (sphere_distance < distance) {
+                distance = sphere_distance;
+                nearest = s;
+            }
+        }
+        distance -= GetEnvironmentPadding(body_index);
+        if (distance > influence_distance) {
+            continue;
+        }
+        const Vector3d p_BS = spheres.col(nearest).head<3>();
+        plant().CalcJacobianPositionVector(plant_context, plant().get_body(body_index).body_frame(), p_BS, frame_W,
+                                           frame_W, &dp_BA_dq);
+        ddist_dq.noalias() = grid.CalcGradient(p_WS.col(nearest)).transpose() * dp_BA_dq;
+        result.Append(body_index, grid.GetNearestBody(p_WS.col(nearest)), RobotCollisionType::kEnvironmentCollision,
+                      distance, ddist_dq);
+    }
+
+    // The nearest pair of spheres of each pair of robot bodies.
+    for (const auto& [body_a, body_b] : self_collision_pairs_) {
+        const double padding = GetPaddingBetween(body_a, body_b);
+        if ((context.p_WBs[body_a] - context.p_WBs[body_b]).norm() - body_bounding_spheres_[body_a](3) -
+                    body_bounding_spheres_[body_b](3) - padding >
+            influence_distance) {
+            continue;
+        }
+        const Matrix3Xd& p_WSa = context.p_WS[body_a];
+        const Matrix3Xd& p_WSb = context.p_WS[body_b];
+        double distance = std::numeric_limits<double>::infinity();
+        int nearest_a = 0;
+        int nearest_b = 0;
+        for (int s = 0; s < p_WSa.cols(); ++s) {
+            int t{};
+            const double pair_distance =
+                    ((p_WSb.colwise() - p_WSa.col(s)).colwise().norm().array() - body_spheres_[body_b].row(3).array())
+                            .minCoeff(&t) -
+                    body_spheres_[body_a](3, s);
+            if (pair_distance < distance) {
+                distance = pair_distance;
+                nearest_a = s;
+                nearest_b = t;
+            }
+        }
+        distance -= padding;
+        if (distance > influence_distance) {
+            continue;
+        }
+        const Vector3d ddist_dp_BA = (p_WSa.col(nearest_a) - p_WSb.col(nearest_b)).stableNormalized();
+        plant().CalcJacobianPositionVector(plant_context, plant().get_body(body_a).body_frame(),
+                                           Vector3d(body_spheres_[body_a].col(nearest_a).head<3>()), frame_W,
+                                           frame_W, &dp_BA_dq);
+        plant().CalcJacobianPositionVector(plant_context, plant().get_body(body_b).body_frame(),
+                                           Vector3d(body_spheres_[body_b].col(nearest_b).head<3>()), frame_W,
+                                           frame_W, &partial_temp);
+        dp_BA_dq -= partial_temp;
+        ddist_dq.noalias() = ddist_dp_BA.transpose() * dp_BA_dq;
+        result.Append(body_a, body_b, RobotCollisionType::kSelfCollision, distance, ddist_dq);
+    }
+    return result;
+}
+
+std::vector<RobotCollisionType> SphereGridCollisionChecker::DoClassifyContextBodyCollisions(
+        const CollisionCheckerContext& model_context) const {
+    const SphereGridCollisionCheckerContext& context = ToSphereGridContext(model_context);
+    std::vector<RobotCollisionType> robot_collision_types(plant().num_bodies(), RobotCollisionType::kNoCollision);
+
+    for (BodyIndex body_index : sphere_bodies_) {
+        if (body_grids_[body_index] < 0) {
+            continue;
+        }
+        const DistanceGrid& grid = *grids_[body_grids_[body_index]];
+        const double padding = GetEnvironmentPadding(body_index);
+        const Matrix3Xd& p_WS = context.p_WS[body_index];
+        const Matrix4Xd& spheres = body_spheres_[body_index];
+        for (int s = 0; s < spheres.cols(); ++s) {
+            if (grid.CalcDistanceLowerBound(p_WS.col(s)) <= spheres(3, s) + padding) {
+                robot_collision_types[body_index] = SetInEnvironmentCollision(robot_collision_types[body_index], true);
+                break;
+            }
+        }
+    }
+
+    for (const auto& [body_a, body_b] : self_collision_pairs_) {
+        const double padding = GetPaddingBetween(body_a, body_b);
+        if ((context.p_WBs[body_a] - context.p_WBs[body_b]).norm() >
+            body_bounding_spheres_[body_a](3) + body_bounding_spheres_[body_b](3) + padding) {
+            continue;
+        }
+        const Matrix3Xd& p_WSb = context.p_WS[body_b];
+        const auto radii_b = body_spheres_[body_b].row(3).array();
+        for (int s = 0; s < body_spheres_[body_a].cols(); ++s) {
+            const double reach = body_spheres_[body_a](3, s) + padding;
+            if (((p_WSb.colwise() - context.p_WS[body_a].col(s)).colwise().norm().array() - radii_b <= reach).any()) {
+                robot_collision_types[body_a] = SetInSelfCollision(robot_collision_types[body_a], true);
+                robot_collision_types[body_b] = SetInSelfCollision(robot_collision_types[body_b], true);
+                break;
+            }
+        }
+    }
+    return robot_collision_types;
+}
+
+int SphereGridCollisionChecker::DoMaxContextNumDistances(const CollisionCheckerContext&) const {
+    int num_distances = ssize(self_collision_pairs_);
+    for (BodyIndex body_index : sphere_bodies_) {
+        if (body_grids_[body_index] >= 0) {
+            ++num_distances;
+        }
+    }
+    return num_distances;
+}
+
+}  // namespace planning
+}  // namespace drake
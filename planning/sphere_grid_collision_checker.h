@@ -0,0 +1,220 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "common/name_value.h"
+#include "planning/collision_checker.h"
+#include "planning/collision_checker_params.h"
+
+namespace drake {
+namespace planning {
+
+/** Parameters for the sphere and grid approximations made by
+SphereGridCollisionChecker. */
+struct SphereGridCollisionCheckerParams {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+        a->Visit(DRAKE_NVP(sphere_spacing));
+        a->Visit(DRAKE_NVP(grid_lower));
+        a->Visit(DRAKE_NVP(grid_upper));
+        a->Visit(DRAKE_NVP(grid_resolution));
+        a->Visit(DRAKE_NVP(grid_max_distance));
+    }
+
+    /** The approximate spacing (in meters) of the spheres covering the robot's
+     collision geometry. The spheres bulge beyond the geometry by up to about
+     1.5 times this distance; smaller values fit the geometry more tightly with
+     (quadratically) more spheres. */
+    double sphere_spacing{0.03};
+
+    /** The (world frame) corners of the box covered by the environment's signed
+     distance grid. Robot spheres outside of the box are still checked, but
+     more conservatively the farther they are from it. */
+    Eigen::Vector3d grid_lower{-1.0, -1.0, -0.5};
+    Eigen::Vector3d grid_upper{1.0, 1.0, 1.5};
+
+    /** The spacing (in meters) of the grid's samples. A sphere is checked
+     against the sample nearest to its center, so the check is conservative by
+     up to half the diagonal of a grid cell. */
+    double grid_resolution{0.02};
+
+    /** Distances (in meters) to the environment larger than this are stored as
+     this value. It must exceed the largest sphere radius plus the largest
+     padding for checks far from the environment to succeed. */
+    double grid_max_distance{0.25};
+};
+
+/** An implementation of CollisionChecker that trades exactness for speed by
+approximating the robot and the environment:
+
+ - Each robot body's collision geometry is covered by spheres, generated at
+   construction from the geometry's shape (see
+   SphereGridCollisionCheckerParams::sphere_spacing). A sphere is its own
+   cover; capsules and thin cylinders are covered by chains of spheres along
+   their axes, and the other shapes (with meshes replaced by their convex
+   hulls) by clusters of samples of their (circumscribed, polyhedral)
+   surfaces.
+ - The environment's collision geometry is baked at construction into a
+   signed distance grid over a box of the workspace, with the environment at
+   its default positions. A robot sphere is in collision with the environment
+   if the grid's (conservative) distance at its center is less than its
+   radius plus the padding.
+ - The robot's kinematics are computed directly from its joints' transforms,
+   rather than through MultibodyPlant's cache, and all of a body's sphere
+   centers are transformed at once.
+
+Robot self-collisions are checked between the spheres of each pair of robot
+bodies whose collision isn't filtered, with pairs whose bounding spheres are
+apart skipped. The approximations are conservative: every configuration in
+collision according to SceneGraphCollisionChecker is in collision here too, up
+to the accuracy of the convex hull and grid approximations.
+
+Distances reported by CalcRobotClearance() are between spheres, or between a
+sphere and the grid; they are approximate, and there is at most one distance
+per robot body against the environment (whose `other_indices()` entry is the
+environment body nearest to the sphere) and one per unfiltered pair of robot
+bodies.
+
+Limitations:
+ - Environment bodies must not move; the grid ignores any positions of them
+   other than the default positions.
+ - Every joint inboard of a robot body with collision geometry must be a
+   revolute, prismatic or weld joint.
+ - Shapes can be added to robot bodies with AddCollisionShapeToBody(); shapes
+   added to environment bodies are ignored (the grid is not rebuilt).
+ - Changing the collision filters between robot and environment bodies may
+   rebuild parts of the grid.
+
+@ingroup planning_collision_checker
+*/
+class SphereGridCollisionChecker final : public CollisionChecker {
+public:
+    /** @name     Does not allow copy, move, or assignment. */
+    /** @{ */
+    // N.B. The copy constructor is private for use in implementing Clone().
+    void operator=(const SphereGridCollisionChecker&) = delete;
+    /** @} */
+
+    /** Creates a new checker with the given params.
+     @throws std::exception if `sphere_grid_params` are not all positive with
+     `grid_lower` < `grid_upper`, if a robot body has collision geometry that
+     isn't supported (a HalfSpace or MeshcatCone), or if a joint inboard of a
+     robot body isn't supported. */
+    explicit SphereGridCollisionChecker(CollisionCheckerParams params,
+                                        const SphereGridCollisionCheckerParams& sphere_grid_params = {});
+
+    /** Returns the spheres covering the collision geometry of the body with
+     index `body_index`, one per column as the position of its center in the
+     body frame followed by its radius. Environment bodies have no spheres. */
+    const Eigen::Matrix4Xd& GetBodySpheres(multibody::BodyIndex body_index) const;
+
+private:
+    // The spheres covering one piece of collision geometry.
+    struct GeometrySpheres {
+        geometry::GeometryId geometry_id;
+        Eigen::Matrix4Xd spheres;
+    };
+
+    // How one of the bodies whose pose the checker needs is posed relative to
+    // its parent.
+    struct Link {
+        enum class Type { kFixed, kRevolute, kPrismatic };
+
+        multibody::BodyIndex body;
+        multibody::BodyIndex parent;
+        Type type{Type::kFixed};
+        // The index of the joint's position in q, unless kFixed.
+        int position{-1};
+        // For kFixed, X_PF is the fixed pose X_PC of the body and X_MC is the
+        // identity.
+        math::RigidTransformd X_PF;
+        math::RigidTransformd X_MC;
+        Eigen::Vector3d axis_F{Eigen::Vector3d::UnitZ()};
+    };
+
+    class DistanceGrid;
+
+    // To support Clone(), allow copying (but not move nor assign).
+    explicit SphereGridCollisionChecker(const SphereGridCollisionChecker&);
+
+    std::unique_ptr<CollisionChecker> DoClone() const final;
+
+    std::unique_ptr<CollisionCheckerContext> CreatePrototypeContext() const final;
+
+    void DoUpdateContextPositions(CollisionCheckerContext* model_context) const final;
+
+    bool DoCheckContextConfigCollisionFree(const CollisionCheckerContext& model_context) const final;
+
+    std::optional<geometry::GeometryId> DoAddCollisionShapeToBody(const std::string& group_name,
+                                                                  const multibody::RigidBody<double>& bodyA,
+                                                                  const geometry::Shape& shape,
+                                                                  const math::RigidTransform<double>& X_AG) final;
+
+    void RemoveAddedGeometries(const std::vector<CollisionChecker::AddedShape>& shapes) final;
+
+    void UpdateCollisionFilters() final;
+
+    RobotClearance DoCalcContextRobotClearance(const CollisionCheckerContext& model_context,
+                                               double influence_distance) const final;
+
+    std::vector<RobotCollisionType> DoClassifyContextBodyCollisions(
+            const CollisionCheckerContext& model_context) const final;
+
+    int DoMaxContextNumDistances(const CollisionCheckerContext& model_context) const final;
+
+    // Computes links_ for the ancestors of the robot bodies.
+    void CalcLinks();
+
+    // Regathers body_spheres_ and the bounding spheres from geometry_spheres_,
+    // and recomputes the self-collision pairs.
+    void UpdateBodySpheres();
+
+    // Recomputes self_collision_pairs_ from the collision filters.
+    void UpdateSelfCollisionPairs();
+
+    // Assigns each robot body the grid of the environment bodies it isn't
+    // filtered against, building any grids that don't exist yet.
+    void UpdateEnvironmentGrids();
+
+    // The largest padding between the robot body and the environment bodies of
+    // its grid.
+    double GetEnvironmentPadding(multibody::BodyIndex body_index) const;
+
+    SphereGridCollisionCheckerParams sphere_grid_params_;
+
+    // The spheres covering each body's geometries, indexed by body.
+    std::vector<std::vector<GeometrySpheres>> geometry_spheres_;
+
+    // All of the spheres covering each body, indexed by body, and the center
+    // (in the body frame) and radius of a sphere bounding them.
+    std::vector<Eigen::Matrix4Xd> body_spheres_;
+    std::vector<Eigen::Vector4d> body_bounding_spheres_;
+
+    // The robot bodies with spheres.
+    std::vector<multibody::BodyIndex> sphere_bodies_;
+
+    // The bodies posed by DoUpdateContextPositions(), parents before children.
+    std::vector<Link> links_;
+
+    // The unfiltered pairs of robot bodies with spheres.
+    std::vector<std::pair<multibody::BodyIndex, multibody::BodyIndex>> self_collision_pairs_;
+
+    // The environment bodies with collision geometry.
+    std::vector<multibody::BodyIndex> environment_bodies_;
+
+    // The distance grids, each over a subset of environment_bodies_, and the
+    // index of the grid (or -1 for none) each body is checked against.
+    std::vector<std::shared_ptr<const DistanceGrid>> grids_;
+    std::vector<int> body_grids_;
+};
+
+}  // namespace planning
+}  // namespace drake
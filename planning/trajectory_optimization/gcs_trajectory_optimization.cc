@@ -8,6 +8,7 @@
 #include "common/pointer_cast.h"
 #include "common/scope_exit.h"
 #include "common/symbolic/decompose.h"
+#include "common/text_logging.h"
 #include "geometry/optimization/cartesian_product.h"
 #include "geometry/optimization/geodesic_convexity.h"
 #include "geometry/optimization/hpolyhedron.h"
@@ -26,6 +27,7 @@ namespace trajectory_optimization {
 
 using Subgraph = GcsTrajectoryOptimization::Subgraph;
 using EdgesBetweenSubgraphs = GcsTrajectoryOptimization::EdgesBetweenSubgraphs;
+using PathQuery = GcsTrajectoryOptimization::PathQuery;
 
 using drake::solvers::MathematicalProgram;
 using drake::solvers::Solve;
@@ -613,10 +615,12 @@ symbolic::Variable Subgraph::GetTimeScaling(const geometry::optimization::GraphO
     return v.x()(v.x().size() - 1);
 }
 
-EdgesBetweenSubgraphs::EdgesBetweenSubgraphs(const Subgraph& from_subgraph,
-                                             const Subgraph& to_subgraph,
-                                             const ConvexSet* subspace,
-                                             GcsTrajectoryOptimization* traj_opt)
+EdgesBetweenSubgraphs::EdgesBetweenSubgraphs(
+        const Subgraph& from_subgraph,
+        const Subgraph& to_subgraph,
+        const ConvexSet* subspace,
+        GcsTrajectoryOptimization* traj_opt,
+        const std::vector<std::tuple<int, int, Eigen::VectorXd>>* edge_data)
     : traj_opt_(*traj_opt), from_subgraph_(from_subgraph), to_subgraph_(to_subgraph) {
     // Formulate edge costs and constraints.
     if (subspace != nullptr) {
@@ -655,9 +659,13 @@ EdgesBetweenSubgraphs::EdgesBetweenSubgraphs(const Subgraph& from_subgraph,
         }
     }
 
-    const std::vector<std::tuple<int, int, Eigen::VectorXd>> edge_data =
-            CalcPairwiseIntersections(from_subgraph.regions(), to_subgraph.regions(), continuous_revolute_joints());
-    for (const auto& edge : edge_data) {
+    std::vector<std::tuple<int, int, Eigen::VectorXd>> computed_edge_data;
+    if (edge_data == nullptr) {
+        computed_edge_data = CalcPairwiseIntersections(from_subgraph.regions(), to_subgraph.regions(),
+                                                       continuous_revolute_joints());
+        edge_data = &computed_edge_data;
+    }
+    for (const auto& edge : *edge_data) {
         int i = std::get<0>(edge);
         int j = std::get<1>(edge);
         Eigen::VectorXd edge_offset = std::get<2>(edge);
@@ -1159,6 +1167,239 @@ symbolic::Variable EdgesBetweenSubgraphs::GetTimeScalingV(
     return e.xv()(e.xv().size() - 1);
 }
 
+namespace {
+
+// Returns the bounding box of `point` along the continuous revolute joints.
+std::vector<std::pair<double, double>> PointBoundingBox(const VectorXd& point,
+                                                        const std::vector<int>& continuous_revolute_joints) {
+    std::vector<std::pair<double, double>> bbox;
+    bbox.reserve(continuous_revolute_joints.size());
+    for (const int joint : continuous_revolute_joints) {
+        bbox.emplace_back(point(joint), point(joint));
+    }
+    return bbox;
+}
+
+}  // namespace
+
+PathQuery::PathQuery(const Subgraph& start_regions,
+                     const Subgraph& goal_regions,
+                     GcsTrajectoryOptimization* traj_opt)
+    : traj_opt_(*traj_opt), start_regions_(start_regions), goal_regions_(goal_regions) {
+    const std::vector<int>& joints = traj_opt_.continuous_revolute_joints();
+    start_regions_bbox_.resize(start_regions.regions().size());
+    goal_regions_bbox_.resize(goal_regions.regions().size());
+    if (!joints.empty()) {
+        for (int i = 0; i < ssize(start_regions_bbox_); ++i) {
+            start_regions_bbox_[i] = GetMinimumAndMaximumValueAlongDimension(*start_regions.regions()[i], joints);
+        }
+        for (int i = 0; i < ssize(goal_regions_bbox_); ++i) {
+            goal_regions_bbox_[i] = GetMinimumAndMaximumValueAlongDimension(*goal_regions.regions()[i], joints);
+        }
+    }
+}
+
+PathQuery::~PathQuery() = default;
+
+void PathQuery::ClearPreviousPath() {
+    previous_start_region_ = -1;
+    previous_goal_region_ = -1;
+    previous_edges_.clear();
+    previous_result_.reset();
+}
+
+std::vector<std::tuple<int, int, VectorXd>> PathQuery::FindContainingRegions(
+        const Subgraph& regions,
+        const std::vector<std::vector<std::pair<double, double>>>& regions_bbox,
+        const VectorXd& point,
+        bool point_is_from) const {
+    const std::vector<int>& joints = traj_opt_.continuous_revolute_joints();
+    const std::vector<std::pair<double, double>> point_bbox = PointBoundingBox(point, joints);
+    std::vector<std::tuple<int, int, VectorXd>> edge_data;
+    for (int i = 0; i < ssize(regions.regions()); ++i) {
+        if (point_is_from) {
+            // The edge goes from the point to region i, which must contain the
+            // point shifted by the edge offset.
+            VectorXd offset = ComputeOffsetContinuousRevoluteJoints(traj_opt_.num_positions(), joints, point_bbox,
+                                                                    regions_bbox[i]);
+            if (regions.regions()[i]->PointInSet(point + offset)) {
+                edge_data.emplace_back(0, i, std::move(offset));
+            }
+        } else {
+            VectorXd offset = ComputeOffsetContinuousRevoluteJoints(traj_opt_.num_positions(), joints,
+                                                                    regions_bbox[i], point_bbox);
+            if (regions.regions()[i]->PointInSet(point - offset)) {
+                edge_data.emplace_back(i, 0, std::move(offset));
+            }
+        }
+    }
+    return edge_data;
+}
+
+std::pair<CompositeTrajectory<double>, solvers::MathematicalProgramResult> PathQuery::Solve(
+        const Eigen::Ref<const VectorXd>& start,
+        const Eigen::Ref<const VectorXd>& goal,
+        const GraphOfConvexSetsOptions& specified_options) {
+    DRAKE_THROW_UNLESS(start.size() == traj_opt_.num_positions());
+    DRAKE_THROW_UNLESS(goal.size() == traj_opt_.num_positions());
+    // Note: if this default changes, it must also be updated in the method
+    // documentation.
+    GraphOfConvexSetsOptions options = specified_options;
+    if (!options.preprocessing) {
+        options.preprocessing = false;
+    }
+
+    const std::vector<std::tuple<int, int, VectorXd>> start_edge_data =
+            FindContainingRegions(start_regions_, start_regions_bbox_, start, /* point_is_from= */ true);
+    const std::vector<std::tuple<int, int, VectorXd>> goal_edge_data =
+            FindContainingRegions(goal_regions_, goal_regions_bbox_, goal, /* point_is_from= */ false);
+    if (start_edge_data.empty() || goal_edge_data.empty()) {
+        log()->debug("GcsTrajectoryOptimization::PathQuery: no region of {} contains the {}.",
+                     start_edge_data.empty() ? start_regions_.name() : goal_regions_.name(),
+                     start_edge_data.empty() ? "start" : "goal");
+        solvers::MathematicalProgramResult result;
+        result.set_solution_result(solvers::SolutionResult::kInfeasibleConstraints);
+        return {CompositeTrajectory<double>({}), result};
+    }
+
+    // Connect the start and goal for the duration of this query. They spend no
+    // time in their (zero order) regions, so don't appear in the trajectory.
+    Subgraph* source = nullptr;
+    Subgraph* target = nullptr;
+    const ScopeExit remove_endpoints_before_returning([&]() {
+        if (source != nullptr) {
+            traj_opt_.RemoveSubgraph(*source);
+        }
+        if (target != nullptr) {
+            traj_opt_.RemoveSubgraph(*target);
+        }
+    });
+    source = &traj_opt_.AddRegions(MakeConvexSets(Point(start)), {}, /* order= */ 0, /* h_min= */ 0, /* h_max= */ 20,
+                                   fmt::format("{} start", start_regions_.name()));
+    target = &traj_opt_.AddRegions(MakeConvexSets(Point(goal)), {}, /* order= */ 0, /* h_min= */ 0, /* h_max= */ 20,
+                                   fmt::format("{} goal", goal_regions_.name()));
+    traj_opt_.AddEdgesBetweenSubgraphs(std::unique_ptr<EdgesBetweenSubgraphs>(
+            new EdgesBetweenSubgraphs(*source, start_regions_, nullptr, &traj_opt_, &start_edge_data)));
+    traj_opt_.AddEdgesBetweenSubgraphs(std::unique_ptr<EdgesBetweenSubgraphs>(
+            new EdgesBetweenSubgraphs(goal_regions_, *target, nullptr, &traj_opt_, &goal_edge_data)));
+
+    if (reuse_previous_path_ && previous_result_.has_value()) {
+        auto solution = SolvePreviousPath(*source, *target, options);
+        if (solution.has_value()) {
+            return std::move(*solution);
+        }
+    }
+
+    auto [trajectory, result] = traj_opt_.SolvePath(*source, *target, options);
+    if (result.is_success()) {
+        RecordPath(*source, *target, result);
+    } else {
+        ClearPreviousPath();
+    }
+    return {std::move(trajectory), std::move(result)};
+}
+
+std::optional<std::pair<CompositeTrajectory<double>, solvers::MathematicalProgramResult>> PathQuery::SolvePreviousPath(
+        const Subgraph& source, const Subgraph& target, const GraphOfConvexSetsOptions& options) {
+    // The first and last regions of the previous path must still connect to
+    // the new start and goal.
+    const Vertex* start_region = start_regions_.vertices_[previous_start_region_];
+    const Vertex* goal_region = goal_regions_.vertices_[previous_goal_region_];
+    const Edge* source_edge = nullptr;
+    for (const Edge* e : source.vertices_[0]->outgoing_edges()) {
+        if (&e->v() == start_region) {
+            source_edge = e;
+        }
+    }
+    const Edge* target_edge = nullptr;
+    for (const Edge* e : target.vertices_[0]->incoming_edges()) {
+        if (&e->u() == goal_region) {
+            target_edge = e;
+        }
+    }
+    if (source_edge == nullptr || target_edge == nullptr) {
+        return std::nullopt;
+    }
+
+    // The edges between them must still be in the graph.
+    std::vector<const Edge*> active_edges{source_edge};
+    if (!previous_edges_.empty()) {
+        std::map<EdgeId, const Edge*> edges;
+        for (const Edge* e : traj_opt_.gcs_.Edges()) {
+            edges.emplace(e->id(), e);
+        }
+        for (const EdgeId& id : previous_edges_) {
+            const auto it = edges.find(id);
+            if (it == edges.end()) {
+                return std::nullopt;
+            }
+            active_edges.push_back(it->second);
+        }
+    }
+    active_edges.push_back(target_edge);
+
+    // Start from the previous solution in the regions, and from the new
+    // endpoints (with zero duration) in the points.
+    std::unordered_map<symbolic::Variable::Id, int> variable_index;
+    std::vector<double> values;
+    const auto add_initial_guess = [&](const Vertex& v, const VectorXd& x_value) {
+        for (int k = 0; k < v.x().size(); ++k) {
+            variable_index.emplace(v.x()(k).get_id(), ssize(values));
+            values.push_back(x_value(k));
+        }
+    };
+    const auto add_point_initial_guess = [&](const Vertex& v) {
+        VectorXd x_value = VectorXd::Zero(v.x().size());
+        x_value.head(traj_opt_.num_positions()) = *v.set().MaybeGetPoint();
+        add_initial_guess(v, x_value);
+    };
+    add_point_initial_guess(source_edge->u());
+    for (const Edge* e : active_edges) {
+        if (e == target_edge) {
+            add_point_initial_guess(e->v());
+        } else {
+            add_initial_guess(e->v(), previous_result_->GetSolution(e->v().x()));
+        }
+    }
+    solvers::MathematicalProgramResult initial_guess;
+    initial_guess.set_decision_variable_index(std::move(variable_index));
+    initial_guess.set_x_val(Eigen::Map<const VectorXd>(values.data(), values.size()));
+
+    solvers::MathematicalProgramResult result =
+            traj_opt_.gcs_.SolveConvexRestriction(active_edges, options, &initial_guess);
+    if (!result.is_success()) {
+        log()->debug(
+                "GcsTrajectoryOptimization::PathQuery: the previous path is infeasible ({}); solving the full "
+                "problem.",
+                result.get_solution_result());
+        return std::nullopt;
+    }
+    previous_result_ = result;
+    return std::make_pair(traj_opt_.ReconstructTrajectoryFromSolutionPath(active_edges, result), std::move(result));
+}
+
+void PathQuery::RecordPath(const Subgraph& source,
+                           const Subgraph& target,
+                           const solvers::MathematicalProgramResult& result) {
+    const double kTolerance = 1.0;  // take any path we can get, as SolvePath() does.
+    const std::vector<const Edge*> path =
+            traj_opt_.gcs_.GetSolutionPath(*source.vertices_[0], *target.vertices_[0], result, kTolerance);
+    DRAKE_DEMAND(path.size() >= 2);
+    const std::vector<Vertex*>& start_vertices = start_regions_.vertices_;
+    const std::vector<Vertex*>& goal_vertices = goal_regions_.vertices_;
+    previous_start_region_ =
+            std::find(start_vertices.begin(), start_vertices.end(), &path.front()->v()) - start_vertices.begin();
+    previous_goal_region_ =
+            std::find(goal_vertices.begin(), goal_vertices.end(), &path.back()->u()) - goal_vertices.begin();
+    DRAKE_DEMAND(previous_start_region_ < ssize(start_vertices));
+    DRAKE_DEMAND(previous_goal_region_ < ssize(goal_vertices));
+    previous_edges_.clear();
+    for (size_t k = 1; k + 1 < path.size(); ++k) {
+        previous_edges_.push_back(path[k]->id());
+    }
+    previous_result_ = result;
+}
+
 GcsTrajectoryOptimization::GcsTrajectoryOptimization(int num_positions, std::vector<int> continuous_revolute_joints)
     : num_positions_(num_positions), continuous_revolute_joints_(std::move(continuous_revolute_joints)) {
     DRAKE_THROW_UNLESS(num_positions >= 1);
@@ -1241,13 +1482,24 @@ Subgraph& GcsTrajectoryOptimization::AddRegions(
                                                  edge_offsets);
 }
 
-void GcsTrajectoryOptimization::RemoveSubgraph(const Subgraph& subgraph) {
-    // Check if the subgraph is in the list of subgraphs.
+void GcsTrajectoryOptimization::ThrowIfSubgraphNotRegistered(const Subgraph& subgraph) const {
     if (!std::any_of(subgraphs_.begin(), subgraphs_.end(), [&](const std::unique_ptr<Subgraph>& s) {
             return s.get() == &subgraph;
         })) {
         throw std::runtime_error(fmt::format("Subgraph {} is not registered with `this`", subgraph.name()));
     }
+}
+
+void GcsTrajectoryOptimization::RemoveSubgraph(const Subgraph& subgraph) {
+    // Check if the subgraph is in the list of subgraphs.
+    ThrowIfSubgraphNotRegistered(subgraph);
+
+    // Remove the path queries between the subgraph and any other.
+    path_queries_.erase(std::remove_if(path_queries_.begin(), path_queries_.end(),
+                                       [&](const std::unique_ptr<PathQuery>& q) {
+                                           return &q->start_regions_ == &subgraph || &q->goal_regions_ == &subgraph;
+                                       }),
+                        path_queries_.end());
 
     // Remove the underlying edges between subgraphs from the gcs problem.
     for (const std::unique_ptr<EdgesBetweenSubgraphs>& subgraph_edge : subgraph_edges_) {
@@ -1267,6 +1519,7 @@ void GcsTrajectoryOptimization::RemoveSubgraph(const Subgraph& subgraph) {
 
     // Remove all vertices in the subgraph.
     for (Vertex* v : subgraph.vertices_) {
+        vertex_to_subgraph_.erase(v);
         // This will also remove all edges connected to the vertex.
         gcs_.RemoveVertex(v);
     }
@@ -1282,8 +1535,12 @@ void GcsTrajectoryOptimization::RemoveSubgraph(const Subgraph& subgraph) {
 EdgesBetweenSubgraphs& GcsTrajectoryOptimization::AddEdges(const Subgraph& from_subgraph,
                                                            const Subgraph& to_subgraph,
                                                            const ConvexSet* subspace) {
-    EdgesBetweenSubgraphs* subgraph_edge = new EdgesBetweenSubgraphs(from_subgraph, to_subgraph, subspace, this);
+    return AddEdgesBetweenSubgraphs(std::unique_ptr<EdgesBetweenSubgraphs>(
+            new EdgesBetweenSubgraphs(from_subgraph, to_subgraph, subspace, this)));
+}
 
+EdgesBetweenSubgraphs& GcsTrajectoryOptimization::AddEdgesBetweenSubgraphs(
+        std::unique_ptr<EdgesBetweenSubgraphs> subgraph_edge) {
     // Add global continuity constraints to the edges between subgraphs.
     for (int continuity_order : global_path_continuity_constraints_) {
         if (subgraph_edge->from_subgraph_.order() >= continuity_order &&
@@ -1299,7 +1556,23 @@ EdgesBetweenSubgraphs& GcsTrajectoryOptimization::AddEdges(const Subgraph& from_
         }
     }
 
-    return *subgraph_edges_.emplace_back(subgraph_edge);
+    return *subgraph_edges_.emplace_back(std::move(subgraph_edge));
+}
+
+PathQuery& GcsTrajectoryOptimization::AddPathQuery(const Subgraph& start_regions, const Subgraph& goal_regions) {
+    ThrowIfSubgraphNotRegistered(start_regions);
+    ThrowIfSubgraphNotRegistered(goal_regions);
+    return *path_queries_.emplace_back(new PathQuery(start_regions, goal_regions, this));
+}
+
+void GcsTrajectoryOptimization::RemovePathQuery(const PathQuery& path_query) {
+    const auto it = std::find_if(path_queries_.begin(), path_queries_.end(), [&](const std::unique_ptr<PathQuery>& q) {
+        return q.get() == &path_query;
+    });
+    if (it == path_queries_.end()) {
+        throw std::runtime_error("PathQuery is not registered with `this`");
+    }
+    path_queries_.erase(it);
 }
 
 void GcsTrajectoryOptimization::AddTimeCost(double weight) {
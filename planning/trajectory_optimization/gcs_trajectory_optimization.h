@@ -398,10 +398,16 @@ public:
         std::vector<const geometry::optimization::GraphOfConvexSets::Edge*> Edges() const;
 
     private:
-        EdgesBetweenSubgraphs(const Subgraph& from_subgraph,
-                              const Subgraph& to_subgraph,
-                              const geometry::optimization::ConvexSet* subspace,
-                              GcsTrajectoryOptimization* traj_opt);
+        /* If `edge_data` is non-null, it lists the pairs (i, j) of regions of
+        the from and to subgraphs to connect, with the offset of region j from
+        region i (see CalcPairwiseIntersections()). Otherwise the intersecting
+        pairs are computed. */
+        EdgesBetweenSubgraphs(
+                const Subgraph& from_subgraph,
+                const Subgraph& to_subgraph,
+                const geometry::optimization::ConvexSet* subspace,
+                GcsTrajectoryOptimization* traj_opt,
+                const std::vector<std::tuple<int, int, Eigen::VectorXd>>* edge_data = nullptr);
 
         /* Convenience accessor, for brevity. */
         int num_positions() const { return traj_opt_.num_positions(); }
@@ -441,6 +447,125 @@ public:
         friend class GcsTrajectoryOptimization;
     };
 
+    /** A PathQuery solves a sequence of shortest path problems between start
+    and goal points on the same graph, as in online replanning, where the regions,
+    edges, costs and constraints stay fixed and only the endpoints change.
+
+    For each call to Solve(), the start point is added as a subgraph of order
+    zero with an edge to each region of the `start_regions` subgraph that
+    contains it, and the goal point likewise with an edge from each region of
+    the `goal_regions` subgraph that contains it. Containment is checked
+    directly (taking continuous revolute joints into account) rather than by
+    the pairwise intersection programs of AddEdges(), using bounding boxes of the
+    regions that are computed once, when the query is created. The point
+    subgraphs are removed again before Solve() returns, so the rest of the
+    graph, and the parts of the shortest path program that the
+    GraphOfConvexSets caches on its vertices and edges, are reused from one
+    query to the next.
+
+    The convex relaxation can't be warm started by the solvers supported by
+    GraphOfConvexSets. Instead, if `reuse_previous_path` is set and the regions
+    of the previous solution's path still contain the new start and goal, Solve()
+    first solves the convex restriction along that path, with the previous
+    solution as the initial guess (which is used by nonlinear solvers, and
+    ignored by conic ones). This is typically much faster than solving the full
+    problem, and, for the small changes in the endpoints between consecutive
+    queries of a replanning loop, often finds the same path that the full
+    problem would. If the restriction fails, Solve() falls back to the full
+    problem.
+
+    A PathQuery is created by AddPathQuery(), and is removed when either of its
+    subgraphs is removed. Calls to Solve() temporarily modify the
+    GcsTrajectoryOptimization, so they must not be made concurrently with each
+    other or with other calls on it.
+    */
+    class PathQuery final {
+    public:
+        DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PathQuery);
+
+        ~PathQuery();
+
+        /** Returns the subgraph whose regions the start points connect to. */
+        const Subgraph& start_regions() const { return start_regions_; }
+
+        /** Returns the subgraph whose regions the goal points connect to. */
+        const Subgraph& goal_regions() const { return goal_regions_; }
+
+        /** Solves for a trajectory from `start` to `goal`.
+        @param options include all settings for solving the shortest path
+        problem. The defaults of SolvePath() are used for unset options, except
+        that `options.preprocessing = false` by default: the start and goal only
+        connect to the regions that contain them, and edges that can't be on any
+        path are pruned regardless.
+        @returns the trajectory and the result of the last program solved. If no
+        region contains `start` or `goal`, the trajectory is empty and the result
+        is kInfeasibleConstraints.
+        @throws std::exception if `start` or `goal` has the wrong size.
+        */
+        std::pair<trajectories::CompositeTrajectory<double>, solvers::MathematicalProgramResult> Solve(
+                const Eigen::Ref<const Eigen::VectorXd>& start,
+                const Eigen::Ref<const Eigen::VectorXd>& goal,
+                const geometry::optimization::GraphOfConvexSetsOptions& options = {});
+
+        /** Sets whether Solve() first tries the convex restriction along the
+        path of the previous solution. False by default. */
+        void set_reuse_previous_path(bool reuse_previous_path) { reuse_previous_path_ = reuse_previous_path; }
+
+        /** Returns whether Solve() first tries the convex restriction along the
+        path of the previous solution. */
+        bool reuse_previous_path() const { return reuse_previous_path_; }
+
+        /** Forgets the previous solution, so that the next call to Solve()
+        solves the full problem. */
+        void ClearPreviousPath();
+
+    private:
+        PathQuery(const Subgraph& start_regions, const Subgraph& goal_regions, GcsTrajectoryOptimization* traj_opt);
+
+        /* Returns the regions of `regions` (by index) that contain `point` if
+        `point_is_from`, or otherwise that `point` is in, with the offset of the
+        head of the edge from its tail. */
+        std::vector<std::tuple<int, int, Eigen::VectorXd>> FindContainingRegions(
+                const Subgraph& regions,
+                const std::vector<std::vector<std::pair<double, double>>>& regions_bbox,
+                const Eigen::VectorXd& point,
+                bool point_is_from) const;
+
+        /* Solves the convex restriction along the previous path, if it is still
+        valid for `source` and `target`. Returns nullopt if it isn't, or if the
+        restriction fails. */
+        std::optional<std::pair<trajectories::CompositeTrajectory<double>, solvers::MathematicalProgramResult>>
+        SolvePreviousPath(const Subgraph& source,
+                          const Subgraph& target,
+                          const geometry::optimization::GraphOfConvexSetsOptions& options);
+
+        /* Records the path of `result` from `source` to `target`. */
+        void RecordPath(const Subgraph& source,
+                        const Subgraph& target,
+                        const solvers::MathematicalProgramResult& result);
+
+        GcsTrajectoryOptimization& traj_opt_;
+        const Subgraph& start_regions_;
+        const Subgraph& goal_regions_;
+
+        // The bounding boxes of the regions along the continuous revolute
+        // joints.
+        std::vector<std::vector<std::pair<double, double>>> start_regions_bbox_;
+        std::vector<std::vector<std::pair<double, double>>> goal_regions_bbox_;
+
+        bool reuse_previous_path_{false};
+
+        // The previous path: the indices of its first region in start_regions_
+        // and last region in goal_regions_, the edges between them, and the
+        // solution along it.
+        int previous_start_region_{-1};
+        int previous_goal_region_{-1};
+        std::vector<geometry::optimization::GraphOfConvexSets::EdgeId> previous_edges_;
+        std::optional<solvers::MathematicalProgramResult> previous_result_;
+
+        friend class GcsTrajectoryOptimization;
+    };
+
     /** Returns the number of position variables. */
     int num_positions() const { return num_positions_; }
 
@@ -558,6 +683,23 @@ public:
                                     const Subgraph& to_subgraph,
                                     const geometry::optimization::ConvexSet* subspace = nullptr);
 
+    /** Creates a PathQuery for repeatedly solving for trajectories from a start
+    point in one of the regions of `start_regions` to a goal point in one of the
+    regions of `goal_regions`.
+    @param start_regions must have been created from a call to AddRegions() on
+    this object.
+    @param goal_regions must have been created from a call to AddRegions() on
+    this object. It may be the same as `start_regions`.
+    @throws std::exception if either subgraph is not registered with `this`.
+    */
+    PathQuery& AddPathQuery(const Subgraph& start_regions, const Subgraph& goal_regions);
+
+    /** Removes a path query.
+    @pre The path query must have been created from a call to AddPathQuery() on
+      this object.
+    */
+    void RemovePathQuery(const PathQuery& path_query);
+
     /** Adds a minimum time cost to all regions in the whole graph. The cost is
     the sum of the time scaling variables.
 
@@ -815,6 +957,13 @@ private:
             std::vector<const geometry::optimization::GraphOfConvexSets::Edge*> edges,
             const solvers::MathematicalProgramResult& result);
 
+    // Adds the global continuity constraints to `subgraph_edge`, and takes
+    // ownership of it.
+    EdgesBetweenSubgraphs& AddEdgesBetweenSubgraphs(std::unique_ptr<EdgesBetweenSubgraphs> subgraph_edge);
+
+    // Throws if `subgraph` is not registered with `this`.
+    void ThrowIfSubgraphNotRegistered(const Subgraph& subgraph) const;
+
     // Adds a Edge to gcs_ with the name "{u.name} -> {v.name}".
     geometry::optimization::GraphOfConvexSets::Edge* AddEdge(geometry::optimization::GraphOfConvexSets::Vertex* u,
                                                              geometry::optimization::GraphOfConvexSets::Vertex* v);
@@ -825,6 +974,7 @@ private:
     std::vector<std::unique_ptr<Subgraph>> subgraphs_;
     std::vector<std::unique_ptr<EdgesBetweenSubgraphs>> subgraph_edges_;
     std::map<const geometry::optimization::GraphOfConvexSets::Vertex*, Subgraph*> vertex_to_subgraph_;
+    std::vector<std::unique_ptr<PathQuery>> path_queries_;
     std::vector<double> global_time_costs_;
     std::vector<Eigen::MatrixXd> global_path_length_costs_;
     std::vector<std::pair<Eigen::VectorXd, Eigen::VectorXd>> global_velocity_bounds_{};
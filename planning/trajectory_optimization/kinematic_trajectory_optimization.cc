@@ -2,11 +2,15 @@
 
 #include <algorithm>
 #include <limits>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
+#include <common_robotics_utilities/parallelism.hpp>
+
 #include "common/pointer_cast.h"
+#include "common/ssize.h"
 #include "common/symbolic/decompose.h"
 #include "common/text_logging.h"
 #include "math/autodiff_gradient.h"
@@ -24,6 +28,7 @@ namespace trajectory_optimization {
 
 using math::BsplineBasis;
 using math::EigenToStdVector;
+using math::ExtractGradient;
 using math::ExtractValue;
 using math::InitializeAutoDiff;
 using math::StdVectorToEigen;
@@ -42,6 +47,73 @@ using trajectories::BsplineTrajectory;
 
 namespace {
 
+using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::ParallelForBackend;
+using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
+
+/* Evaluates `constraint` at z, whose gradient with respect to the caller's
+variables is `z_gradient`, by differentiating `constraint` with respect to z
+only and applying the chain rule. This is much cheaper than propagating the
+caller's derivatives through `constraint` when z has fewer entries than there
+are variables. */
+AutoDiffVecXd EvalWithChainRule(const Constraint& constraint, const VectorXd& z_value, const MatrixXd& z_gradient) {
+    AutoDiffVecXd y_z;
+    constraint.Eval(InitializeAutoDiff(z_value), &y_z);
+    return InitializeAutoDiff(ExtractValue(y_z), ExtractGradient(y_z, z_value.size()) * z_gradient);
+}
+
+/* Returns the gradient sparsity pattern of `wrapped_constraint`(z(x)), offset
+by `row_offset` rows, where entry j of z depends only on the entries
+`z_dependencies[j]` of x. */
+std::vector<std::pair<int, int>> ComposeGradientSparsityPattern(const Constraint& wrapped_constraint,
+                                                                const std::vector<std::vector<int>>& z_dependencies,
+                                                                int row_offset = 0) {
+    DRAKE_DEMAND(ssize(z_dependencies) == wrapped_constraint.num_vars());
+    std::set<std::pair<int, int>> pattern;
+    const auto add_entries = [&](int row, int j) {
+        for (const int column : z_dependencies[j]) {
+            pattern.emplace(row_offset + row, column);
+        }
+    };
+    if (wrapped_constraint.gradient_sparsity_pattern().has_value()) {
+        for (const auto& [row, j] : *wrapped_constraint.gradient_sparsity_pattern()) {
+            add_entries(row, j);
+        }
+    } else {
+        for (int row = 0; row < wrapped_constraint.num_outputs(); ++row) {
+            for (int j = 0; j < wrapped_constraint.num_vars(); ++j) {
+                add_entries(row, j);
+            }
+        }
+    }
+    return std::vector<std::pair<int, int>>(pattern.begin(), pattern.end());
+}
+
+/* Sets `pattern` as the gradient sparsity pattern of `constraint`, unless it is
+dense. */
+void MaybeSetGradientSparsityPattern(const std::vector<std::pair<int, int>>& pattern, Constraint* constraint) {
+    if (ssize(pattern) < constraint->num_outputs() * constraint->num_vars()) {
+        constraint->SetGradientSparsityPattern(pattern);
+    }
+}
+
+/* Returns the indices of the control points whose basis functions are active
+at `s`, and the values of those basis functions. */
+std::pair<std::vector<int>, std::vector<double>> EvaluateActiveBasisFunctions(const BsplineBasis<double>& basis,
+                                                                              double s) {
+    std::vector<int> indices = basis.ComputeActiveBasisFunctionIndices(s);
+    std::vector<double> values;
+    values.reserve(indices.size());
+    for (const int i : indices) {
+        values.push_back(basis.EvaluateBasisFunctionI(i, s));
+    }
+    return {std::move(indices), std::move(values)};
+}
+
+/* Implements a constraint of the form
+  wrapped_constraint(r), where
+  r = ∑ᵢ basis_function_values[i] * x[i*num_vars:(i+1)*num_vars]
+and num_vars = wrapped_constraint->num_vars(). */
 class PathConstraint : public Constraint {
 public:
     PathConstraint(std::shared_ptr<Constraint> wrapped_constraint, std::vector<double> basis_function_values)
@@ -50,22 +122,38 @@ public:
                      wrapped_constraint->lower_bound(),
                      wrapped_constraint->upper_bound()),
           wrapped_constraint_(wrapped_constraint),
-          basis_function_values_(std::move(basis_function_values)) {}
+          basis_function_values_(std::move(basis_function_values)) {
+        // Entry j of r depends on entry j of each term.
+        const int num_vars = wrapped_constraint_->num_vars();
+        std::vector<std::vector<int>> r_dependencies(num_vars);
+        for (int j = 0; j < num_vars; ++j) {
+            for (int i = 0; i < ssize(basis_function_values_); ++i) {
+                r_dependencies[j].push_back(i * num_vars + j);
+            }
+        }
+        MaybeSetGradientSparsityPattern(ComposeGradientSparsityPattern(*wrapped_constraint_, r_dependencies), this);
+    }
 
     void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const override {
-        AutoDiffVecXd y_t;
-        Eval(InitializeAutoDiff(x), &y_t);
-        *y = ExtractValue(y_t);
+        const int num_vars = wrapped_constraint_->num_vars();
+        VectorXd r = VectorXd::Zero(num_vars);
+        for (int i = 0; i < ssize(basis_function_values_); ++i) {
+            r += basis_function_values_[i] * x.segment(i * num_vars, num_vars);
+        }
+        wrapped_constraint_->Eval(r, y);
     }
 
     void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const override {
-        AutoDiffVecXd x_sum = basis_function_values_[0] * x.segment(0, wrapped_constraint_->num_vars());
-        const int num_terms = basis_function_values_.size();
-        for (int i = 1; i < num_terms; ++i) {
-            x_sum += basis_function_values_[i] *
-                     x.segment(i * wrapped_constraint_->num_vars(), wrapped_constraint_->num_vars());
+        const int num_vars = wrapped_constraint_->num_vars();
+        const VectorXd x_value = ExtractValue(x);
+        const MatrixXd x_gradient = ExtractGradient(x);
+        VectorXd r = VectorXd::Zero(num_vars);
+        MatrixXd r_gradient = MatrixXd::Zero(num_vars, x_gradient.cols());
+        for (int i = 0; i < ssize(basis_function_values_); ++i) {
+            r += basis_function_values_[i] * x_value.segment(i * num_vars, num_vars);
+            r_gradient += basis_function_values_[i] * x_gradient.middleRows(i * num_vars, num_vars);
         }
-        wrapped_constraint_->Eval(x_sum, y);
+        *y = EvalWithChainRule(*wrapped_constraint_, r, r_gradient);
     }
 
     void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&, VectorX<symbolic::Expression>*) const override {
@@ -77,6 +165,95 @@ private:
     std::vector<double> basis_function_values_;
 };
 
+/* Implements the constraints
+  wrapped_constraint(r(sₖ)) for each sample sₖ, where
+  r(sₖ) = ∑ᵢ bᵢ(sₖ) x[i*num_positions:(i+1)*num_positions]
+and x are all of the control points. The active basis functions at each sample
+are evaluated once, on construction, and the gradient sparsity pattern reports
+that each sample only depends on their control points. The samples are
+evaluated on up to parallelism.num_threads() threads. */
+class PathSamplesConstraint : public Constraint {
+public:
+    PathSamplesConstraint(std::shared_ptr<Constraint> wrapped_constraint,
+                          const BsplineBasis<double>& basis,
+                          const std::vector<double>& s,
+                          Parallelism parallelism)
+        : Constraint(ssize(s) * wrapped_constraint->num_outputs(),
+                     basis.num_basis_functions() * wrapped_constraint->num_vars(),
+                     wrapped_constraint->lower_bound().replicate(ssize(s), 1),
+                     wrapped_constraint->upper_bound().replicate(ssize(s), 1)),
+          wrapped_constraint_(wrapped_constraint),
+          parallelism_(parallelism) {
+        const int num_positions = wrapped_constraint_->num_vars();
+        std::vector<std::pair<int, int>> pattern;
+        std::vector<std::vector<int>> r_dependencies(num_positions);
+        for (int k = 0; k < ssize(s); ++k) {
+            auto [indices, values] = EvaluateActiveBasisFunctions(basis, s[k]);
+            for (int j = 0; j < num_positions; ++j) {
+                r_dependencies[j].clear();
+                for (const int i : indices) {
+                    r_dependencies[j].push_back(i * num_positions + j);
+                }
+            }
+            const std::vector<std::pair<int, int>> sample_pattern = ComposeGradientSparsityPattern(
+                    *wrapped_constraint_, r_dependencies, k * wrapped_constraint_->num_outputs());
+            pattern.insert(pattern.end(), sample_pattern.begin(), sample_pattern.end());
+            active_indices_.push_back(std::move(indices));
+            basis_function_values_.push_back(std::move(values));
+        }
+        MaybeSetGradientSparsityPattern(pattern, this);
+    }
+
+    void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const override {
+        const int num_positions = wrapped_constraint_->num_vars();
+        const int num_outputs = wrapped_constraint_->num_outputs();
+        y->resize(this->num_outputs());
+        const auto sample_work = [&](const int, const int64_t k) {
+            VectorXd r = VectorXd::Zero(num_positions);
+            for (int i = 0; i < ssize(active_indices_[k]); ++i) {
+                r += basis_function_values_[k][i] * x.segment(active_indices_[k][i] * num_positions, num_positions);
+            }
+            VectorXd y_k;
+            wrapped_constraint_->Eval(r, &y_k);
+            y->segment(k * num_outputs, num_outputs) = y_k;
+        };
+        StaticParallelForIndexLoop(DegreeOfParallelism(parallelism_.num_threads()), 0, ssize(active_indices_),
+                                   sample_work, ParallelForBackend::BEST_AVAILABLE);
+    }
+
+    void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const override {
+        const int num_positions = wrapped_constraint_->num_vars();
+        const int num_outputs = wrapped_constraint_->num_outputs();
+        const VectorXd x_value = ExtractValue(x);
+        const MatrixXd x_gradient = ExtractGradient(x);
+        y->resize(this->num_outputs());
+        const auto sample_work = [&](const int, const int64_t k) {
+            VectorXd r = VectorXd::Zero(num_positions);
+            MatrixXd r_gradient = MatrixXd::Zero(num_positions, x_gradient.cols());
+            for (int i = 0; i < ssize(active_indices_[k]); ++i) {
+                const int offset = active_indices_[k][i] * num_positions;
+                r += basis_function_values_[k][i] * x_value.segment(offset, num_positions);
+                r_gradient += basis_function_values_[k][i] * x_gradient.middleRows(offset, num_positions);
+            }
+            y->segment(k * num_outputs, num_outputs) = EvalWithChainRule(*wrapped_constraint_, r, r_gradient);
+        };
+        StaticParallelForIndexLoop(DegreeOfParallelism(parallelism_.num_threads()), 0, ssize(active_indices_),
+                                   sample_work, ParallelForBackend::BEST_AVAILABLE);
+    }
+
+    void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&, VectorX<symbolic::Expression>*) const override {
+        throw std::runtime_error("PathSamplesConstraint does not support evaluation with Expression.");
+    }
+
+private:
+    std::shared_ptr<Constraint> wrapped_constraint_;
+    const Parallelism parallelism_;
+    // The indices of the control points whose basis functions are active at
+    // each sample, and the values of those basis functions.
+    std::vector<std::vector<int>> active_indices_;
+    std::vector<std::vector<double>> basis_function_values_;
+};
+
 /* Implements a constraint of the form
   wrapped_constraint([q, v]), where
   duration = x[0]
@@ -84,7 +261,8 @@ private:
   v = M_vel * x[-num_vel_vars:] / duration
 
   TODO(russt): M_pos and M_vel are predictably sparse, and we could handle that
-  here if performance demands it.
+  here if performance demands it. For now, only the gradient sparsity pattern
+  takes advantage of it.
 */
 class WrappedVelocityConstraint : public Constraint {
 public:
@@ -99,19 +277,47 @@ public:
           M_pos_{std::move(M_pos)},
           M_vel_{std::move(M_vel)} {
         DRAKE_DEMAND(M_pos_.rows() + M_vel_.rows() == wrapped_constraint_->num_vars());
+        // q depends on the position variables with nonzero coefficients, and v
+        // also on the duration.
+        std::vector<std::vector<int>> qv_dependencies(wrapped_constraint_->num_vars());
+        for (int j = 0; j < M_pos_.rows(); ++j) {
+            for (int c = 0; c < M_pos_.cols(); ++c) {
+                if (M_pos_(j, c) != 0) {
+                    qv_dependencies[j].push_back(1 + c);
+                }
+            }
+        }
+        for (int j = 0; j < M_vel_.rows(); ++j) {
+            std::vector<int>& dependencies = qv_dependencies[M_pos_.rows() + j];
+            dependencies.push_back(0);
+            for (int c = 0; c < M_vel_.cols(); ++c) {
+                if (M_vel_(j, c) != 0) {
+                    dependencies.push_back(1 + M_pos_.cols() + c);
+                }
+            }
+        }
+        MaybeSetGradientSparsityPattern(ComposeGradientSparsityPattern(*wrapped_constraint_, qv_dependencies), this);
     }
 
     void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const override {
-        AutoDiffVecXd y_t;
-        Eval(InitializeAutoDiff(x), &y_t);
-        *y = ExtractValue(y_t);
+        const double duration = x[0];
+        VectorXd qv(wrapped_constraint_->num_vars());
+        qv << M_pos_ * x.segment(1, M_pos_.cols()), M_vel_ * x.tail(M_vel_.cols()) / duration;
+        wrapped_constraint_->Eval(qv, y);
     }
 
     void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const override {
-        AutoDiffXd duration = x[0];
-        VectorX<AutoDiffXd> qv(wrapped_constraint_->num_vars());
-        qv << M_pos_ * x.segment(1, M_pos_.cols()), M_vel_ * x.tail(M_vel_.cols()) / duration;
-        wrapped_constraint_->Eval(qv, y);
+        const VectorXd x_value = ExtractValue(x);
+        const MatrixXd x_gradient = ExtractGradient(x);
+        const double duration = x_value[0];
+        const VectorXd rdot = M_vel_ * x_value.tail(M_vel_.cols());
+        VectorXd qv(wrapped_constraint_->num_vars());
+        qv << M_pos_ * x_value.segment(1, M_pos_.cols()), rdot / duration;
+        // d(ṙ/duration) = (dṙ - ṙ * dduration / duration) / duration.
+        MatrixXd qv_gradient(wrapped_constraint_->num_vars(), x_gradient.cols());
+        qv_gradient << M_pos_ * x_gradient.middleRows(1, M_pos_.cols()),
+                (M_vel_ * x_gradient.bottomRows(M_vel_.cols()) - rdot * x_gradient.row(0) / duration) / duration;
+        *y = EvalWithChainRule(*wrapped_constraint_, qv, qv_gradient);
     }
 
     void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&, VectorX<symbolic::Expression>*) const override {
@@ -232,21 +438,32 @@ Binding<Constraint> KinematicTrajectoryOptimization::AddPathPositionConstraint(
         const std::shared_ptr<Constraint>& constraint, double s) {
     DRAKE_DEMAND(constraint->num_vars() == num_positions_);
     DRAKE_DEMAND(0 <= s && s <= 1);
-    std::vector<double> basis_function_values;
-    basis_function_values.reserve(basis_.order());
-    std::vector<int> active_control_point_indices = basis_.ComputeActiveBasisFunctionIndices(s);
+    auto [active_control_point_indices, basis_function_values] = EvaluateActiveBasisFunctions(basis_, s);
     const int num_active_control_points = static_cast<int>(active_control_point_indices.size());
     VectorXDecisionVariable var_vector(num_active_control_points * num_positions());
     for (int i = 0; i < num_active_control_points; ++i) {
-        const int control_point_index = active_control_point_indices[i];
-        basis_function_values.push_back(basis_.EvaluateBasisFunctionI(control_point_index, s));
-        var_vector.segment(i * num_positions(), num_positions()) = control_points_.col(control_point_index);
+        var_vector.segment(i * num_positions(), num_positions()) = control_points_.col(active_control_point_indices[i]);
     }
     auto binding = prog_.AddConstraint(std::make_shared<PathConstraint>(constraint, basis_function_values), var_vector);
     binding.evaluator()->set_description("path position constraint");
     return binding;
 }
 
+Binding<Constraint> KinematicTrajectoryOptimization::AddPathPositionConstraints(
+        const std::shared_ptr<Constraint>& constraint, const std::vector<double>& s, Parallelism parallelism) {
+    DRAKE_DEMAND(constraint->num_vars() == num_positions_);
+    DRAKE_DEMAND(std::all_of(s.begin(), s.end(), [](double s_k) {
+        return 0 <= s_k && s_k <= 1;
+    }));
+    // The control points, column by column.
+    const VectorXDecisionVariable var_vector =
+            Eigen::Map<const VectorXDecisionVariable>(control_points_.data(), control_points_.size());
+    auto binding = prog_.AddConstraint(std::make_shared<PathSamplesConstraint>(constraint, basis_, s, parallelism),
+                                       var_vector);
+    binding.evaluator()->set_description("path position constraints");
+    return binding;
+}
+
 Binding<LinearConstraint> KinematicTrajectoryOptimization::AddPathVelocityConstraint(
         const Eigen::Ref<const Eigen::VectorXd>& lb, const Eigen::Ref<const Eigen::VectorXd>& ub, double s) {
     DRAKE_DEMAND(lb.size() == num_positions());
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "common/copyable_unique_ptr.h"
+#include "common/parallelism.h"
 #include "common/trajectories/bspline_trajectory.h"
 #include "solvers/binding.h"
 #include "solvers/mathematical_program.h"
@@ -114,6 +115,28 @@ public:
     solvers::Binding<solvers::Constraint> AddPathPositionConstraint(
             const std::shared_ptr<solvers::Constraint>& constraint, double s);
 
+    /** Adds a (generic) constraint on the path at each of the samples `s`, as a
+    single binding on all of the control points. This is equivalent to calling
+    AddPathPositionConstraint(constraint, sᵢ) for each sample, but is much
+    faster when there are many samples (e.g. for collision avoidance along the
+    path): the basis functions are evaluated at the samples once, the gradient
+    sparsity pattern reflects that r(sᵢ) only depends on the basis().order()
+    control points whose basis functions are nonzero at sᵢ, and the samples are
+    evaluated on up to `parallelism.num_threads()` threads.
+
+    Rows [i * m, (i + 1) * m) of the constraint, where m =
+    constraint.num_outputs(), are `constraint` evaluated at r(sᵢ).
+
+    @warning With more than one thread, `constraint` is evaluated concurrently,
+    so it must be safe to do so; e.g. it must not modify a Context that is
+    shared between evaluations.
+    @pre constraint.num_vars() == num_positions()
+    @pre 0 <= `sᵢ` <= 1 for each sample. */
+    solvers::Binding<solvers::Constraint> AddPathPositionConstraints(
+            const std::shared_ptr<solvers::Constraint>& constraint,
+            const std::vector<double>& s,
+            Parallelism parallelism = Parallelism::None());
+
     /** Adds a linear constraint on the derivative of the path, `lb` ≤ ṙ(s) ≤
     `ub`. Note that this does NOT directly constrain q̇(t).
     @pre 0 <= `s` <= 1. */
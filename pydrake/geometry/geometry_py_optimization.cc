@@ -538,6 +538,8 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.mixing_steps.doc)
         .def_readwrite("solver_options", &IrisOptions::solver_options,
             cls_doc.solver_options.doc)
+        .def_readwrite("parallelism", &IrisOptions::parallelism,
+            cls_doc.parallelism.doc)
         .def("__repr__", [](const IrisOptions& self) {
           return py::str(
               "IrisOptions("
@@ -644,6 +646,8 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.flow_tolerance.doc)
         .def_readwrite("rounding_seed",
             &GraphOfConvexSetsOptions::rounding_seed, cls_doc.rounding_seed.doc)
+        .def_readwrite("parallelism", &GraphOfConvexSetsOptions::parallelism,
+            cls_doc.parallelism.doc)
         .def_property("solver_options",
             py::cpp_function(
                 [](GraphOfConvexSetsOptions& self) {
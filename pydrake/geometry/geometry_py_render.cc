@@ -12,6 +12,7 @@
 #include "geometry/render/render_label.h"
 #include "geometry/render_gl/factory.h"
 #include "geometry/render_gltf_client/factory.h"
+#include "geometry/render_raster/factory.h"
 #include "geometry/render_vtk/factory.h"
 
 namespace drake {
@@ -423,6 +424,21 @@ void DoScalarIndependentDefinitions(py::module m) {
       py::arg("params") = RenderEngineGltfClientParams(),
       doc_geometry.MakeRenderEngineGltfClient.doc);
 
+  {
+    using Class = RenderEngineRasterParams;
+    constexpr auto& cls_doc = doc_geometry.RenderEngineRasterParams;
+    py::class_<Class> cls(m, "RenderEngineRasterParams", cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  m.def("MakeRenderEngineRaster", &MakeRenderEngineRaster,
+      py::arg("params") = RenderEngineRasterParams(),
+      doc_geometry.MakeRenderEngineRaster.doc);
+
   AddValueInstantiation<RenderLabel>(m);
 }
 }  // namespace
@@ -128,7 +128,34 @@ void init_perception(py::module m) {
         .def("EstimateNormals", &Class::EstimateNormals, py::arg("radius"),
             py::arg("num_closest"), py::arg("parallelize") = false,
             py::call_guard<py::gil_scoped_release>(),
-            cls_doc.EstimateNormals.doc);
+            cls_doc.EstimateNormals.doc)
+        .def(
+            "FindNearestNeighbors",
+            [](const Class& self,
+                const Eigen::Ref<const Matrix3X<Class::T>>& queries,
+                int num_neighbors, Parallelism parallelize) {
+              MatrixX<int> indices;
+              MatrixX<Class::T> squared_distances;
+              self.FindNearestNeighbors(queries, num_neighbors, &indices,
+                  &squared_distances, parallelize);
+              return std::make_pair(indices, squared_distances);
+            },
+            py::arg("queries"), py::arg("num_neighbors"),
+            py::arg("parallelize") = false,
+            py::call_guard<py::gil_scoped_release>(),
+            (std::string(cls_doc.FindNearestNeighbors.doc) +
+                "\n\nReturns the tuple (indices, squared_distances).")
+                .c_str())
+        .def("FindNeighborsWithinRadius", &Class::FindNeighborsWithinRadius,
+            py::arg("queries"), py::arg("radius"),
+            py::arg("parallelize") = false,
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.FindNeighborsWithinRadius.doc)
+        .def("BuildSpatialIndex", &Class::BuildSpatialIndex,
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.BuildSpatialIndex.doc)
+        .def("has_spatial_index", &Class::has_spatial_index,
+            cls_doc.has_spatial_index.doc);
   }
 
   AddValueInstantiation<PointCloud>(m);
@@ -1,7 +1,9 @@
 #include "pydrake/documentation_pybind.h"
 #include "pydrake/pydrake_pybind.h"
 #include "planning/graph_algorithms/max_clique_solver_base.h"
+#include "planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
 #include "planning/graph_algorithms/max_clique_solver_via_greedy.h"
+#include "planning/graph_algorithms/max_clique_solver_via_local_search.h"
 #include "planning/graph_algorithms/max_clique_solver_via_mip.h"
 
 namespace drake {
@@ -55,6 +57,48 @@ void DefinePlanningGraphAlgorithms(py::module m) {
         m, "MaxCliqueSolverViaGreedy", cls_doc.doc)
         .def(py::init<>(), cls_doc.ctor.doc);
   }
+  {
+    const auto& cls_doc = doc.MaxCliqueSolverViaBranchAndBound;
+    py::class_<MaxCliqueSolverViaBranchAndBound, MaxCliqueSolverBase>(
+        m, "MaxCliqueSolverViaBranchAndBound", cls_doc.doc)
+        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<std::optional<int64_t>>(), py::arg("max_branches"),
+            cls_doc.ctor.doc)
+        .def("SetMaxBranches",
+            &MaxCliqueSolverViaBranchAndBound::SetMaxBranches,
+            py::arg("max_branches"), cls_doc.SetMaxBranches.doc)
+        .def("GetMaxBranches",
+            &MaxCliqueSolverViaBranchAndBound::GetMaxBranches,
+            cls_doc.GetMaxBranches.doc);
+  }
+  {
+    const auto& cls_doc = doc.MaxCliqueSolverViaLocalSearch;
+    py::class_<MaxCliqueSolverViaLocalSearch, MaxCliqueSolverBase>(
+        m, "MaxCliqueSolverViaLocalSearch", cls_doc.doc)
+        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<int, int, Parallelism, int>(), py::arg("num_starts"),
+            py::arg("max_steps_per_start"),
+            py::arg("parallelism") = Parallelism::Max(),
+            py::arg("random_seed") = 1234, cls_doc.ctor.doc)
+        .def("SetNumStarts", &MaxCliqueSolverViaLocalSearch::SetNumStarts,
+            py::arg("num_starts"), cls_doc.SetNumStarts.doc)
+        .def("GetNumStarts", &MaxCliqueSolverViaLocalSearch::GetNumStarts,
+            cls_doc.GetNumStarts.doc)
+        .def("SetMaxStepsPerStart",
+            &MaxCliqueSolverViaLocalSearch::SetMaxStepsPerStart,
+            py::arg("max_steps_per_start"), cls_doc.SetMaxStepsPerStart.doc)
+        .def("GetMaxStepsPerStart",
+            &MaxCliqueSolverViaLocalSearch::GetMaxStepsPerStart,
+            cls_doc.GetMaxStepsPerStart.doc)
+        .def("SetParallelism", &MaxCliqueSolverViaLocalSearch::SetParallelism,
+            py::arg("parallelism"), cls_doc.SetParallelism.doc)
+        .def("GetParallelism", &MaxCliqueSolverViaLocalSearch::GetParallelism,
+            cls_doc.GetParallelism.doc)
+        .def("SetRandomSeed", &MaxCliqueSolverViaLocalSearch::SetRandomSeed,
+            py::arg("random_seed"), cls_doc.SetRandomSeed.doc)
+        .def("GetRandomSeed", &MaxCliqueSolverViaLocalSearch::GetRandomSeed,
+            cls_doc.GetRandomSeed.doc);
+  }
 }
 
 }  // namespace internal
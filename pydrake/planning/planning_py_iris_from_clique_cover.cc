@@ -40,7 +40,13 @@ void DefinePlanningIrisFromCliqueCover(py::module m) {
           cls_doc.rank_tol_for_minimum_volume_circumscribed_ellipsoid.doc)
       .def_readwrite("point_in_set_tol",
           &IrisFromCliqueCoverOptions::point_in_set_tol,
-          cls_doc.point_in_set_tol.doc);
+          cls_doc.point_in_set_tol.doc)
+      .def_readwrite("max_points_per_shard",
+          &IrisFromCliqueCoverOptions::max_points_per_shard,
+          cls_doc.max_points_per_shard.doc)
+      .def_readwrite("checkpoint_file",
+          &IrisFromCliqueCoverOptions::checkpoint_file,
+          cls_doc.checkpoint_file.doc);
 
   m.def(
       "IrisInConfigurationSpaceFromCliqueCover",
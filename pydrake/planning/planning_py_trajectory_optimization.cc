@@ -311,6 +311,10 @@ void DefinePlanningTrajectoryOptimization(py::module m) {
                 double>(&Class::AddPathPositionConstraint),
             py::arg("constraint"), py::arg("s"),
             cls_doc.AddPathPositionConstraint.doc_2args)
+        .def("AddPathPositionConstraints",
+            &Class::AddPathPositionConstraints, py::arg("constraint"),
+            py::arg("s"), py::arg("parallelism") = Parallelism::None(),
+            cls_doc.AddPathPositionConstraints.doc)
         .def("AddPathVelocityConstraint", &Class::AddPathVelocityConstraint,
             py::arg("lb"), py::arg("ub"), py::arg("s"),
             cls_doc.AddPathVelocityConstraint.doc)
@@ -430,6 +434,28 @@ void DefinePlanningTrajectoryOptimization(py::module m) {
                 &Class::EdgesBetweenSubgraphs::Edges),
             py_rvp::reference_internal, subgraph_edges_doc.Edges.doc);
 
+    // PathQuery
+    const auto& path_query_doc = doc.GcsTrajectoryOptimization.PathQuery;
+    py::class_<Class::PathQuery>(
+        gcs_traj_opt, "PathQuery", path_query_doc.doc)
+        .def("start_regions", &Class::PathQuery::start_regions,
+            py_rvp::reference_internal, path_query_doc.start_regions.doc)
+        .def("goal_regions", &Class::PathQuery::goal_regions,
+            py_rvp::reference_internal, path_query_doc.goal_regions.doc)
+        .def("Solve", &Class::PathQuery::Solve, py::arg("start"),
+            py::arg("goal"),
+            py::arg("options") =
+                geometry::optimization::GraphOfConvexSetsOptions(),
+            path_query_doc.Solve.doc)
+        .def("set_reuse_previous_path",
+            &Class::PathQuery::set_reuse_previous_path,
+            py::arg("reuse_previous_path"),
+            path_query_doc.set_reuse_previous_path.doc)
+        .def("reuse_previous_path", &Class::PathQuery::reuse_previous_path,
+            path_query_doc.reuse_previous_path.doc)
+        .def("ClearPreviousPath", &Class::PathQuery::ClearPreviousPath,
+            path_query_doc.ClearPreviousPath.doc);
+
     gcs_traj_opt  // BR
         .def(py::init<int, const std::vector<int>&>(), py::arg("num_positions"),
             py::arg("continuous_revolute_joints") = std::vector<int>(),
@@ -475,6 +501,11 @@ void DefinePlanningTrajectoryOptimization(py::module m) {
         .def("AddEdges", &Class::AddEdges, py_rvp::reference_internal,
             py::arg("from_subgraph"), py::arg("to_subgraph"),
             py::arg("subspace") = py::none(), cls_doc.AddEdges.doc)
+        .def("AddPathQuery", &Class::AddPathQuery, py_rvp::reference_internal,
+            py::arg("start_regions"), py::arg("goal_regions"),
+            cls_doc.AddPathQuery.doc)
+        .def("RemovePathQuery", &Class::RemovePathQuery,
+            py::arg("path_query"), cls_doc.RemovePathQuery.doc)
         .def("AddTimeCost", &Class::AddTimeCost, py::arg("weight") = 1.0,
             cls_doc.AddTimeCost.doc)
         .def("AddPathLengthCost",
@@ -9,6 +9,7 @@
 #include "systems/analysis/batch_eval.h"
 #include "systems/analysis/integrator_base.h"
 #include "systems/analysis/monte_carlo.h"
+#include "systems/analysis/realtime_statistics.h"
 #include "systems/analysis/region_of_attraction.h"
 #include "systems/analysis/runge_kutta2_integrator.h"
 #include "systems/analysis/runge_kutta3_integrator.h"
@@ -86,6 +87,36 @@ PYBIND11_MODULE(analysis, m) {
             cls_doc.IsIdenticalStatus.doc);
   }
 
+  {
+    using Class = RealtimeStatistics;
+    constexpr auto& cls_doc = pydrake_doc.drake.systems.RealtimeStatistics;
+    py::class_<Class> cls(m, "RealtimeStatistics", cls_doc.doc);
+    cls.attr("kNumBuckets") = Class::kNumBuckets;
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc)
+        .def_static("bucket_upper_bound", &Class::bucket_upper_bound,
+            py::arg("bucket"), cls_doc.bucket_upper_bound.doc)
+        .def("num_steps", &Class::num_steps, cls_doc.num_steps.doc)
+        .def("num_deadline_misses", &Class::num_deadline_misses,
+            cls_doc.num_deadline_misses.doc)
+        .def("max_lateness", &Class::max_lateness, cls_doc.max_lateness.doc)
+        .def("mean_lateness", &Class::mean_lateness, cls_doc.mean_lateness.doc)
+        .def("max_step_duration", &Class::max_step_duration,
+            cls_doc.max_step_duration.doc)
+        .def("lateness_histogram", &Class::lateness_histogram,
+            cls_doc.lateness_histogram.doc)
+        .def("step_duration_histogram", &Class::step_duration_histogram,
+            cls_doc.step_duration_histogram.doc)
+        .def("LatenessQuantileUpperBound", &Class::LatenessQuantileUpperBound,
+            py::arg("quantile"), cls_doc.LatenessQuantileUpperBound.doc)
+        .def("RecordStepStart", &Class::RecordStepStart, py::arg("lateness"),
+            py::arg("tolerance"), cls_doc.RecordStepStart.doc)
+        .def("RecordStepDuration", &Class::RecordStepDuration,
+            py::arg("duration"), cls_doc.RecordStepDuration.doc)
+        .def("Reset", &Class::Reset, cls_doc.Reset.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     constexpr auto& cls_doc = pydrake_doc.drake.systems.InitializeParams;
     using Class = InitializeParams;
@@ -327,6 +358,20 @@ Parameter ``interruptible``:
         .def("get_actual_realtime_rate",
             &Simulator<T>::get_actual_realtime_rate,
             doc.Simulator.get_actual_realtime_rate.doc)
+        .def("set_realtime_busy_wait", &Simulator<T>::set_realtime_busy_wait,
+            py::arg("duration"), doc.Simulator.set_realtime_busy_wait.doc)
+        .def("get_realtime_busy_wait", &Simulator<T>::get_realtime_busy_wait,
+            doc.Simulator.get_realtime_busy_wait.doc)
+        .def("set_realtime_deadline_tolerance",
+            &Simulator<T>::set_realtime_deadline_tolerance,
+            py::arg("tolerance"),
+            doc.Simulator.set_realtime_deadline_tolerance.doc)
+        .def("get_realtime_deadline_tolerance",
+            &Simulator<T>::get_realtime_deadline_tolerance,
+            doc.Simulator.get_realtime_deadline_tolerance.doc)
+        .def("get_realtime_statistics", &Simulator<T>::get_realtime_statistics,
+            py_rvp::reference_internal,
+            doc.Simulator.get_realtime_statistics.doc)
         .def("ResetStatistics", &Simulator<T>::ResetStatistics,
             doc.Simulator.ResetStatistics.doc)
         .def("get_num_publishes", &Simulator<T>::get_num_publishes,
@@ -432,6 +477,21 @@ Parameter ``interruptible``:
         py::arg("num_samples"), py::arg("generator"),
         doc.MonteCarloSimulation.doc);
 
+    // Note: Like MonteCarloSimulation, this hard-codes `parallelism` to be off.
+    m.def("StreamMonteCarloSimulation",
+        WrapCallbacks([](const SimulatorFactory make_simulator,
+                          const ScalarSystemFunction& output, double final_time,
+                          int num_samples,
+                          const MonteCarloResultCallback& on_result,
+                          RandomGenerator* generator) {
+          StreamMonteCarloSimulation(make_simulator, output, final_time,
+              num_samples, on_result, generator,
+              /* parallelism = */ Parallelism::None());
+        }),
+        py::arg("make_simulator"), py::arg("output"), py::arg("final_time"),
+        py::arg("num_samples"), py::arg("on_result"), py::arg("generator"),
+        doc.StreamMonteCarloSimulation.doc);
+
     {
       using Class = RegionOfAttractionOptions;
       constexpr auto& cls_doc = doc.RegionOfAttractionOptions;
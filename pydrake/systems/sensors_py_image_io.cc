@@ -96,12 +96,39 @@ void DefineSensorsImageIo(py::module m) {
             py::arg("image"), py::arg("format"), cls_doc.Save.doc_2args);
   }
 
+  {
+    py::enum_<ImageWriterEncoding>(
+        m, "ImageWriterEncoding", doc.ImageWriterEncoding.doc)
+        .value("kDefault", ImageWriterEncoding::kDefault,
+            doc.ImageWriterEncoding.kDefault.doc)
+        .value("kFastPng", ImageWriterEncoding::kFastPng,
+            doc.ImageWriterEncoding.kFastPng.doc)
+        .value("kNpy", ImageWriterEncoding::kNpy,
+            doc.ImageWriterEncoding.kNpy.doc);
+  }
+
+  {
+    using Class = ImageWriterParams;
+    constexpr auto& cls_doc = doc.ImageWriterParams;
+    py::class_<Class> cls(m, "ImageWriterParams", cls_doc.doc);
+    cls  // BR
+        .def(py::init<>())
+        .def_readwrite(
+            "num_threads", &Class::num_threads, cls_doc.num_threads.doc)
+        .def_readwrite("max_queue_size", &Class::max_queue_size,
+            cls_doc.max_queue_size.doc)
+        .def_readwrite("encoding", &Class::encoding, cls_doc.encoding.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = ImageWriter;
     constexpr auto& cls_doc = doc.ImageWriter;
     py::class_<Class, LeafSystem<double>> cls(m, "ImageWriter", cls_doc.doc);
     cls  // BR
-        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<const ImageWriterParams&>(), py::arg("params"),
+            cls_doc.ctor.doc_1args)
         .def(
             "DeclareImageInputPort",
             [](Class& self, PixelType pixel_type, std::string port_name,
@@ -116,7 +143,11 @@ void DefineSensorsImageIo(py::module m) {
             py::arg("start_time"), py_rvp::reference_internal,
             cls_doc.DeclareImageInputPort.doc)
         .def("ResetAllImageCounts", &Class::ResetAllImageCounts,
-            cls_doc.ResetAllImageCounts.doc);
+            cls_doc.ResetAllImageCounts.doc)
+        .def("Flush", &Class::Flush,
+            py::call_guard<py::gil_scoped_release>(), cls_doc.Flush.doc)
+        .def("params", &Class::params, py_rvp::reference_internal,
+            cls_doc.params.doc);
   }
 }
 
@@ -1,6 +1,8 @@
 #include "systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <stdexcept>
 
 #include "common/autodiff.h"
@@ -11,6 +13,25 @@
 
 namespace drake {
 namespace systems {
+namespace {
+
+// The number of Jacobians computed from a detected sparsity pattern before the
+// pattern is refreshed from a dense Jacobian.
+constexpr int kJacobianSparsityRefreshInterval = 50;
+
+// Computes the finite-difference increment for the state variable `xi`: `eps`
+// when |xi| is small and a fraction `eps` of |xi| otherwise.
+template <class T>
+T CalcDifferenceIncrement(const T& xi, double eps) {
+    using std::abs;
+    const T abs_xi = abs(xi);
+    if (abs_xi <= 1) {
+        return T(eps);
+    }
+    return eps * abs_xi;
+}
+
+}  // namespace
 
 template <class T>
 void ImplicitIntegrator<T>::DoResetStatistics() {
@@ -23,6 +44,7 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
     J_.resize(0, 0);
+    jacobian_sparsity_.reset();
     DoResetCachedJacobianRelatedMatrices();
     // Call any Reset() provided by child integrator classes.
     DoImplicitIntegratorReset();
@@ -195,14 +217,190 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
     }
 }
 
+template <class T>
+void ImplicitIntegrator<T>::UpdateJacobianSparsity(const MatrixX<T>& J) {
+    const int n = J.cols();
+    if (!jacobian_sparsity_.has_value() || static_cast<int>(jacobian_sparsity_->column_rows.size()) != n) {
+        jacobian_sparsity_.emplace();
+        jacobian_sparsity_->column_rows.resize(n);
+    }
+    JacobianSparsity& sparsity = *jacobian_sparsity_;
+
+    // Merge the nonzero entries of J into the pattern; an entry that is
+    // nonzero now is assumed to be (potentially) nonzero forever.
+    std::vector<std::vector<int>> row_columns(n);
+    for (int j = 0; j < n; ++j) {
+        std::vector<int>& rows = sparsity.column_rows[j];
+        for (int i = 0; i < n; ++i) {
+            if (J(i, j) != 0.0 && !std::binary_search(rows.begin(), rows.end(), i)) {
+                rows.insert(std::upper_bound(rows.begin(), rows.end(), i), i);
+            }
+        }
+        for (int i : rows) {
+            row_columns[i].push_back(j);
+        }
+    }
+
+    // Partition the columns into groups with no rows in common, using the
+    // greedy "largest first" coloring of the column intersection graph.
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sparsity](int a, int b) {
+        return sparsity.column_rows[a].size() > sparsity.column_rows[b].size();
+    });
+    sparsity.column_group.assign(n, -1);
+    sparsity.column_groups.clear();
+    // forbidden[g] == j marks group g as unavailable to column j.
+    std::vector<int> forbidden;
+    for (int j : order) {
+        for (int i : sparsity.column_rows[j]) {
+            for (int k : row_columns[i]) {
+                if (sparsity.column_group[k] >= 0) {
+                    forbidden[sparsity.column_group[k]] = j;
+                }
+            }
+        }
+        int group = 0;
+        while (group < static_cast<int>(forbidden.size()) && forbidden[group] == j) {
+            ++group;
+        }
+        if (group == static_cast<int>(forbidden.size())) {
+            forbidden.push_back(-1);
+            sparsity.column_groups.emplace_back();
+        }
+        sparsity.column_group[j] = group;
+        sparsity.column_groups[group].push_back(j);
+    }
+    DRAKE_LOGGER_DEBUG("  ImplicitIntegrator Jacobian sparsity: {} columns in {} groups", n,
+                       sparsity.column_groups.size());
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeGroupedJacobian(
+        JacobianComputationScheme scheme, const T& t, const VectorX<T>& xt, Context<T>* context, MatrixX<T>* J) {
+    DRAKE_DEMAND(jacobian_sparsity_.has_value());
+    const JacobianSparsity& sparsity = *jacobian_sparsity_;
+    const int n = xt.size();
+    DRAKE_DEMAND(static_cast<int>(sparsity.column_rows.size()) == n);
+
+    DRAKE_LOGGER_DEBUG("  ImplicitIntegrator Compute grouped {}-Jacobian ({} groups) t={}", n,
+                       sparsity.column_groups.size(), t);
+
+    J->setZero(n, n);
+    if (scheme == JacobianComputationScheme::kAutomatic) {
+        if constexpr (std::is_same_v<T, double>) {
+            // Seed one derivative direction per group: the derivatives of f
+            // along direction g are the sums of the columns in group g, which
+            // have no rows in common.
+            const int num_groups = sparsity.column_groups.size();
+            VectorX<AutoDiffXd> a_xt(n);
+            for (int j = 0; j < n; ++j) {
+                a_xt(j).value() = xt(j);
+                a_xt(j).derivatives() = Eigen::VectorXd::Unit(num_groups, sparsity.column_group[j]);
+            }
+            const auto adiff_system = this->get_system().ToAutoDiffXd();
+            std::unique_ptr<Context<AutoDiffXd>> adiff_context = adiff_system->AllocateContext();
+            adiff_context->SetTimeStateAndParametersFrom(*context);
+            adiff_system->FixInputPortsFrom(this->get_system(), *context, adiff_context.get());
+            adiff_context->SetTime(t);
+            adiff_context->SetContinuousState(a_xt);
+            const VectorX<AutoDiffXd> result = this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
+            const MatrixX<double> compressed = math::ExtractGradient(result, num_groups);
+            for (int j = 0; j < n; ++j) {
+                for (int i : sparsity.column_rows[j]) {
+                    (*J)(i, j) = compressed(i, sparsity.column_group[j]);
+                }
+            }
+        } else {
+            DRAKE_UNREACHABLE();
+        }
+        return;
+    }
+
+    // See ComputeForwardDiffJacobian() and ComputeCentralDiffJacobian() for
+    // the choice of increments.
+    const bool central = (scheme == JacobianComputationScheme::kCentralDifference);
+    const double eps = central ? std::pow(std::numeric_limits<double>::epsilon(), 5.0 / 12)
+                               : std::sqrt(std::numeric_limits<double>::epsilon());
+
+    // Evaluate f(t,xt).
+    context->SetTimeAndContinuousState(t, xt);
+    const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
+
+    VectorX<T> xt_prime = xt;
+    VectorX<T> dx(n);
+    VectorX<T> df(n);
+    for (const std::vector<int>& group : sparsity.column_groups) {
+        // Perturb every column of the group at once; since no two of them
+        // affect the same row, each row of the difference in f belongs to
+        // exactly one column.
+        for (int j : group) {
+            xt_prime(j) = xt(j) + CalcDifferenceIncrement(xt(j), eps);
+            dx(j) = xt_prime(j) - xt(j);
+        }
+        context->SetTimeAndContinuousState(t, xt_prime);
+        df = this->EvalTimeDerivatives(*context).CopyToVector();
+        if (central) {
+            for (int j : group) {
+                xt_prime(j) = xt(j) - CalcDifferenceIncrement(xt(j), eps);
+                dx(j) += xt(j) - xt_prime(j);
+            }
+            context->SetContinuousState(xt_prime);
+            df -= this->EvalTimeDerivatives(*context).CopyToVector();
+        } else {
+            df -= f;
+        }
+        for (int j : group) {
+            for (int i : sparsity.column_rows[j]) {
+                (*J)(i, j) = df(i) / dx(j);
+            }
+            // Reset xt' to xt.
+            xt_prime(j) = xt(j);
+        }
+    }
+}
+
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix) {
+    if constexpr (std::is_same_v<T, double>) {
+        if (use_sparse_factorization_) {
+            Eigen::SparseMatrix<double> A = iteration_matrix.sparseView();
+            A.makeCompressed();
+            // Redo the symbolic analysis only if the pattern has changed.
+            const bool same_pattern =
+                    sparse_LU_ != nullptr && A.nonZeros() == sparse_matrix_.nonZeros() &&
+                    A.cols() == sparse_matrix_.cols() &&
+                    std::equal(A.outerIndexPtr(), A.outerIndexPtr() + A.cols() + 1, sparse_matrix_.outerIndexPtr()) &&
+                    std::equal(A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros(), sparse_matrix_.innerIndexPtr());
+            if (!same_pattern) {
+                sparse_LU_ = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+                sparse_LU_->analyzePattern(A);
+            }
+            sparse_LU_->factorize(A);
+            if (sparse_LU_->info() == Eigen::Success) {
+                sparse_matrix_ = std::move(A);
+                sparse_factored_ = true;
+                matrix_factored_ = true;
+                return;
+            }
+            // Fall back to the dense factorization (which is robust to
+            // singularity) and analyze the pattern afresh next time.
+            DRAKE_LOGGER_DEBUG("Sparse LU factorization failed: {}", sparse_LU_->lastErrorMessage());
+            sparse_LU_.reset();
+        }
+    }
+    sparse_factored_ = false;
     LU_.compute(iteration_matrix);
     matrix_factored_ = true;
 }
 
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(const VectorX<T>& b) const {
+    if constexpr (std::is_same_v<T, double>) {
+        if (sparse_factored_) {
+            return sparse_LU_->solve(b);
+        }
+    }
     return LU_.solve(b);
 }
 
@@ -280,8 +478,20 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t, const VectorX<
     // Get a the system.
     const System<T>& system = this->get_system();
 
+    // In sparse mode, compute the Jacobian densely only when its sparsity
+    // pattern is to be (re)detected.
+    const bool use_sparsity =
+            get_use_sparse_jacobian() && jacobian_sparsity_.has_value() &&
+            static_cast<int>(jacobian_sparsity_->column_rows.size()) == x.size() &&
+            num_jacobians_since_sparsity_update_ < kJacobianSparsityRefreshInterval;
+
     // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-    [this, context, &system, &t, &x]() {
+    [this, context, &system, &t, &x, use_sparsity]() {
+        if (use_sparsity) {
+            ComputeGroupedJacobian(jacobian_scheme_, t, x, &*context, &J_);
+            ++num_jacobians_since_sparsity_update_;
+            return;
+        }
         switch (jacobian_scheme_) {
             case JacobianComputationScheme::kForwardDifference:
                 ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
@@ -295,6 +505,10 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t, const VectorX<
                 ComputeAutoDiffJacobian(system, t, x, *context, &J_);
                 break;
         }
+        if (get_use_sparse_jacobian()) {
+            UpdateJacobianSparsity(J_);
+            num_jacobians_since_sparsity_update_ = 0;
+        }
     }();
 
     // Use the new number of ODE evaluations to determine the number of Jacobian
@@ -323,6 +537,7 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
 
     // Return immediately if full-Newton is not in use.
     if (!get_use_full_newton()) return;
+    iteration_matrix->set_use_sparse_factorization(get_use_sparse_jacobian());
 
     // Compute the initial Jacobian and iteration matrices and factor them.
     MatrixX<T>& J = get_mutable_jacobian();
@@ -342,6 +557,7 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
         typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
     // Compute the initial Jacobian and iteration matrices and factor them, if
     // necessary.
+    iteration_matrix->set_use_sparse_factorization(get_use_sparse_jacobian());
     MatrixX<T>& J = get_mutable_jacobian();
     if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
         J = CalcJacobian(t, xt);
@@ -3,9 +3,14 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "common/autodiff.h"
 #include "common/default_scalars.h"
@@ -118,6 +123,51 @@ public:
     }
 
     JacobianComputationScheme get_jacobian_computation_scheme() const { return jacobian_scheme_; }
+
+    /// Sets whether the integrator exploits sparsity of the system Jacobian
+    /// (default is `false`). This is worthwhile for systems with many state
+    /// variables, each of whose time derivatives depends on only a few of them
+    /// (e.g., discretized deformable bodies or long chains), for which the
+    /// dense Jacobian costs n derivative evaluations (2n for central
+    /// differencing) and factoring the iteration matrix costs O(n³).
+    ///
+    /// In sparse mode, the Jacobian's sparsity pattern is detected from a
+    /// dense Jacobian and its columns are partitioned into groups that share no
+    /// nonzero rows (a greedy graph coloring, per [Curtis 1974]). Later
+    /// Jacobians are then formed by perturbing all of the columns of a group at
+    /// once, needing one derivative evaluation per group (or, for
+    /// JacobianComputationScheme::kAutomatic, one derivative direction per
+    /// group). Since an entry that happened to be zero when the pattern was
+    /// detected would be missed, the pattern is refreshed from a dense Jacobian
+    /// every 50 Jacobian evaluations. Iteration matrices are factored with a
+    /// sparse LU factorization whose symbolic analysis (fill-reducing ordering)
+    /// is reused for as long as the matrix's sparsity pattern is unchanged.
+    ///
+    /// This has no effect unless T is `double`.
+    ///
+    /// - [Curtis 1974] A. Curtis, M. Powell, and J. Reid. On the Estimation of
+    ///                 Sparse Jacobian Matrices. IMA J. Appl. Math., 13(1),
+    ///                 pp. 117-119, 1974.
+    void set_use_sparse_jacobian(bool flag) {
+        if (use_sparse_jacobian_ != flag) {
+            J_.resize(0, 0);
+            jacobian_sparsity_.reset();
+            DoResetCachedJacobianRelatedMatrices();
+        }
+        use_sparse_jacobian_ = flag;
+    }
+
+    /// Gets whether the integrator exploits sparsity of the system Jacobian.
+    /// @see set_use_sparse_jacobian()
+    bool get_use_sparse_jacobian() const { return std::is_same_v<T, double> && use_sparse_jacobian_; }
+
+    /// Gets the number of column groups used to form sparse Jacobians (i.e.,
+    /// the number of derivative evaluations per forward-difference Jacobian),
+    /// or zero if no sparsity pattern has been detected yet.
+    /// @see set_use_sparse_jacobian()
+    int get_num_jacobian_column_groups() const {
+        return jacobian_sparsity_.has_value() ? static_cast<int>(jacobian_sparsity_->column_groups.size()) : 0;
+    }
     /// @}
 
     /// @name Cumulative statistics functions.
@@ -217,9 +267,26 @@ protected:
         /// Returns whether the iteration matrix has been set and factored.
         bool matrix_factored() const { return matrix_factored_; }
 
+        /// Sets whether SetAndFactorIterationMatrix() uses a sparse LU
+        /// factorization (falling back to the dense one if the sparse
+        /// factorization fails). This has no effect unless T is `double`.
+        void set_use_sparse_factorization(bool flag) { use_sparse_factorization_ = flag; }
+
     private:
         bool matrix_factored_{false};
 
+        // Whether to factor with sparse_LU_, and whether the most recent
+        // factorization was done with it.
+        bool use_sparse_factorization_{false};
+        bool sparse_factored_{false};
+
+        // The sparse factorization and the matrix whose pattern it was analyzed
+        // for; the (expensive) symbolic analysis is repeated only when the
+        // pattern changes. The solver is held by pointer because Eigen's sparse
+        // solvers are neither copyable nor movable.
+        std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
+        Eigen::SparseMatrix<double> sparse_matrix_;
+
         // A simple LU factorization is all that is needed for ImplicitIntegrator
         // templated on scalar type `double`; robustness in the solve
         // comes naturally as h << 1. Keeping this data in the class definition
@@ -391,6 +458,29 @@ protected:
     void DoResetStatistics() override;
     void DoReset() final;
 
+    // The sparsity pattern of the Jacobian matrix and a partition of its
+    // columns into groups whose members have no nonzero rows in common.
+    struct JacobianSparsity {
+        // The rows of the (structurally) nonzero entries of each column.
+        std::vector<std::vector<int>> column_rows;
+        // The columns in each group.
+        std::vector<std::vector<int>> column_groups;
+        // The group of each column.
+        std::vector<int> column_group;
+    };
+
+    // Merges the nonzero entries of the dense Jacobian `J` into the sparsity
+    // pattern and recomputes the column groups.
+    void UpdateJacobianSparsity(const MatrixX<T>& J);
+
+    // Computes the Jacobian like ComputeForwardDiffJacobian(),
+    // ComputeCentralDiffJacobian(), or ComputeAutoDiffJacobian() (as selected
+    // by `scheme`) but only for the entries in jacobian_sparsity_, perturbing
+    // one group of columns at a time.
+    // @pre jacobian_sparsity_ is set.
+    void ComputeGroupedJacobian(
+            JacobianComputationScheme scheme, const T& t, const VectorX<T>& xt, Context<T>* context, MatrixX<T>* J);
+
     // Compute the partial derivative of the ordinary differential equations with
     // respect to the state variables for a given x(t).
     // @param t the time around which to compute the Jacobian matrix.
@@ -496,6 +586,13 @@ private:
     // only ever be useful in debugging.
     bool use_full_newton_{false};
 
+    // Sparse Jacobian mode (see set_use_sparse_jacobian()) and its detected
+    // sparsity, along with the number of Jacobians computed using that
+    // sparsity since it was last refreshed.
+    bool use_sparse_jacobian_{false};
+    std::optional<JacobianSparsity> jacobian_sparsity_;
+    int num_jacobians_since_sparsity_update_{0};
+
     // Various combined statistics.
     int64_t num_iter_factorizations_{0};
     int64_t num_jacobian_evaluations_{0};
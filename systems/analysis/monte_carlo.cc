@@ -1,10 +1,17 @@
 #include "systems/analysis/monte_carlo.h"
 
-#include <future>
-#include <list>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <tuple>
 
+#include "common/drake_throw.h"
+#include "common/scope_exit.h"
+#include "common/text_logging.h"
 #include "systems/analysis/simulator.h"
 #include "systems/framework/system.h"
 
@@ -28,106 +35,213 @@ double RandomSimulation(const SimulatorFactory& make_simulator,
 
 namespace {
 
-// Serial (single-threaded) implementation of MonteCarloSimulation.
-std::vector<RandomSimulationResult> MonteCarloSimulationSerial(const SimulatorFactory& make_simulator,
-                                                               const ScalarSystemFunction& output,
-                                                               const double final_time,
-                                                               const int num_samples,
-                                                               RandomGenerator* const generator) {
-    std::vector<RandomSimulationResult> simulation_results;
-    simulation_results.reserve(num_samples);
+// Prepares the simulator for the next sample using the (main-thread-only)
+// generator: either recycles one of the `idle` simulators with
+// `reset_simulator`, or makes a new one. The second element of the result is
+// true iff the simulator was recycled.
+std::pair<std::unique_ptr<Simulator<double>>, bool> PrepareSimulator(
+        const SimulatorFactory& make_simulator,
+        const SimulatorResetter& reset_simulator,
+        RandomGenerator* const generator,
+        std::vector<std::unique_ptr<Simulator<double>>>* idle) {
+    std::unique_ptr<Simulator<double>> simulator;
+    bool recycled = false;
+    if (reset_simulator != nullptr && !idle->empty()) {
+        simulator = std::move(idle->back());
+        idle->pop_back();
+        reset_simulator(simulator.get(), generator);
+        recycled = true;
+    } else {
+        simulator = make_simulator(generator);
+    }
+    const System<double>& system = simulator->get_system();
+    system.SetRandomContext(&simulator->get_mutable_context(), generator);
+    return {std::move(simulator), recycled};
+}
 
+// Runs one prepared simulation and returns its output.
+double RunSimulation(Simulator<double>* simulator,
+                     bool recycled,
+                     const ScalarSystemFunction& output,
+                     const double final_time) {
+    // A recycled simulator has already been initialized once, so AdvanceTo()
+    // would not re-initialize it on its own.
+    if (recycled) {
+        simulator->Initialize();
+    }
+    simulator->AdvanceTo(final_time);
+    return output(simulator->get_system(), simulator->get_context());
+}
+
+// Serial (single-threaded) implementation of StreamMonteCarloSimulation.
+void MonteCarloSimulationSerial(const SimulatorFactory& make_simulator,
+                                const ScalarSystemFunction& output,
+                                const double final_time,
+                                const int num_samples,
+                                const MonteCarloResultCallback& on_result,
+                                RandomGenerator* const generator,
+                                const SimulatorResetter& reset_simulator) {
+    std::vector<std::unique_ptr<Simulator<double>>> idle;
     for (int sample = 0; sample < num_samples; ++sample) {
         RandomSimulationResult simulation_result(*generator);
-        simulation_result.output = RandomSimulation(make_simulator, output, final_time, generator);
-        simulation_results.push_back(std::move(simulation_result));
+        auto [simulator, recycled] = PrepareSimulator(make_simulator, reset_simulator, generator, &idle);
+        simulation_result.output = RunSimulation(simulator.get(), recycled, output, final_time);
+        on_result(sample, simulation_result);
+        if (reset_simulator != nullptr) {
+            idle.push_back(std::move(simulator));
+        }
     }
-
-    return simulation_results;
 }
 
-// Checks if a future has completed execution.
-template <typename T>
-bool IsFutureReady(const std::future<T>& future) {
-    // future.wait_for() is the only method to check the status of a future
-    // without waiting for it to complete.
-    const std::future_status status = future.wait_for(std::chrono::milliseconds(1));
-    return (status == std::future_status::ready);
-}
+// A unit of work for the worker threads of MonteCarloSimulationParallel.
+struct SimulationJob {
+    int sample{};
+    std::unique_ptr<Simulator<double>> simulator;
+    bool recycled{};
+    std::optional<RandomSimulationResult> result;
+    // Set (instead of result->output) when the simulation threw.
+    std::exception_ptr error;
+};
 
-// Parallel (multi-threaded) implementation of MonteCarloSimulation.
-std::vector<RandomSimulationResult> MonteCarloSimulationParallel(const SimulatorFactory& make_simulator,
-                                                                 const ScalarSystemFunction& output,
-                                                                 const double final_time,
-                                                                 const int num_samples,
-                                                                 RandomGenerator* const generator,
-                                                                 const int num_threads) {
-    // Initialize storage for all simulation results. The full vector must be
-    // constructed up front (i.e. we can't use reserve()) to avoid a race
-    // condition on checking the size of the vector when the worker threads write
-    // simulation results.
-    std::vector<RandomSimulationResult> simulation_results(num_samples, RandomSimulationResult(RandomGenerator()));
+// Parallel (multi-threaded) implementation of StreamMonteCarloSimulation.
+//
+// The calling thread prepares each simulator (since that consumes the
+// generator, it must happen in sample order on one thread) and hands it to a
+// pool of worker threads through a queue that never holds more jobs than
+// there are idle workers, so that every worker picks up a new simulation the
+// moment it finishes one. Completed jobs flow back through a second queue to
+// the calling thread, which reports them and recycles their simulators.
+void MonteCarloSimulationParallel(const SimulatorFactory& make_simulator,
+                                  const ScalarSystemFunction& output,
+                                  const double final_time,
+                                  const int num_samples,
+                                  const MonteCarloResultCallback& on_result,
+                                  RandomGenerator* const generator,
+                                  const SimulatorResetter& reset_simulator,
+                                  const int num_threads) {
+    std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable work_done;
+    std::deque<SimulationJob> pending;    // Guarded by mutex.
+    std::deque<SimulationJob> completed;  // Guarded by mutex.
+    bool shutdown = false;                // Guarded by mutex.
 
-    // Storage for active parallel simulation operations.
-    std::list<std::future<int>> active_operations;
-    // Keep track of how many simulations have been dispatched already.
-    int simulations_dispatched = 0;
-
-    while (active_operations.size() > 0 || simulations_dispatched < num_samples) {
-        // Check for completed operations.
-        for (auto operation = active_operations.begin(); operation != active_operations.end();) {
-            if (IsFutureReady(*operation)) {
-                // This call to future.get() is necessary to propagate any exception
-                // thrown during simulation execution.
-                const int sample_num = operation->get();
-                drake::log()->debug("Simulation {} completed", sample_num);
-                // Erase returns iterator to the next node in the list.
-                operation = active_operations.erase(operation);
-            } else {
-                // Advance to next node in the list.
-                ++operation;
+    auto worker = [&]() {
+        while (true) {
+            SimulationJob job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_ready.wait(lock, [&]() {
+                    return shutdown || !pending.empty();
+                });
+                if (shutdown) return;
+                job = std::move(pending.front());
+                pending.pop_front();
             }
+            try {
+                job.result->output = RunSimulation(job.simulator.get(), job.recycled, output, final_time);
+            } catch (...) {
+                job.error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                completed.push_back(std::move(job));
+            }
+            work_done.notify_one();
         }
+    };
 
-        // Dispatch new operations.
-        while (static_cast<int>(active_operations.size()) < num_threads && simulations_dispatched < num_samples) {
-            // Create the simulation result using the current generator state.
-            simulation_results.at(simulations_dispatched) = RandomSimulationResult(*generator);
-
-            // Make the simulator.
-            auto simulator = make_simulator(generator);
-            const auto& system = simulator->get_system();
-            system.SetRandomContext(&simulator->get_mutable_context(), generator);
-
-            auto perform_simulation = [simulator = std::move(simulator), &simulation_results, &output, final_time,
-                                       sample_num = simulations_dispatched]() {
-                simulator->AdvanceTo(final_time);
-                simulation_results.at(sample_num).output = output(simulator->get_system(), simulator->get_context());
-                return sample_num;
-            };
-
-            active_operations.emplace_back(std::async(std::launch::async, std::move(perform_simulation)));
-            drake::log()->debug("Simulation {} dispatched", simulations_dispatched);
-            ++simulations_dispatched;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    // Make sure the workers are stopped however we leave this function.
+    ScopeExit stop_workers([&]() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            shutdown = true;
+        }
+        work_ready.notify_all();
+        for (std::thread& thread : workers) {
+            thread.join();
+        }
+    });
+    for (int i = 0; i < num_threads; ++i) {
+        workers.emplace_back(worker);
+    }
+
+    std::vector<std::unique_ptr<Simulator<double>>> idle;
+    std::exception_ptr first_error;
+    int dispatched = 0;
+    int in_flight = 0;
+    while (in_flight > 0 || (dispatched < num_samples && first_error == nullptr)) {
+        // Keep every worker supplied with a simulation.
+        while (in_flight < num_threads && dispatched < num_samples && first_error == nullptr) {
+            SimulationJob job;
+            job.sample = dispatched;
+            job.result.emplace(*generator);
+            try {
+                std::tie(job.simulator, job.recycled) =
+                        PrepareSimulator(make_simulator, reset_simulator, generator, &idle);
+            } catch (...) {
+                first_error = std::current_exception();
+                break;
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending.push_back(std::move(job));
+            }
+            work_ready.notify_one();
+            drake::log()->debug("Simulation {} dispatched", dispatched);
+            ++dispatched;
+            ++in_flight;
         }
+        if (in_flight == 0) break;
 
-        // Wait a bit before checking for completion.
-        // TODO(calderpg-tri) When std::when_any([std::future,...]) or equivalent is
-        // available, this can be replaced.
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // Wait for (at least) one simulation to complete.
+        std::deque<SimulationJob> finished;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            work_done.wait(lock, [&]() {
+                return !completed.empty();
+            });
+            finished.swap(completed);
+        }
+        for (SimulationJob& job : finished) {
+            --in_flight;
+            drake::log()->debug("Simulation {} completed", job.sample);
+            if (job.error != nullptr) {
+                if (first_error == nullptr) first_error = job.error;
+                continue;
+            }
+            if (first_error != nullptr) continue;
+            try {
+                on_result(job.sample, *job.result);
+            } catch (...) {
+                first_error = std::current_exception();
+                continue;
+            }
+            if (reset_simulator != nullptr) {
+                idle.push_back(std::move(job.simulator));
+            }
+        }
     }
 
-    return simulation_results;
+    if (first_error != nullptr) {
+        std::rethrow_exception(first_error);
+    }
 }
 
 }  // namespace
 
-std::vector<RandomSimulationResult> MonteCarloSimulation(const SimulatorFactory& make_simulator,
-                                                         const ScalarSystemFunction& output,
-                                                         const double final_time,
-                                                         const int num_samples,
-                                                         RandomGenerator* generator,
-                                                         const Parallelism parallelism) {
+void StreamMonteCarloSimulation(const SimulatorFactory& make_simulator,
+                                const ScalarSystemFunction& output,
+                                const double final_time,
+                                const int num_samples,
+                                const MonteCarloResultCallback& on_result,
+                                RandomGenerator* generator,
+                                const Parallelism parallelism,
+                                const SimulatorResetter& reset_simulator) {
+    DRAKE_THROW_UNLESS(on_result != nullptr);
+
     // Create a generator if the user didn't provide one.
     std::unique_ptr<RandomGenerator> owned_generator;
     if (generator == nullptr) {
@@ -137,14 +251,34 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(const SimulatorFactory&
 
     // Since the parallel implementation incurs additional overhead even in the
     // num_threads=1 case, dispatch to the serial implementation in these cases.
-    const int num_threads = parallelism.num_threads();
+    const int num_threads = std::min(parallelism.num_threads(), num_samples);
     if (num_threads > 1) {
-        return MonteCarloSimulationParallel(make_simulator, output, final_time, num_samples, generator, num_threads);
+        MonteCarloSimulationParallel(make_simulator, output, final_time, num_samples, on_result, generator,
+                                     reset_simulator, num_threads);
     } else {
-        return MonteCarloSimulationSerial(make_simulator, output, final_time, num_samples, generator);
+        MonteCarloSimulationSerial(make_simulator, output, final_time, num_samples, on_result, generator,
+                                   reset_simulator);
     }
 }
 
+std::vector<RandomSimulationResult> MonteCarloSimulation(const SimulatorFactory& make_simulator,
+                                                         const ScalarSystemFunction& output,
+                                                         const double final_time,
+                                                         const int num_samples,
+                                                         RandomGenerator* generator,
+                                                         const Parallelism parallelism,
+                                                         const SimulatorResetter& reset_simulator) {
+    // Results arrive in completion order, so fill in a full-size vector.
+    std::vector<RandomSimulationResult> simulation_results(num_samples, RandomSimulationResult(RandomGenerator()));
+    StreamMonteCarloSimulation(
+            make_simulator, output, final_time, num_samples,
+            [&simulation_results](int sample, const RandomSimulationResult& result) {
+                simulation_results[sample] = result;
+            },
+            generator, parallelism, reset_simulator);
+    return simulation_results;
+}
+
 }  // namespace analysis
 }  // namespace systems
 }  // namespace drake
@@ -107,6 +107,28 @@ struct RandomSimulationResult {
     double output{};
 };
 
+/**
+ * Defines an optional hook that prepares a Simulator, whose previous random
+ * simulation has completed, to run another one. It is called in place of the
+ * SimulatorFactory, with the same RandomGenerator, and must leave the
+ * Simulator in a state equivalent to one freshly returned by the factory
+ * (e.g., by restoring the Context to its default values; SetRandomContext()
+ * is still called afterwards, and Simulator::Initialize() is called before
+ * the simulation is advanced). If it draws the same random numbers as the
+ * factory would, results do not depend on whether a Simulator was reused.
+ *
+ * This is only useful when the System under simulation is the same for every
+ * sample (i.e., when the randomness lives in the Context).
+ */
+typedef std::function<void(Simulator<double>* simulator, RandomGenerator* generator)> SimulatorResetter;
+
+/**
+ * Defines a callback that receives each result of StreamMonteCarloSimulation()
+ * along with its sample index (its position in the sequence returned by
+ * MonteCarloSimulation()).
+ */
+typedef std::function<void(int sample_index, const RandomSimulationResult& result)> MonteCarloResultCallback;
+
 /**
  * Generates samples of a scalar random variable output by running many
  * random simulations drawn from independent samples of the
@@ -140,10 +162,21 @@ struct RandomSimulationResult {
  * available on your hardware, specify either `Parallellism::Max()` or its terse
  * abbreviation `true`.
  *
+ * @param reset_simulator (Optional) When provided, a Simulator whose run has
+ * completed is recycled for a later sample by calling @p reset_simulator on it
+ * instead of constructing a new one with @p make_simulator, which avoids
+ * re-allocating the System, Context and integrator for each sample; see
+ * SimulatorResetter.
+ *
  * @returns a list of RandomSimulationResult's.
  *
+ * When parallel execution is specified, simulations are handed out one at a
+ * time to a pool of worker threads as soon as each worker becomes free, so
+ * all threads stay busy even when the durations of the runs vary widely.
+ *
  * Thread safety when parallel execution is specified:
- * - @p make_simulator and @p generator are only accessed from the main thread.
+ * - @p make_simulator, @p reset_simulator and @p generator are only accessed
+ *   from the main thread.
  *
  * - Each simulator created by @p make_simulator and its context are only
  *   accessed from within a single worker thread; however, any resource shared
@@ -163,7 +196,37 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(const SimulatorFactory&
                                                          double final_time,
                                                          int num_samples,
                                                          RandomGenerator* generator = nullptr,
-                                                         Parallelism parallelism = false);
+                                                         Parallelism parallelism = false,
+                                                         const SimulatorResetter& reset_simulator = nullptr);
+
+/**
+ * A variant of MonteCarloSimulation() that streams each result to
+ * @p on_result as soon as its simulation completes, instead of returning all
+ * of the results at the end. Results arrive in completion order, which with
+ * parallel execution generally differs from sample order; the `sample_index`
+ * argument gives each result's position in the sequence that
+ * MonteCarloSimulation() would return. Callers that aggregate statistics
+ * on-the-fly need not hold every result in memory.
+ *
+ * @see MonteCarloSimulation() for details about all of the other parameters,
+ * including their thread safety.
+ *
+ * @param on_result Invoked once per sample. It is always called from the
+ * calling thread (never from a worker thread), so it need not be safe for
+ * concurrent use. If it throws, no further simulations are dispatched, the
+ * ones in flight are completed and discarded, and the exception is
+ * propagated.
+ *
+ * @ingroup analysis
+ */
+void StreamMonteCarloSimulation(const SimulatorFactory& make_simulator,
+                                const ScalarSystemFunction& output,
+                                double final_time,
+                                int num_samples,
+                                const MonteCarloResultCallback& on_result,
+                                RandomGenerator* generator = nullptr,
+                                Parallelism parallelism = false,
+                                const SimulatorResetter& reset_simulator = nullptr);
 
 // The below functions are exposed for unit testing only.
 namespace internal {
@@ -0,0 +1,70 @@
+#include "systems/analysis/realtime_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/drake_assert.h"
+#include "common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+// The upper bound of the first histogram bucket.
+constexpr double kFirstBucketUpperBound = 1e-6;
+}  // namespace
+
+double RealtimeStatistics::bucket_upper_bound(int bucket) {
+    DRAKE_DEMAND(bucket >= 0 && bucket < kNumBuckets);
+    if (bucket == kNumBuckets - 1) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return std::ldexp(kFirstBucketUpperBound, bucket);
+}
+
+int RealtimeStatistics::BucketFor(double seconds) {
+    if (!(seconds > kFirstBucketUpperBound)) {
+        return 0;
+    }
+    // The smallest k with seconds <= 2ᵏ μs.
+    const int bucket = static_cast<int>(std::ceil(std::log2(seconds / kFirstBucketUpperBound)));
+    return std::min(bucket, kNumBuckets - 1);
+}
+
+double RealtimeStatistics::LatenessQuantileUpperBound(double quantile) const {
+    DRAKE_THROW_UNLESS(quantile >= 0.0 && quantile <= 1.0);
+    if (num_steps_ == 0) {
+        return 0.0;
+    }
+    const double threshold = quantile * static_cast<double>(num_steps_);
+    int64_t count = 0;
+    for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+        count += lateness_histogram_[bucket];
+        if (static_cast<double>(count) >= threshold) {
+            // Never report more than the largest value actually seen.
+            return std::min(bucket_upper_bound(bucket), max_lateness_);
+        }
+    }
+    return max_lateness_;
+}
+
+void RealtimeStatistics::RecordStepStart(double lateness, double tolerance) {
+    lateness = std::max(lateness, 0.0);
+    ++num_steps_;
+    if (lateness > tolerance) {
+        ++num_deadline_misses_;
+    }
+    max_lateness_ = std::max(max_lateness_, lateness);
+    total_lateness_ += lateness;
+    ++lateness_histogram_[BucketFor(lateness)];
+}
+
+void RealtimeStatistics::RecordStepDuration(double duration) {
+    duration = std::max(duration, 0.0);
+    max_step_duration_ = std::max(max_step_duration_, duration);
+    ++step_duration_histogram_[BucketFor(duration)];
+}
+
+}  // namespace systems
+}  // namespace drake
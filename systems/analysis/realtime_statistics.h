@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/// Wall-clock timing statistics gathered by a Simulator that is tracking real
+/// time (see Simulator::set_target_realtime_rate()), for measuring the jitter
+/// of a real-time run.
+///
+/// Each simulation step is scheduled to start at an absolute wall-clock
+/// deadline computed from its simulated start time. For every step this
+/// records:
+/// - the step's *lateness*: how long after its deadline it actually started
+///   (ideally zero; the wake-up jitter of the sleep/busy-wait); a step whose
+///   lateness exceeds the Simulator's deadline tolerance is counted as a
+///   deadline miss, and
+/// - the step's *duration*: the wall-clock time from the start of one step to
+///   the start of the next, excluding any time spent waiting for the next
+///   deadline (i.e., the computation time of the step).
+///
+/// Both quantities are accumulated into histograms with logarithmically
+/// spaced buckets: bucket 0 holds values up to 1 μs, bucket k holds values in
+/// (2ᵏ⁻¹, 2ᵏ] μs, and the last bucket holds everything larger.
+class RealtimeStatistics {
+public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RealtimeStatistics);
+
+    /// The number of histogram buckets (the last one is unbounded).
+    static constexpr int kNumBuckets = 32;
+
+    using Histogram = std::array<int64_t, kNumBuckets>;
+
+    RealtimeStatistics() = default;
+
+    /// Returns the upper bound (in seconds) of the values held by `bucket`, or
+    /// infinity for the last bucket.
+    /// @pre 0 <= bucket < kNumBuckets
+    static double bucket_upper_bound(int bucket);
+
+    /// Returns the number of steps whose start was recorded.
+    int64_t num_steps() const { return num_steps_; }
+
+    /// Returns the number of steps that started later than the deadline
+    /// tolerance allowed.
+    int64_t num_deadline_misses() const { return num_deadline_misses_; }
+
+    /// Returns the largest lateness (in seconds) observed.
+    double max_lateness() const { return max_lateness_; }
+
+    /// Returns the mean lateness (in seconds), or zero if no steps were
+    /// recorded.
+    double mean_lateness() const { return num_steps_ > 0 ? total_lateness_ / num_steps_ : 0.0; }
+
+    /// Returns the largest step duration (in seconds) observed.
+    double max_step_duration() const { return max_step_duration_; }
+
+    /// Returns the histogram of step lateness.
+    const Histogram& lateness_histogram() const { return lateness_histogram_; }
+
+    /// Returns the histogram of step durations.
+    const Histogram& step_duration_histogram() const { return step_duration_histogram_; }
+
+    /// Returns an upper bound on the `quantile` (e.g., 0.99) of the recorded
+    /// lateness, at the resolution of the histogram buckets; returns zero if
+    /// no steps were recorded.
+    /// @pre 0 <= quantile <= 1
+    double LatenessQuantileUpperBound(double quantile) const;
+
+    /// Records the start of a step that began `lateness` seconds after its
+    /// deadline; it is a deadline miss if `lateness > tolerance`.
+    void RecordStepStart(double lateness, double tolerance);
+
+    /// Records the duration (in seconds) of a completed step.
+    void RecordStepDuration(double duration);
+
+    /// Clears all statistics.
+    void Reset() { *this = RealtimeStatistics(); }
+
+private:
+    static int BucketFor(double seconds);
+
+    int64_t num_steps_{0};
+    int64_t num_deadline_misses_{0};
+    double max_lateness_{0.0};
+    double total_lateness_{0.0};
+    double max_step_duration_{0.0};
+    Histogram lateness_histogram_{};
+    Histogram step_duration_histogram_{};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -281,7 +281,7 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
         DRAKE_LOGGER_TRACE("Starting a simulation step at {}", step_start_time);
 
         // Delay to match target realtime rate if requested and possible.
-        PauseIfTooFast();
+        const std::optional<TimePoint> realtime_step_start = PauseIfTooFast();
 
         // The general policy here is to do actions in decreasing order of
         // "violence" to the state, i.e. unrestricted -> discrete -> continuous ->
@@ -386,6 +386,10 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
         // Allow for interrupt in Python.
         if (python_monitor_ != nullptr) python_monitor_();
 
+        if (realtime_step_start.has_value()) {
+            realtime_statistics_.RecordStepDuration(Duration(Clock::now() - *realtime_step_start).count());
+        }
+
         // If we get here, none of the event handlers reported failure, but we may
         // have reached early termination.
 
@@ -775,14 +779,23 @@ typename Simulator<T>::TimeOrWitnessTriggered Simulator<T>::IntegrateContinuousS
 }
 
 template <typename T>
-void Simulator<T>::PauseIfTooFast() const {
-    if (target_realtime_rate_ <= 0) return;  // Run at full speed.
+std::optional<typename Simulator<T>::TimePoint> Simulator<T>::PauseIfTooFast() {
+    if (target_realtime_rate_ <= 0) return std::nullopt;  // Run at full speed.
     const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
     const double simtime_passed = simtime_now - initial_simtime_;
     const TimePoint desired_realtime = initial_realtime_ + Duration(simtime_passed / target_realtime_rate_);
-    // TODO(sherm1): Could add some slop to now() and not sleep if
-    // we are already close enough. But what is a reasonable value?
-    if (desired_realtime > Clock::now()) std::this_thread::sleep_until(desired_realtime);
+    TimePoint now = Clock::now();
+    if (desired_realtime > now) {
+        // Sleep until shortly before the deadline, then spin for the remainder;
+        // the sleep alone can overshoot by more than the caller will tolerate.
+        const TimePoint wake_time = desired_realtime - Duration(realtime_busy_wait_);
+        if (wake_time > now) std::this_thread::sleep_until(wake_time);
+        do {
+            now = Clock::now();
+        } while (now < desired_realtime);
+    }
+    realtime_statistics_.RecordStepStart(Duration(now - desired_realtime).count(), realtime_deadline_tolerance_);
+    return now;
 }
 
 template <typename T>
@@ -804,6 +817,7 @@ void Simulator<T>::ResetStatistics() {
 
     initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
     initial_realtime_ = Clock::now();
+    realtime_statistics_.Reset();
 }
 
 namespace internal {
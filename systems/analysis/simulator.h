@@ -12,9 +12,11 @@
 #include "common/default_scalars.h"
 #include "common/drake_assert.h"
 #include "common/drake_copyable.h"
+#include "common/drake_throw.h"
 #include "common/extract_double.h"
 #include "common/name_value.h"
 #include "systems/analysis/integrator_base.h"
+#include "systems/analysis/realtime_statistics.h"
 #include "systems/analysis/simulator_config.h"
 #include "systems/analysis/simulator_status.h"
 #include "systems/framework/context.h"
@@ -483,6 +485,11 @@ public:
     /// other uses you should consider whether approximate real time is adequate
     /// for your purposes.
     ///
+    /// Each step is scheduled against an absolute wall-clock deadline computed
+    /// from its simulated start time (so scheduling error does not accumulate),
+    /// and the timing of every step is recorded in get_realtime_statistics().
+    /// For sub-millisecond precision, see set_realtime_busy_wait().
+    ///
     /// @note If the full-speed simulation is already slower than real time you
     /// can't speed it up with this call! Instead consider requesting less
     /// integration accuracy, using a faster integration method or fixed time
@@ -521,6 +528,40 @@ public:
     /// @see set_target_realtime_rate()
     double get_actual_realtime_rate() const;
 
+    /// (Advanced) Sets how long before each step's real-time deadline the
+    /// %Simulator stops sleeping and instead busy-waits (spins) until the
+    /// deadline. Operating system sleeps commonly overshoot by tens of
+    /// microseconds to milliseconds; spinning through the final stretch trades
+    /// one CPU core for much lower wake-up jitter, which can matter for
+    /// hardware-in-the-loop use. The default of zero never busy-waits. This
+    /// has no effect unless a target realtime rate is set.
+    /// @pre duration is non-negative.
+    void set_realtime_busy_wait(double duration) {
+        DRAKE_THROW_UNLESS(duration >= 0);
+        realtime_busy_wait_ = duration;
+    }
+
+    /// Returns the busy-wait duration set by set_realtime_busy_wait().
+    double get_realtime_busy_wait() const { return realtime_busy_wait_; }
+
+    /// (Advanced) Sets how late (in seconds of wall-clock time) a step may start
+    /// relative to its real-time deadline before it is counted as a deadline
+    /// miss in get_realtime_statistics(). The default is one millisecond.
+    /// @pre tolerance is non-negative.
+    void set_realtime_deadline_tolerance(double tolerance) {
+        DRAKE_THROW_UNLESS(tolerance >= 0);
+        realtime_deadline_tolerance_ = tolerance;
+    }
+
+    /// Returns the tolerance set by set_realtime_deadline_tolerance().
+    double get_realtime_deadline_tolerance() const { return realtime_deadline_tolerance_; }
+
+    /// Returns the wall-clock timing statistics (per-step lateness and duration
+    /// histograms, and the count of deadline misses) recorded since the last
+    /// Initialize() or ResetStatistics() call. Statistics are only recorded
+    /// while a target realtime rate is set.
+    const RealtimeStatistics& get_realtime_statistics() const { return realtime_statistics_; }
+
     /// (To be deprecated) Prefer using per-step publish events instead.
     ///
     /// Sets whether the simulation should trigger a forced-Publish event on the
@@ -779,8 +820,10 @@ private:
     using TimePoint = std::chrono::time_point<Clock, Duration>;
 
     // If the simulated time in the context is ahead of real time, pause long
-    // enough to let real time catch up (approximately).
-    void PauseIfTooFast() const;
+    // enough to let real time catch up, and records the step's lateness.
+    // Returns the wall-clock start time of the step, or nullopt when not
+    // tracking real time.
+    std::optional<TimePoint> PauseIfTooFast();
 
     // A pointer to the integrator.
     std::unique_ptr<IntegratorBase<T>> integrator_;
@@ -810,9 +853,14 @@ private:
 
     bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
+    // Real-time scheduling options (user settable).
+    double realtime_busy_wait_{0.0};
+    double realtime_deadline_tolerance_{1e-3};
+
     // These are recorded at initialization or statistics reset.
     double initial_simtime_{nan()};  // Simulated time at start of period.
     TimePoint initial_realtime_;     // Real time at start of period.
+    RealtimeStatistics realtime_statistics_;
 
     // The number of discrete updates since the last statistics reset.
     int64_t num_discrete_updates_{0};
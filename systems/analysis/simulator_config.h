@@ -22,6 +22,7 @@ struct SimulatorConfig {
         a->Visit(DRAKE_NVP(use_error_control));
         a->Visit(DRAKE_NVP(target_realtime_rate));
         a->Visit(DRAKE_NVP(publish_every_time_step));
+        a->Visit(DRAKE_NVP(realtime_busy_wait));
     }
 
     std::string integration_scheme{"runge_kutta3"};
@@ -33,6 +34,9 @@ struct SimulatorConfig {
     /// Simulator::set_publish_every_time_step() when applied by
     /// ApplySimulatorConfig().
     bool publish_every_time_step{false};
+    /// Sets Simulator::set_realtime_busy_wait() when applied by
+    /// ApplySimulatorConfig().
+    double realtime_busy_wait{0.0};
 };
 
 }  // namespace systems
@@ -175,6 +175,7 @@ void ApplySimulatorConfig(const SimulatorConfig& config, Simulator<T>* simulator
         integrator.set_target_accuracy(config.accuracy);
     }
     simulator->set_target_realtime_rate(config.target_realtime_rate);
+    simulator->set_realtime_busy_wait(config.realtime_busy_wait);
     // It is almost always the case we want these two next flags to be either both
     // true or both false. Otherwise we could miss the first publish at t = 0.
     simulator->set_publish_at_initialization(config.publish_every_time_step);
@@ -198,6 +199,7 @@ SimulatorConfig ExtractSimulatorConfig(const Simulator<T>& simulator) {
     }
     result.target_realtime_rate = ExtractDoubleOrThrow(simulator.get_target_realtime_rate());
     result.publish_every_time_step = simulator.get_publish_every_time_step();
+    result.realtime_busy_wait = simulator.get_realtime_busy_wait();
     return result;
 }
 
@@ -33,6 +33,17 @@ void PrintSimulatorStatistics(const Simulator<T>& simulator) {
     fmt::print("Number of discrete updates = {:d}\n", simulator.get_num_discrete_updates());
     fmt::print("Number of \"unrestricted\" updates = {:d}\n", simulator.get_num_unrestricted_updates());
 
+    const RealtimeStatistics& realtime = simulator.get_realtime_statistics();
+    if (realtime.num_steps() > 0) {
+        fmt::print("\nReal-time stats (target rate {:g}, actual rate {:g}):\n",
+                   simulator.get_target_realtime_rate(), simulator.get_actual_realtime_rate());
+        fmt::print("Number of deadline misses (> {:g} s late) = {:d} of {:d} steps\n",
+                   simulator.get_realtime_deadline_tolerance(), realtime.num_deadline_misses(), realtime.num_steps());
+        fmt::print("Step start lateness: mean = {:10.6g} s, 99th percentile <= {:10.6g} s, max = {:10.6g} s\n",
+                   realtime.mean_lateness(), realtime.LatenessQuantileUpperBound(0.99), realtime.max_lateness());
+        fmt::print("Largest step wall-clock duration = {:10.6g} s\n", realtime.max_step_duration());
+    }
+
     if (integrator.get_num_steps_taken() == 0) {
         fmt::print(
                 "\nNote: the following integrator took zero steps. The "
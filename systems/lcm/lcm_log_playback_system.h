@@ -15,6 +15,10 @@ namespace lcm {
  * This is useful when a simulated Diagram contains LcmSubscriberSystem(s)
  * whose outputs should be determined by logged data and when the log's cursor
  * should advance automatically during simulation.
+ *
+ * To replay only part of a log, open it with a DrakeLcmLogPlaybackParams
+ * channel list and/or call DrakeLcmLog::Seek() before the simulation starts;
+ * the log's index makes both cheap even for very large logs.
  */
 class LcmLogPlaybackSystem : public LeafSystem<double> {
 public:
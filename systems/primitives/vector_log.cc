@@ -1,7 +1,13 @@
 #include "systems/primitives/vector_log.h"
 
+#include <type_traits>
+#include <utility>
+
 #include "common/default_scalars.h"
 #include "common/drake_assert.h"
+#include "common/drake_throw.h"
+#include "common/text_logging.h"
+#include "systems/primitives/vector_log_file.h"
 
 namespace drake {
 namespace systems {
@@ -11,10 +17,49 @@ VectorLog<T>::VectorLog(int input_size) : sample_times_(kDefaultCapacity), data_
     DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
+template <typename T>
+VectorLog<T>::VectorLog(const VectorLog& other)
+    : num_samples_(other.num_samples_), sample_times_(other.sample_times_), data_(other.data_) {}
+
+template <typename T>
+VectorLog<T>& VectorLog<T>::operator=(const VectorLog& other) {
+    if (this != &other) {
+        Flush();
+        num_samples_ = int64_t{other.num_samples_};
+        sample_times_ = other.sample_times_;
+        data_ = other.data_;
+        writer_.reset();
+    }
+    return *this;
+}
+
+template <typename T>
+VectorLog<T>& VectorLog<T>::operator=(VectorLog&& other) {
+    if (this != &other) {
+        Flush();
+        num_samples_ = std::move(other.num_samples_);
+        sample_times_ = std::move(other.sample_times_);
+        data_ = std::move(other.data_);
+        writer_ = std::move(other.writer_);
+    }
+    return *this;
+}
+
+template <typename T>
+VectorLog<T>::~VectorLog() {
+    // Destructors must not throw, so a failed final write can only be logged.
+    try {
+        Flush();
+    } catch (const std::exception& e) {
+        drake::log()->error("VectorLog: failed to write the final chunk: {}", e.what());
+    }
+}
+
 template <typename T>
 void VectorLog<T>::Reserve(int64_t capacity) {
     DRAKE_ASSERT_VOID(CheckInvariants());
-    if (capacity > sample_times_.size()) {
+    // While streaming, the storage must stay at exactly one chunk.
+    if (writer_ == nullptr && capacity > sample_times_.size()) {
         sample_times_.conservativeResize(capacity);
         data_.conservativeResize(Eigen::NoChange, capacity);
     }
@@ -24,11 +69,15 @@ void VectorLog<T>::Reserve(int64_t capacity) {
 template <typename T>
 void VectorLog<T>::AddData(const T& time, const VectorX<T>& sample) {
     DRAKE_ASSERT_VOID(CheckInvariants());
-    // If the new size exceeds the current allocation, then do a conservative
-    // resize (ouch!). Clients can avoid this if necessary by calling Reserve()
-    // ahead of time.
+    // If the new size exceeds the current allocation, then either stream the
+    // full chunk out to the file, or do a conservative resize (ouch!). Clients
+    // can avoid the resize if necessary by calling Reserve() ahead of time.
     if (num_samples_ + 1 > sample_times_.size()) {
-        Reserve(sample_times_.size() * 2);
+        if (writer_ != nullptr) {
+            WriteChunk();
+        } else {
+            Reserve(sample_times_.size() * 2);
+        }
     }
 
     // Record time and input to the num_samples position.
@@ -40,6 +89,43 @@ void VectorLog<T>::AddData(const T& time, const VectorX<T>& sample) {
     DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
+template <typename T>
+void VectorLog<T>::StreamTo(std::shared_ptr<VectorLogFileWriter> writer) {
+    DRAKE_THROW_UNLESS(writer != nullptr);
+    if constexpr (!std::is_same_v<T, double>) {
+        throw std::logic_error("VectorLog::StreamTo() is only supported for T = double");
+    } else {
+        DRAKE_THROW_UNLESS(writer_ == nullptr);
+        DRAKE_THROW_UNLESS(writer->input_size() == get_input_size());
+        const int64_t capacity = writer->chunk_capacity();
+        DRAKE_THROW_UNLESS(num_samples_ <= capacity);
+        // Shrinking below the current allocation is fine; only the leading
+        // num_samples_ columns hold data.
+        sample_times_.conservativeResize(capacity);
+        data_.conservativeResize(Eigen::NoChange, capacity);
+        writer_ = std::move(writer);
+    }
+    DRAKE_ASSERT_VOID(CheckInvariants());
+}
+
+template <typename T>
+void VectorLog<T>::Flush() {
+    if (writer_ != nullptr && num_samples_ > 0) {
+        WriteChunk();
+    }
+}
+
+template <typename T>
+void VectorLog<T>::WriteChunk() {
+    if constexpr (std::is_same_v<T, double>) {
+        DRAKE_DEMAND(writer_ != nullptr);
+        writer_->WriteChunk(sample_times(), data());
+        num_samples_ = 0;
+    } else {
+        DRAKE_UNREACHABLE();
+    }
+}
+
 template <typename T>
 void VectorLog<T>::CheckInvariants() const {
     DRAKE_DEMAND(sample_times_.size() == data_.cols());
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "common/drake_copyable.h"
 #include "common/eigen_types.h"
 #include "common/reset_after_move.h"
@@ -7,6 +9,8 @@
 namespace drake {
 namespace systems {
 
+class VectorLogFileWriter;
+
 /**
  This utility class serves as an in-memory cache of time-dependent vector
  values. Note that this is a standalone class, not a Drake System. It is
@@ -17,6 +21,11 @@ namespace systems {
  double in size. If avoiding memory allocation during some performance-critical
  phase is desired, clients can call Reserve() to pre-allocate log storage.
 
+ For very long runs, a `double` log can instead stream its samples to a file
+ (see StreamTo()). In that mode the log holds a fixed-capacity buffer of recent
+ samples that is written to the file as one chunk whenever it fills, so memory
+ use stays bounded and appending never copies history.
+
  This object imposes no constraints on the stored data. For example, times
  passed to AddData() need not be increasing in order of insertion, values are
  allowed to be infinite, NaN, etc.
@@ -33,17 +42,31 @@ public:
      */
     static constexpr int64_t kDefaultCapacity = 1000;
 
-    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(VectorLog);
+    /** @name Implements CopyConstructible, CopyAssignable, MoveConstructible,
+     MoveAssignable. A copy of a streaming log holds a copy of the samples that
+     have not yet been written, but does not itself stream (only the original
+     writes to the file). */
+    //@{
+    VectorLog(const VectorLog& other);
+    VectorLog& operator=(const VectorLog& other);
+    VectorLog(VectorLog&&) = default;
+    VectorLog& operator=(VectorLog&& other);
+    //@}
 
     /** Constructs the vector log.
      @param input_size                Dimension of the per-time step data set.
      */
     explicit VectorLog(int input_size);
 
+    /** Writes any samples that have not yet been streamed (see Flush()). */
+    ~VectorLog();
+
     /** Reports the size of the log's input vector. */
     int64_t get_input_size() const { return data_.rows(); }
 
-    /** Returns the number of samples taken since construction or last Clear(). */
+    /** Returns the number of samples taken since construction or last Clear().
+     When streaming, this counts only the samples that are still held in memory
+     (i.e., that have not yet been written to the file). */
     int num_samples() const { return num_samples_; }
 
     // The return type here must be a VectorBlock because only the leading
@@ -64,7 +87,9 @@ public:
 
     /**
      Reserve storage for at least `capacity` samples. At construction, there will
-     be at least `kDefaultCapacity`; use this method to reserve more.
+     be at least `kDefaultCapacity`; use this method to reserve more. While
+     streaming (see StreamTo()), the storage is fixed at one chunk and this
+     method does nothing.
      */
     void Reserve(int64_t capacity);
 
@@ -86,12 +111,39 @@ public:
      */
     void AddData(const T& time, const VectorX<T>& sample);
 
+    /** Switches this log to streaming mode, in which samples are written to
+     `writer` in chunks of `writer->chunk_capacity()` samples. The log's storage
+     is set to exactly one chunk; whenever it fills, its samples are written as
+     one chunk and removed from memory, so that data() and sample_times() only
+     report the samples not yet written. Any samples already in the log are
+     kept and will be written along with the first chunk. Use
+     ReadVectorLogFile() to load the complete history back from the file.
+
+     The writer may be shared by the caller, e.g. to call its Flush() method.
+     @pre writer->input_size() == get_input_size().
+     @throws std::exception if T is not `double`, if the log is already
+     streaming, or if it holds more samples than one chunk. */
+    void StreamTo(std::shared_ptr<VectorLogFileWriter> writer);
+
+    /** Returns true iff this log is streaming to a file. */
+    bool is_streaming() const { return writer_ != nullptr; }
+
+    /** When streaming, writes the samples held in memory to the file (as a
+     possibly partial chunk) and removes them from the log; otherwise does
+     nothing. */
+    void Flush();
+
 private:
     void CheckInvariants() const;
 
+    // Writes the in-memory samples as one chunk and clears them.
+    void WriteChunk();
+
     reset_after_move<int64_t> num_samples_{0};
     VectorX<T> sample_times_;
     MatrixX<T> data_;
+    // Non-null iff this log is streaming. (Always null unless T is double.)
+    std::shared_ptr<VectorLogFileWriter> writer_;
 };
 }  // namespace systems
 }  // namespace drake
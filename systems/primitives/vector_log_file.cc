@@ -0,0 +1,237 @@
+#include "systems/primitives/vector_log_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "common/drake_assert.h"
+#include "common/drake_throw.h"
+#include "common/scope_exit.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The file header is the magic string followed by three int64 fields: the
+// input size, the chunk capacity, and the compression flag.
+constexpr char kMagic[8] = {'D', 'R', 'K', 'V', 'L', 'O', 'G', '1'};
+constexpr int64_t kHeaderSize = sizeof(kMagic) + 3 * sizeof(int64_t);
+
+template <typename T>
+void WritePod(std::ofstream* out, const T& value) {
+    out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// A bounds-checked cursor over the bytes of a memory-mapped file.
+class ByteReader {
+public:
+    ByteReader(const char* data, int64_t size, const std::string& filename)
+        : data_(data), size_(size), filename_(filename) {}
+
+    bool at_end() const { return offset_ == size_; }
+
+    int64_t offset() const { return offset_; }
+
+    void set_offset(int64_t offset) { offset_ = offset; }
+
+    const char* Take(int64_t num_bytes) {
+        if (num_bytes < 0 || num_bytes > size_ - offset_) {
+            throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is truncated or corrupt", filename_));
+        }
+        const char* result = data_ + offset_;
+        offset_ += num_bytes;
+        return result;
+    }
+
+    int64_t TakeInt64() {
+        int64_t result;
+        std::memcpy(&result, Take(sizeof(result)), sizeof(result));
+        return result;
+    }
+
+private:
+    const char* const data_;
+    const int64_t size_;
+    const std::string& filename_;
+    int64_t offset_{0};
+};
+
+}  // namespace
+
+VectorLogFileWriter::VectorLogFileWriter(const std::string& filename,
+                                         int input_size,
+                                         const VectorLogFileParams& params)
+    : filename_(filename), input_size_(input_size), params_(params) {
+    DRAKE_THROW_UNLESS(input_size >= 0);
+    DRAKE_THROW_UNLESS(params.chunk_capacity > 0);
+    DRAKE_THROW_UNLESS(params.compression_level >= Z_BEST_SPEED && params.compression_level <= Z_BEST_COMPRESSION);
+    out_.open(filename, std::ios::binary | std::ios::trunc);
+    if (!out_) {
+        throw std::runtime_error(fmt::format("VectorLogFileWriter: cannot open {} for writing", filename));
+    }
+    out_.write(kMagic, sizeof(kMagic));
+    WritePod(&out_, int64_t{input_size});
+    WritePod(&out_, params.chunk_capacity);
+    WritePod(&out_, int64_t{params.compress});
+    column_.resize(params.chunk_capacity);
+    if (params.compress) {
+        compressed_.resize(compressBound(params.chunk_capacity * sizeof(double)));
+    }
+    Flush();
+}
+
+VectorLogFileWriter::~VectorLogFileWriter() = default;
+
+void VectorLogFileWriter::WriteChunk(const Eigen::Ref<const Eigen::VectorXd>& times,
+                                     const Eigen::Ref<const Eigen::MatrixXd>& data) {
+    const int64_t num_samples = times.size();
+    DRAKE_DEMAND(num_samples == data.cols());
+    DRAKE_DEMAND(num_samples <= params_.chunk_capacity);
+    DRAKE_DEMAND(data.rows() == input_size_);
+    if (num_samples == 0) {
+        return;
+    }
+    WritePod(&out_, num_samples);
+    WriteColumn(times.data(), num_samples, times.innerStride());
+    for (int i = 0; i < input_size_; ++i) {
+        // Row i of the (column-major) data is the time series of element i.
+        WriteColumn(data.data() + i, num_samples, data.outerStride());
+    }
+    if (!out_) {
+        throw std::runtime_error(fmt::format("VectorLogFileWriter: error writing to {}", filename_));
+    }
+    num_samples_written_ += num_samples;
+}
+
+void VectorLogFileWriter::WriteColumn(const double* values, int64_t size, int64_t stride) {
+    const double* contiguous = values;
+    if (stride != 1) {
+        for (int64_t k = 0; k < size; ++k) {
+            column_[k] = values[k * stride];
+        }
+        contiguous = column_.data();
+    }
+    const uLong num_bytes = size * sizeof(double);
+    if (!params_.compress) {
+        WritePod(&out_, int64_t{static_cast<int64_t>(num_bytes)});
+        out_.write(reinterpret_cast<const char*>(contiguous), num_bytes);
+        return;
+    }
+    uLongf compressed_size = compressed_.size();
+    const int status = compress2(compressed_.data(), &compressed_size, reinterpret_cast<const Bytef*>(contiguous),
+                                 num_bytes, params_.compression_level);
+    DRAKE_DEMAND(status == Z_OK);
+    WritePod(&out_, int64_t{static_cast<int64_t>(compressed_size)});
+    out_.write(reinterpret_cast<const char*>(compressed_.data()), compressed_size);
+}
+
+void VectorLogFileWriter::Flush() {
+    out_.flush();
+    if (!out_) {
+        throw std::runtime_error(fmt::format("VectorLogFileWriter: error writing to {}", filename_));
+    }
+}
+
+VectorLog<double> ReadVectorLogFile(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(fmt::format("ReadVectorLogFile(): cannot open {}", filename));
+    }
+    ScopeExit close_fd([fd]() {
+        ::close(fd);
+    });
+    struct stat file_stat {};
+    if (::fstat(fd, &file_stat) != 0 || file_stat.st_size < kHeaderSize) {
+        throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is not a vector log file", filename));
+    }
+    const int64_t file_size = file_stat.st_size;
+    void* const mapped = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error(fmt::format("ReadVectorLogFile(): cannot memory-map {}", filename));
+    }
+    ScopeExit unmap([mapped, file_size]() {
+        ::munmap(mapped, file_size);
+    });
+    ::madvise(mapped, file_size, MADV_SEQUENTIAL);
+
+    ByteReader reader(static_cast<const char*>(mapped), file_size, filename);
+    if (std::memcmp(reader.Take(sizeof(kMagic)), kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is not a vector log file", filename));
+    }
+    const int64_t input_size = reader.TakeInt64();
+    const int64_t chunk_capacity = reader.TakeInt64();
+    const bool compressed = reader.TakeInt64() != 0;
+    if (input_size < 0 || input_size > file_size || chunk_capacity <= 0) {
+        throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} has a corrupt header", filename));
+    }
+
+    // Skim the chunk headers to learn the total number of samples, so that the
+    // log's storage is allocated exactly once.
+    const int64_t first_chunk = reader.offset();
+    int64_t total_samples = 0;
+    int64_t max_chunk_size = 0;
+    while (!reader.at_end()) {
+        const int64_t num_samples = reader.TakeInt64();
+        if (num_samples <= 0 || num_samples > chunk_capacity) {
+            throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is truncated or corrupt", filename));
+        }
+        for (int64_t column = 0; column <= input_size; ++column) {
+            reader.Take(reader.TakeInt64());
+        }
+        total_samples += num_samples;
+        max_chunk_size = std::max(max_chunk_size, num_samples);
+    }
+    reader.set_offset(first_chunk);
+
+    VectorLog<double> log(input_size);
+    log.Reserve(total_samples);
+    Eigen::VectorXd times(max_chunk_size);
+    Eigen::MatrixXd data(input_size, max_chunk_size);
+    Eigen::VectorXd sample(input_size);
+    std::vector<double> column(max_chunk_size);
+    // Decodes one stored column of `num_samples` doubles into `destination`,
+    // whose consecutive entries are `stride` apart.
+    auto decode_column = [&](int64_t num_samples, double* destination, int64_t stride) {
+        const int64_t stored_size = reader.TakeInt64();
+        const char* stored = reader.Take(stored_size);
+        uLongf num_bytes = num_samples * sizeof(double);
+        const Bytef* bytes = reinterpret_cast<const Bytef*>(stored);
+        if (compressed) {
+            if (uncompress(reinterpret_cast<Bytef*>(column.data()), &num_bytes, bytes, stored_size) != Z_OK ||
+                num_bytes != num_samples * sizeof(double)) {
+                throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is corrupt", filename));
+            }
+        } else {
+            if (stored_size != static_cast<int64_t>(num_bytes)) {
+                throw std::runtime_error(fmt::format("ReadVectorLogFile(): {} is corrupt", filename));
+            }
+            std::memcpy(column.data(), bytes, num_bytes);
+        }
+        for (int64_t k = 0; k < num_samples; ++k) {
+            destination[k * stride] = column[k];
+        }
+    };
+    while (!reader.at_end()) {
+        const int64_t num_samples = reader.TakeInt64();
+        decode_column(num_samples, times.data(), 1);
+        for (int64_t i = 0; i < input_size; ++i) {
+            decode_column(num_samples, data.data() + i, input_size);
+        }
+        for (int64_t k = 0; k < num_samples; ++k) {
+            sample = data.col(k);
+            log.AddData(times(k), sample);
+        }
+    }
+    return log;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/drake_copyable.h"
+#include "common/eigen_types.h"
+#include "systems/primitives/vector_log.h"
+
+namespace drake {
+namespace systems {
+
+/** The set of parameters for a VectorLogFileWriter. */
+struct VectorLogFileParams {
+    /** The number of samples per chunk. This is also the (fixed) number of
+    samples that a streaming VectorLog holds in memory. */
+    int64_t chunk_capacity{4096};
+
+    /** When true, each column of each chunk is compressed with zlib. */
+    bool compress{false};
+
+    /** The zlib compression level (1 = fastest, 9 = smallest) used when
+    `compress` is true. */
+    int compression_level{1};
+};
+
+/**
+ Writes time-dependent vector data to a binary file in a chunked, columnar
+ format. This is primarily used to stream a VectorLog to disk (see
+ VectorLog::StreamTo()), so that a long simulation's history need not be held
+ in memory; use ReadVectorLogFile() to load the result back.
+
+ The file holds a fixed-size header followed by a sequence of chunks. Each
+ chunk holds up to `chunk_capacity` samples stored column-by-column: first the
+ sample times, then the time series of each element of the vector (so that
+ each signal is contiguous, which both compresses well and is convenient for
+ post-processing). Each column is optionally zlib-compressed. Numbers are
+ stored in the host's native (little-endian on all supported platforms) byte
+ order.
+ */
+class VectorLogFileWriter {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorLogFileWriter);
+
+    /** Creates (or truncates) the file `filename` and writes its header.
+     @param input_size The dimension of each sample.
+     @throws std::exception if the file cannot be opened, or if the params are
+     invalid. */
+    VectorLogFileWriter(const std::string& filename, int input_size, const VectorLogFileParams& params = {});
+
+    /** Flushes and closes the file. */
+    ~VectorLogFileWriter();
+
+    /** Returns the dimension of each sample. */
+    int input_size() const { return input_size_; }
+
+    /** Returns the maximum number of samples per chunk. */
+    int64_t chunk_capacity() const { return params_.chunk_capacity; }
+
+    /** Returns the number of samples written to the file so far. */
+    int64_t num_samples_written() const { return num_samples_written_; }
+
+    /** Appends one chunk holding the given samples to the file, where each
+     column of `data` is the sample taken at the corresponding entry of
+     `times`.
+     @pre times.size() == data.cols() <= chunk_capacity()
+     @pre data.rows() == input_size()
+     @throws std::exception on a write error. */
+    void WriteChunk(const Eigen::Ref<const Eigen::VectorXd>& times, const Eigen::Ref<const Eigen::MatrixXd>& data);
+
+    /** Flushes buffered bytes to the operating system.
+     @throws std::exception on a write error. */
+    void Flush();
+
+private:
+    void WriteColumn(const double* values, int64_t size, int64_t stride);
+
+    const std::string filename_;
+    const int input_size_;
+    const VectorLogFileParams params_;
+    std::ofstream out_;
+    int64_t num_samples_written_{0};
+    // Scratch space for gathering and compressing one column.
+    std::vector<double> column_;
+    std::vector<unsigned char> compressed_;
+};
+
+/** Loads a file written by VectorLogFileWriter (e.g., by a streaming
+ VectorLog) into a VectorLog. The file is memory-mapped and the log's storage is
+ reserved up front, so loading reads each byte of the file once.
+ @throws std::exception if the file cannot be read or is not a vector log. */
+VectorLog<double> ReadVectorLogFile(const std::string& filename);
+
+}  // namespace systems
+}  // namespace drake
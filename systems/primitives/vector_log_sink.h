@@ -24,7 +24,9 @@ namespace systems {
 ///
 /// The stored log (a VectorLog) holds a large, Eigen matrix for data storage,
 /// where each column corresponds to a data point. The VectorLogSink saves a
-/// data point and the context time whenever it samples its input.
+/// data point and the context time whenever it samples its input. For long
+/// simulations, the log in a given context can be streamed to disk instead of
+/// being held in memory; see VectorLog::StreamTo().
 ///
 /// @warning The logged data MUST NOT be used to modify the behavior of a
 /// simulation. In technical terms, the log is not stored as System State, so
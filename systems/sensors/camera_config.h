@@ -395,8 +395,9 @@ struct CameraConfig {
 
     /** Delay (in seconds) between when the scene graph geometry is "captured"
      and when the output image is published. Refer to the RgbdSensorAsync class
-     for a comprehensive description.
-     @pre output_delay is non-negative and strictly less than 1/fps. */
+     for a comprehensive description, including how delays of 1/fps or more
+     render several frames concurrently.
+     @pre output_delay is non-negative and finite. */
     double output_delay{0.0};
 
     /** If true, RGB images will be produced and published via LCM. */
@@ -166,6 +166,15 @@ public:
         SaveImpl(&image, format, buffer);
     }
 
+    /** (Advanced) When true, Save() favors encoding speed over output size:
+    PNG data is compressed at zlib's fastest level and TIFF data is stored
+    uncompressed. JPEG encoding is unaffected. The images load back
+    identically either way. Defaults to false. */
+    void set_favor_save_speed(bool favor_save_speed) { favor_save_speed_ = favor_save_speed; }
+
+    /** Returns the value set by set_favor_save_speed(). */
+    bool favor_save_speed() const { return favor_save_speed_; }
+
 private:
     // ImageAnyConstPtr is like ImageAny but with `const Image<kPixelType>*`
     // passed by const pointer instead of a `Image<kPixelType>` (by value).
@@ -207,6 +216,8 @@ private:
     // TODO(jwnimmer-tri) Expose this so that Drake-internal callers can customize
     // their error handling.
     drake::internal::DiagnosticPolicy diagnostic_;
+
+    bool favor_save_speed_{false};
 };
 
 }  // namespace sensors
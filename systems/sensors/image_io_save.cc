@@ -8,7 +8,9 @@
 #include <vtkImageData.h>     // vtkCommonDataModel
 #include <vtkImageWriter.h>   // vtkIOImage
 #include <vtkNew.h>           // vtkCommonCore
+#include <vtkPNGWriter.h>     // vtkIOImage
 #include <vtkSmartPointer.h>  // vtkCommonCore
+#include <vtkTIFFWriter.h>    // vtkIOImage
 
 #include "systems/sensors/image_io_internal.h"
 #include "systems/sensors/vtk_image_reader_writer.h"
@@ -66,6 +68,15 @@ void ImageIo::SaveImpl(ImageAnyConstPtr image_any, std::optional<ImageFileFormat
     } else {
         writer = internal::MakeWriter(chosen_format, std::get<1>(output_any));
     }
+    if (favor_save_speed_) {
+        // Level 1 is zlib's fastest level that still compresses.
+        if (auto* png_writer = vtkPNGWriter::SafeDownCast(writer)) {
+            png_writer->SetCompressionLevel(1);
+        }
+        if (auto* tiff_writer = vtkTIFFWriter::SafeDownCast(writer)) {
+            tiff_writer->SetCompressionToNoCompression();
+        }
+    }
 
     // Copy the Drake image buffer to a VTK image buffer. Drake uses (x=0, y=0)
     // as the top left corner, but VTK uses it as the bottom left corner, and
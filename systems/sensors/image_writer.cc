@@ -2,20 +2,217 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "common/text_logging.h"
 #include "systems/sensors/image_io.h"
 
 namespace drake {
 namespace systems {
 namespace sensors {
 
+namespace {
+
+// Writes the image as a NumPy array file (format version 1.0) of shape
+// (height, width, channels). Drake images store their pixels row by row with
+// interleaved channels, which is the array's C-order layout, so the pixel data
+// is written verbatim after the header.
+template <PixelType kPixelType>
+void SaveToNpy(const Image<kPixelType>& image, const std::string& file_path) {
+    using T = typename ImageTraits<kPixelType>::ChannelType;
+    const char byte_order = sizeof(T) == 1 ? '|' : (std::endian::native == std::endian::little ? '<' : '>');
+    const char kind = std::is_floating_point_v<T> ? 'f' : (std::is_signed_v<T> ? 'i' : 'u');
+    std::string header = fmt::format("{{'descr': '{}{}{}', 'fortran_order': False, 'shape': ({}, {}, {}), }}",
+                                     byte_order, kind, sizeof(T), image.height(), image.width(),
+                                     Image<kPixelType>::kNumChannels);
+    // The header is padded with spaces and terminated by a newline so that the
+    // data is 64-byte aligned. The preamble is the magic string, the version,
+    // and the (little-endian) header length.
+    constexpr int kPreambleSize = 10;
+    const int unpadded_size = kPreambleSize + static_cast<int>(header.size()) + 1;
+    header.append((64 - unpadded_size % 64) % 64, ' ');
+    header.push_back('\n');
+    std::string preamble("\x93NUMPY\x01\x00", 8);
+    preamble.push_back(static_cast<char>(header.size() & 0xff));
+    preamble.push_back(static_cast<char>(header.size() >> 8));
+    DRAKE_DEMAND(static_cast<int>(preamble.size()) == kPreambleSize);
+
+    std::ofstream out(file_path, std::ios::binary);
+    out.write(preamble.data(), preamble.size());
+    out.write(header.data(), header.size());
+    if (image.size() > 0) {
+        out.write(reinterpret_cast<const char*>(image.at(0, 0)), image.size() * sizeof(T));
+    }
+    out.close();
+    if (out.fail()) {
+        throw std::runtime_error(fmt::format("ImageWriter: failed to write '{}'", file_path));
+    }
+}
+
+template <PixelType kPixelType>
+void SaveImage(const Image<kPixelType>& image, const std::string& file_path, ImageWriterEncoding encoding) {
+    switch (encoding) {
+        case ImageWriterEncoding::kDefault: {
+            ImageIo{}.Save(image, file_path);
+            return;
+        }
+        case ImageWriterEncoding::kFastPng: {
+            ImageIo image_io;
+            image_io.set_favor_save_speed(true);
+            image_io.Save(image, file_path);
+            return;
+        }
+        case ImageWriterEncoding::kNpy: {
+            SaveToNpy(image, file_path);
+            return;
+        }
+    }
+    DRAKE_UNREACHABLE();
+}
+
+}  // namespace
+
+// A fixed set of threads that run the write jobs from a bounded queue, in
+// the order they were pushed. Jobs with the same key (the output path) never
+// run concurrently and run in the order they were pushed, so the last image
+// written to a path is the one left on disk.
+class ImageWriter::WriterPool {
+public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(WriterPool);
+
+    WriterPool(int num_threads, int max_queue_size) : max_queue_size_(max_queue_size) {
+        threads_.reserve(num_threads);
+        for (int i = 0; i < num_threads; ++i) {
+            threads_.emplace_back([this]() {
+                Run();
+            });
+        }
+    }
+
+    // Finishes the queued jobs, then stops the threads.
+    ~WriterPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+        job_ready_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // Queues the job with the given key, first waiting for room in the queue
+    // if it is full. Rethrows the error of a previous job that failed, if any
+    // (without queueing this one).
+    void Push(std::string key, std::function<void()> job) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        slot_free_.wait(lock, [this]() {
+            return static_cast<int>(jobs_.size()) < max_queue_size_ || error_ != nullptr;
+        });
+        RethrowErrorLocked();
+        jobs_.push_back({std::move(key), std::move(job)});
+        lock.unlock();
+        job_ready_.notify_one();
+    }
+
+    // Waits for all queued jobs to finish, then rethrows the error of a job
+    // that failed, if any.
+    void Flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_.wait(lock, [this]() {
+            return jobs_.empty() && num_running_ == 0;
+        });
+        RethrowErrorLocked();
+    }
+
+private:
+    struct Job {
+        std::string key;
+        std::function<void()> run;
+    };
+
+    // Returns the oldest queued job whose key isn't being run, or end().
+    std::deque<Job>::iterator FindRunnableLocked() {
+        return std::find_if(jobs_.begin(), jobs_.end(), [this](const Job& job) {
+            return !running_keys_.contains(job.key);
+        });
+    }
+
+    void Run() {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                job_ready_.wait(lock, [this]() {
+                    return FindRunnableLocked() != jobs_.end() || (jobs_.empty() && shutdown_);
+                });
+                const auto iter = FindRunnableLocked();
+                if (iter == jobs_.end()) return;
+                job = std::move(*iter);
+                jobs_.erase(iter);
+                running_keys_.insert(job.key);
+                ++num_running_;
+            }
+            slot_free_.notify_one();
+            std::exception_ptr error;
+            try {
+                job.run();
+            } catch (...) {
+                error = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --num_running_;
+                running_keys_.erase(job.key);
+                if (error != nullptr && error_ == nullptr) {
+                    error_ = error;
+                }
+            }
+            // A queued job with the same key may now run.
+            job_ready_.notify_all();
+            // A failure also wakes a Push() waiting for room, to report it.
+            slot_free_.notify_all();
+            idle_.notify_all();
+        }
+    }
+
+    void RethrowErrorLocked() {
+        if (error_ != nullptr) {
+            std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+    }
+
+    const int max_queue_size_;
+    std::vector<std::thread> threads_;
+
+    std::mutex mutex_;
+    std::condition_variable job_ready_;
+    std::condition_variable slot_free_;
+    std::condition_variable idle_;
+    std::deque<Job> jobs_;                         // Guarded by mutex_.
+    std::unordered_set<std::string> running_keys_;  // Guarded by mutex_.
+    int num_running_{0};                           // Guarded by mutex_.
+    bool shutdown_{false};                         // Guarded by mutex_.
+    std::exception_ptr error_;                     // Guarded by mutex_.
+};
+
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
     ImageIo{}.Save(image, file_path, ImageFileFormat::kPng);
 }
@@ -36,7 +233,11 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
     ImageIo{}.Save(image, file_path, ImageFileFormat::kPng);
 }
 
-ImageWriter::ImageWriter() {
+ImageWriter::ImageWriter() : ImageWriter(ImageWriterParams{}) {}
+
+ImageWriter::ImageWriter(const ImageWriterParams& params) : params_(params) {
+    DRAKE_THROW_UNLESS(params.num_threads >= 0);
+    DRAKE_THROW_UNLESS(params.max_queue_size > 0);
     // NOTE: This excludes *many* of the defined `PixelType` values.
     labels_[PixelType::kRgba8U] = "color";
     extensions_[PixelType::kRgba8U] = ".png";
@@ -52,6 +253,19 @@ ImageWriter::ImageWriter() {
     // Declares a forced publish event to accommodate non-periodic image saving,
     // e.g., when saving images outside of Simulator::AdvanceTo.
     DeclareForcedPublishEvent(&ImageWriter::WriteAllImages);
+
+    if (params.num_threads > 0) {
+        pool_ = std::make_unique<WriterPool>(params.num_threads, params.max_queue_size);
+    }
+}
+
+ImageWriter::~ImageWriter() {
+    if (pool_ == nullptr) return;
+    try {
+        pool_->Flush();
+    } catch (const std::exception& e) {
+        log()->error("ImageWriter: failed to write an image: {}", e.what());
+    }
 }
 
 template <PixelType kPixelType>
@@ -94,7 +308,7 @@ const InputPort<double>& ImageWriter::DeclareImageInputPort(std::string port_nam
     }
 
     // Confirms file has appropriate extension.
-    const std::string& extension = extensions_[kPixelType];
+    const std::string extension = params_.encoding == ImageWriterEncoding::kNpy ? ".npy" : extensions_[kPixelType];
     if (file_name_format.substr(file_name_format.size() - extension.size()) != extension) {
         file_name_format += extension;
     }
@@ -169,8 +383,24 @@ void ImageWriter::WriteImage(const Context<double>& context, int index) const {
     const auto& port = get_input_port(index);
     const ImagePortInfo& data = port_info_[index];
     const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-    ImageIo{}.Save(image,
-                   MakeFileName(data.format, data.pixel_type, context.get_time(), port.get_name(), data.count++));
+    std::string file_name =
+            MakeFileName(data.format, data.pixel_type, context.get_time(), port.get_name(), data.count++);
+    if (pool_ == nullptr) {
+        SaveImage(image, file_name, params_.encoding);
+        return;
+    }
+    // The port's value can change before a worker gets to the job, so the job
+    // owns a copy of the image.
+    auto image_copy = std::make_shared<const Image<kPixelType>>(image);
+    pool_->Push(file_name, [image_copy, file_name, encoding = params_.encoding]() {
+        SaveImage(*image_copy, file_name, encoding);
+    });
+}
+
+void ImageWriter::Flush() const {
+    if (pool_ != nullptr) {
+        pool_->Flush();
+    }
 }
 
 EventStatus ImageWriter::WriteAllImages(const Context<double>& context) const {
@@ -7,6 +7,7 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -58,6 +59,42 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
 
 //@}
 
+/** The ways in which ImageWriter can encode the images it writes.  */
+enum class ImageWriterEncoding {
+    /** PNG files (TIFF files for ImageDepth32F), with the default compression.
+     */
+    kDefault,
+    /** PNG files compressed at zlib's fastest level (uncompressed TIFF files
+     for ImageDepth32F). The files are larger, but encoding them takes a
+     fraction of the time.  */
+    kFastPng,
+    /** Uncompressed NumPy arrays (`.npy` files) of shape
+     (height, width, channels), which are written at the speed of the disk and
+     load directly with `numpy.load()`. For ImageLabel16I the array's dtype is
+     int16; the other types use their unsigned (or float) channel type.  */
+    kNpy,
+};
+
+/** Configures how an ImageWriter writes its images.  */
+struct ImageWriterParams {
+    /** The number of background threads that encode and write images. If
+     zero, each image is written synchronously in the publish event that
+     captures it. Images written to the same file (e.g., by a port whose format
+     has no `{count}` or `{time_*}` field) are never written concurrently, and
+     are written in the order they were captured, so the file is left holding
+     the latest image.  */
+    int num_threads{0};
+
+    /** The maximum number of captured images waiting to be written (when
+     `num_threads` is positive). A publish event that finds the queue full
+     blocks until there is room, which bounds memory use when images are
+     captured faster than they can be written.  */
+    int max_queue_size{16};
+
+    /** The file encoding. The file name extension is chosen to match.  */
+    ImageWriterEncoding encoding{ImageWriterEncoding::kDefault};
+};
+
 /** A system for periodically writing images to the file system. The system also
  provides direct image writing via a forced publish event. The system does not
  have a fixed set of input ports; the system can have an arbitrary number of
@@ -101,14 +138,35 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  simultaneously to disk. Note that one can invoke a forced publish on this
  system using the same context multiple times, resulting in multiple
  write operations, with each operation overwriting the same file(s).
+
+ <h3>Writing in the background</h3>
+
+ Encoding an image (especially compressing a PNG) can take longer than
+ rendering it. When constructed with ImageWriterParams::num_threads > 0, a
+ publish event only copies the image into a bounded queue; a pool of threads
+ owned by the system encodes and writes the queued images. Files therefore
+ appear some time after the event that captured them; call Flush() to wait
+ for them (e.g., before reading them back), which the destructor does as well.
+ An error writing a queued image is rethrown by the next publish event or
+ call to Flush().
  */
 class ImageWriter : public LeafSystem<double> {
 public:
     DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter);
 
-    /** Constructs default instance with no image ports.  */
+    /** Constructs default instance with no image ports, which writes images
+     synchronously with the default encoding.  */
     ImageWriter();
 
+    /** Constructs an instance with no image ports that writes images as
+     configured by `params`.
+     @throws std::exception if `params.num_threads` is negative or
+                            `params.max_queue_size` is not positive.  */
+    explicit ImageWriter(const ImageWriterParams& params);
+
+    /** Waits for the images queued for writing, if any.  */
+    ~ImageWriter() override;
+
     /** Declares and configures a new image input port. A port is configured by
      providing:
 
@@ -229,6 +287,14 @@ public:
     // Resets the saved image count for all declared input ports to zero.
     void ResetAllImageCounts() const;
 
+    /** Blocks until every image captured so far has been written to disk. Does
+     nothing if the images are written synchronously.
+     @throws std::exception if writing a queued image failed.  */
+    void Flush() const;
+
+    /** Returns the parameters this writer was constructed with.  */
+    const ImageWriterParams& params() const { return params_; }
+
 private:
 #ifndef DRAKE_DOXYGEN_CXX
     // Friend for facilitating unit testing.
@@ -289,6 +355,13 @@ private:
 
     std::unordered_map<PixelType, std::string> labels_;
     std::unordered_map<PixelType, std::string> extensions_;
+
+    const ImageWriterParams params_;
+
+    // The threads that write images in the background; null when they are
+    // written synchronously.
+    class WriterPool;
+    std::unique_ptr<WriterPool> pool_;
 };
 
 }  // namespace sensors
@@ -1,12 +1,18 @@
 #include "systems/sensors/rgbd_sensor_async.h"
 
+#include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <future>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "systems/framework/diagram_builder.h"
 #include "systems/sensors/rgbd_sensor.h"
@@ -16,15 +22,24 @@
 There are two logical state variables (stored as a single abstract state
 variable):
 
-1. The Worker; this is essentially a std::future for the rendering task.
+1. The Workers; each one is essentially a std::future for a rendering task,
+   along with the queue of workers whose tasks have started but whose images
+   have not yet been output.
 2. The RenderedImages; this is the result of rendering.
 
 The system has two periodic update events, both at the same rate but with
 different phase offsets:
 
-1. The "capture" event updates the Worker state by launching a new render task.
-2. The "output" event updates the RenderedImages state by waiting for the worker
-   to finish and storing the resulting images.
+1. The "capture" event launches a new render task on the next Worker.
+2. The "output" event updates the RenderedImages state by waiting for the
+   oldest started worker to finish and storing the resulting images.
+
+When the output_delay is longer than the capture period, several frames are in
+flight at once, so there is one Worker per frame that can be in flight. Each
+Worker renders on its own thread, always the same one, with its own Context
+(and thus its own clone of the render engines), so that the frames render
+concurrently and engines which require it (e.g., GL) are used from only one
+thread.
 
 The only real trick is how to sufficiently encapsulate a rendering task so that
 it can run on a background thread. The Worker accomplishes that using a helper
@@ -158,11 +173,11 @@ struct RenderedImages {
 };
 
 /* The worker is an object where Start() copies the pose input for camera
-rendering and launches an async task, and Finish() blocks for the task to
-complete. The expected workflow is to create a Worker and then repeatedly
-Start and Finish in alternation (with exactly one Finish per Start). This
-encapsulates the lifetime of the async task along with the objects it must
-keep alive during rendering. */
+rendering and hands a task to the worker's thread, and Finish() blocks for the
+task to complete. The expected workflow is to create a Worker and then
+repeatedly Start and Finish in alternation (with exactly one Finish per Start).
+This encapsulates the lifetime of the thread and its tasks along with the
+objects they must keep alive during rendering. */
 class Worker {
 public:
     DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Worker);
@@ -171,6 +186,19 @@ public:
         : sensor_{std::move(sensor)}, color_{color}, depth_{depth}, label_{label} {
         DRAKE_DEMAND(sensor_ != nullptr);
         sensor_context_ = sensor_->CreateDefaultContext();
+        thread_ = std::thread([this]() {
+            Run();
+        });
+    }
+
+    /* Waits for the current task (if any), then stops the thread. */
+    ~Worker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shutdown_ = true;
+        }
+        task_ready_.notify_one();
+        thread_.join();
     }
 
     /* Begins rendering the given geometry as an async task. */
@@ -183,14 +211,26 @@ public:
     RenderedImages Finish();
 
 private:
+    // The body of thread_, which runs each task it is given.
+    void Run();
+
     const std::shared_ptr<const SnapshotSensor> sensor_;
     const bool color_;
     const bool depth_;
     const bool label_;
     std::unique_ptr<Context<double>> sensor_context_;
     std::future<RenderedImages> future_;
+
+    std::mutex mutex_;
+    std::condition_variable task_ready_;
+    std::packaged_task<RenderedImages()> task_;  // Guarded by mutex_.
+    bool shutdown_{false};                       // Guarded by mutex_.
+    std::thread thread_;
 };
 
+/* The workers of one sensor, as many as the frames it can have in flight. */
+using WorkerPool = std::vector<std::unique_ptr<Worker>>;
+
 }  // namespace
 
 /* The abstract state for an RgbdSensorAsync. The `output` is what appears on
@@ -201,7 +241,10 @@ one specific AbstractStateIndex instead of the entire State, then it would make
 sense to split this up into two separate abstract states. In the meantime, it's
 simplest to keep all of our state in one place. */
 struct RgbdSensorAsync::TickTockState {
-    std::shared_ptr<Worker> worker;
+    std::shared_ptr<WorkerPool> workers;
+    // The indices of the workers rendering frames that have been captured but
+    // not yet output, oldest first.
+    std::deque<int> in_flight;
     RenderedImages output;
 };
 
@@ -227,7 +270,6 @@ RgbdSensorAsync::RgbdSensorAsync(const SceneGraph<double>* scene_graph,
     DRAKE_THROW_UNLESS(std::isfinite(fps) && (fps > 0));
     DRAKE_THROW_UNLESS(std::isfinite(capture_offset) && (capture_offset >= 0));
     DRAKE_THROW_UNLESS(std::isfinite(output_delay) && (output_delay > 0));
-    DRAKE_THROW_UNLESS(output_delay < (1 / fps));
     DRAKE_THROW_UNLESS(color_camera_.has_value() || depth_camera_.has_value());
     DRAKE_THROW_UNLESS(!render_label_image || color_camera_.has_value());
     // TODO(jwnimmer-tri) Check that the render engine named by either of the two
@@ -324,57 +366,77 @@ EventStatus RgbdSensorAsync::Initialize(const Context<double>& context, State<do
     // The `sensor` is a separate, nested system that actually renders images.
     // The outer system (`this`) is just the event shims that will tick it. Our
     // job during initialization is to reset the nested system and any prior
-    // output.
+    // output. The workers share the sensor, but each has its own Context.
     auto sensor = std::make_shared<const SnapshotSensor>(scene_graph_, parent_id_, X_PB_, std::move(*color),
                                                          std::move(*depth));
-    next_state.worker = std::make_shared<Worker>(std::move(sensor), color_camera_.has_value(),
-                                                 depth_camera_.has_value(), render_label_image_);
+    auto workers = std::make_shared<WorkerPool>();
+    for (int i = 0; i < num_workers(); ++i) {
+        workers->push_back(std::make_unique<Worker>(sensor, color_camera_.has_value(), depth_camera_.has_value(),
+                                                    render_label_image_));
+    }
+    next_state.workers = std::move(workers);
+    next_state.in_flight.clear();
     next_state.output = {};
     return EventStatus::Succeeded();
 }
 
+int RgbdSensorAsync::num_workers() const {
+    // A frame is in flight from its capture until its output, output_delay
+    // later. When the delay is a whole number of periods, the capture event of
+    // a new frame comes before the output event of the oldest one. The
+    // tolerance counts a product that rounds to just below a whole number as
+    // that whole number; an extra worker is harmless, a missing one is not.
+    constexpr double kTolerance = 1e-9;
+    return static_cast<int>(std::floor(output_delay_ * fps_ + kTolerance)) + 1;
+}
+
 void RgbdSensorAsync::CalcTick(const Context<double>& context, State<double>* state) const {
     // Get the geometry pose updates.
     const auto& query = get_input_port().Eval<QueryObject<double>>(context);
 
-    // Grab the downcast references from our arguments.
-    const TickTockState& prior_state = get_state(context);
+    // Grab the downcast reference from our argument. N.B. We update the
+    // `state` in place (rather than starting over from the `context`), because
+    // when the capture and output events coincide both of them apply to it.
     TickTockState& next_state = get_mutable_state(state);
 
-    // Preserve the current output from the prior state. We're only going to
-    // launch a worker task, without any changes to our output.
-    next_state.output = prior_state.output;
-
-    // Latch-initialize a worker we didn't have one yet.
-    if (prior_state.worker == nullptr) {
+    // Latch-initialize the workers if we didn't have them yet.
+    if (next_state.workers == nullptr) {
         Initialize(context, state);
-    } else {
-        next_state.worker = prior_state.worker;
+    }
+    WorkerPool& workers = *next_state.workers;
+    const int num_workers = static_cast<int>(workers.size());
+
+    // Pick the worker after the one that started most recently. If every
+    // worker is busy (which only happens if the user manually changes the
+    // State), discard the oldest frame to make room.
+    const int index = next_state.in_flight.empty() ? 0 : (next_state.in_flight.back() + 1) % num_workers;
+    if (static_cast<int>(next_state.in_flight.size()) == num_workers) {
+        workers[next_state.in_flight.front()]->Finish();
+        next_state.in_flight.pop_front();
     }
 
-    // Start the worker on its next task.
-    next_state.worker->Start(context.get_time(), query);
+    // Start the worker on its next task. Our output is unchanged.
+    workers[index]->Start(context.get_time(), query);
+    next_state.in_flight.push_back(index);
 }
 
-void RgbdSensorAsync::CalcTock(const Context<double>& context, State<double>* state) const {
-    // Grab the downcast references from our arguments.
-    const TickTockState& prior_state = get_state(context);
+void RgbdSensorAsync::CalcTock(const Context<double>&, State<double>* state) const {
+    // Grab the downcast reference from our argument (see CalcTick for why we
+    // ignore the context).
     TickTockState& next_state = get_mutable_state(state);
 
     // If the user manually changes the State outside of a Simulator, we might hit
-    // a tock without having been initialized. Guard that here to avoid crashing.
-    if (prior_state.worker == nullptr) {
-        next_state = {};
+    // a tock without having been initialized or without any frame in flight.
+    // Guard that here to avoid crashing.
+    if (next_state.workers == nullptr || next_state.in_flight.empty()) {
+        next_state.output = {};
         return;
     }
 
-    // TODO(jwnimmer-tri) Consider adding a guard here so that out-of-sequence
-    // tocks due to the user manually screwing with the State result in empty
-    // images instead of stale images.
-
-    // Finish the worker task, and copy it to the output ports.
-    next_state.worker = prior_state.worker;
-    next_state.output = next_state.worker->Finish();
+    // Finish the oldest worker task, and copy it to the output ports.
+    const int index = next_state.in_flight.front();
+    next_state.in_flight.pop_front();
+    next_state.output = (*next_state.workers)[index]->Finish();
 }
 
 namespace {
@@ -467,8 +529,8 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
         future_ = {};
     }
 
-    // Launch the rendering task.
-    auto task = [this, context_time, poses = std::move(poses)]() -> RenderedImages {
+    // Hand the rendering task to our thread.
+    std::packaged_task<RenderedImages()> task([this, context_time, poses = std::move(poses)]() -> RenderedImages {
         for (const auto& [port_name, pose_vector] : poses) {
             const auto& input_port = sensor_->GetInputPort(port_name);
             input_port.FixValue(sensor_context_.get(), pose_vector);
@@ -493,8 +555,29 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
         result.X_WB = sensor_->GetOutputPort("body_pose_in_world").template Eval<RigidTransformd>(*sensor_context_);
         result.time = context_time;
         return result;
-    };
-    future_ = std::async(std::launch::async, std::move(task));
+    });
+    future_ = task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = std::move(task);
+    }
+    task_ready_.notify_one();
+}
+
+void Worker::Run() {
+    while (true) {
+        std::packaged_task<RenderedImages()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_ready_.wait(lock, [this]() {
+                return task_.valid() || shutdown_;
+            });
+            if (!task_.valid()) return;
+            task = std::move(task_);
+        }
+        // Any exception is stored in the future, for Finish() to rethrow.
+        task();
+    }
 }
 
 RenderedImages Worker::Finish() {
@@ -21,11 +21,11 @@ background thread to offer improved performance.
 
 @experimental
 
-@warning This system is intended for use only with the out-of-process glTF
-rendering engine (MakeRenderEngineGltfClient()). Other render engines (e.g.,
-MakeRenderEngineVtk() or MakeRenderEngineGl()) are either not thread-safe or
-perform poorly when used here. We hope to add async support for those engines
-down the road (see #19437 for details).
+@warning This system requires a render engine whose clones may render
+concurrently on different threads, such as the out-of-process glTF rendering
+engine (MakeRenderEngineGltfClient()), MakeRenderEngineGl(), or
+MakeRenderEngineRaster(). MakeRenderEngineVtk() is not thread-safe and must not
+be used here (see #19437 for details).
 
 @system
 name: RgbdSensorAsync
@@ -76,6 +76,15 @@ background thread, allowing simulation time to continue to advance during the
 rendering's `output_delay`. This helps smooth over the runtime latency
 associated with rendering.
 
+The `output_delay` may be longer than the capture period `1 / fps`, in which
+case several frames are in flight at once and render concurrently. The sensor
+keeps `floor(output_delay * fps) + 1` background threads, each with its own
+clone of the SceneGraph's render engines; a thread always renders with the same
+clone. Each frame is still output exactly `output_delay` after its capture, so
+the images (and their timing in simulation time) don't depend on how quickly
+they are rendered. Multiple %RgbdSensorAsync systems likewise render on their
+own threads, concurrently with each other.
+
 See also RgbdSensorDiscrete for a simpler (unthreaded) discrete sensor model, or
 RgbdSensor for a continuous model.
 
@@ -106,7 +115,8 @@ public:
       Typically zero. Must be non-negative and finite.
     @param output_delay How long after the `geometry_query` input sample the
       output ports should change to reflect the new rendered image(s).
-      Must be strictly positive and strictly less than 1/fps.
+      Must be strictly positive and finite. A delay of 1/fps or more renders
+      several frames concurrently (see the class overview).
     @param color_camera The properties for the `color_image` output port.
       When nullopt, there will be no `color_image` output port.
       At least one of `color_camera` or `depth_camera` must be provided.
@@ -183,6 +193,10 @@ private:
     const TickTockState& get_state(const Context<double>&) const;
     TickTockState& get_mutable_state(State<double>*) const;
 
+    // Returns the number of frames that can be in flight at once (and thus
+    // the number of rendering threads).
+    int num_workers() const;
+
     EventStatus Initialize(const Context<double>&, State<double>*) const;
     void CalcTick(const Context<double>&, State<double>*) const;
     void CalcTock(const Context<double>&, State<double>*) const;